@@ -28,6 +28,28 @@ export interface ChatDetailEntry {
   createdAt: string;
 }
 
+export interface ChatDetailPageOptions {
+  limit?: number;
+  // Entries newer than this detail id.
+  sinceId?: string;
+  // Entries older than this detail id.
+  beforeId?: string;
+}
+
+export interface ChatDetailPage {
+  details: ChatDetailEntry[];
+  // Older entries exist before the first returned one.
+  hasMore: boolean;
+  // The since cursor could not be continued (unknown id, or more new entries than the limit),
+  // so details is the latest page and replaces whatever the caller holds.
+  reset: boolean;
+}
+
+interface ChatDetailPosition {
+  createdAt: string;
+  rowid: number;
+}
+
 function toIsoNow(): string {
   return new Date().toISOString();
 }
@@ -299,31 +321,53 @@ export class ChatStore {
   }
 
   public listDetails(chatId: string, limit?: number): ChatDetailEntry[] {
+    return this.listDetailPage(chatId, { limit }).details;
+  }
+
+  public listDetailPage(chatId: string, options: ChatDetailPageOptions = {}): ChatDetailPage {
     this.getChat(chatId);
 
+    const { limit } = options;
     const hasLimit = typeof limit === "number" && Number.isFinite(limit) && Math.trunc(limit) > 0;
     const normalizedLimit = hasLimit ? Math.trunc(limit) : 0;
-    const rows = hasLimit
-      ? this.db
-          .prepare(
-            `SELECT id, chat_id, kind, route, summary, provider, model, chat_type, payload_json, created_at
-             FROM chat_details
-             WHERE chat_id = ?
-             ORDER BY created_at DESC, rowid DESC
-             LIMIT ?`
-          )
-          .all(chatId, normalizedLimit)
-      : this.db
-          .prepare(
-            `SELECT id, chat_id, kind, route, summary, provider, model, chat_type, payload_json, created_at
-             FROM chat_details
-             WHERE chat_id = ?
-             ORDER BY created_at DESC, rowid DESC`
-          )
-          .all(chatId);
+    const params: Array<string | number> = [chatId];
+    let cursorFilter = "";
+
+    const since = options.sinceId ? this.getDetailPosition(chatId, options.sinceId) : undefined;
+    if (since) {
+      cursorFilter = "AND (created_at, rowid) > (?, ?)";
+      params.push(since.createdAt, since.rowid);
+    } else if (options.beforeId) {
+      const before = this.getDetailPosition(chatId, options.beforeId);
+      if (!before) {
+        throw new Error(`Chat detail ${options.beforeId} was not found.`);
+      }
+      cursorFilter = "AND (created_at, rowid) < (?, ?)";
+      params.push(before.createdAt, before.rowid);
+    }
 
+    // One extra row tells whether anything older is left.
+    if (hasLimit) {
+      params.push(normalizedLimit + 1);
+    }
+    const rows = this.db
+      .prepare(
+        `SELECT id, chat_id, kind, route, summary, provider, model, chat_type, payload_json, created_at
+         FROM chat_details
+         WHERE chat_id = ? ${cursorFilter}
+         ORDER BY created_at DESC, rowid DESC
+         ${hasLimit ? "LIMIT ?" : ""}`
+      )
+      .all(...params);
+
+    const hasMore = hasLimit && rows.length > normalizedLimit;
+    const pageRows = hasMore ? rows.slice(0, normalizedLimit) : rows;
     // Fetch latest entries first, then restore chronological order for UI rendering.
-    return rows.reverse().map((row) => this.mapDetailRow(row));
+    return {
+      details: pageRows.reverse().map((row) => this.mapDetailRow(row)),
+      hasMore,
+      reset: options.sinceId !== undefined && (!since || hasMore)
+    };
   }
 
   public appendAsked(chatId: string, route: string, summary: string, payload?: unknown): ChatDetailEntry {
@@ -408,6 +452,13 @@ export class ChatStore {
     return this.mapDetailRow(row);
   }
 
+  private getDetailPosition(chatId: string, detailId: string): ChatDetailPosition | undefined {
+    const row = this.db
+      .prepare(`SELECT created_at, rowid FROM chat_details WHERE chat_id = ? AND id = ?`)
+      .get(chatId, detailId) as { created_at: string; rowid: number } | undefined;
+    return row ? { createdAt: row.created_at, rowid: row.rowid } : undefined;
+  }
+
   private getLatestDetailMetadata(chatId: string, limit = 30): { provider?: string; model?: string; chatType?: ChatType } {
     const normalizedLimit = Math.max(1, Math.min(200, Math.trunc(limit)));
     const rows = this.db
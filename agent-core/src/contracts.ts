@@ -91,6 +91,50 @@ const SelectionActorSchema = z
   })
   .strict();
 
+export const SceneActorRecordSchema = z
+  .object({
+    name: z.string().trim().min(1),
+    label: z.string(),
+    class: z.string().trim().min(1),
+    folder: z.string().trim().min(1).optional(),
+    location: z.object({ x: z.number().finite(), y: z.number().finite(), z: z.number().finite() }).strict(),
+    rotation: z.object({ pitch: z.number().finite(), yaw: z.number().finite(), roll: z.number().finite() }).strict(),
+    scale: z.object({ x: z.number().finite(), y: z.number().finite(), z: z.number().finite() }).strict()
+  })
+  .strict();
+
+export type SceneActorRecord = z.infer<typeof SceneActorRecordSchema>;
+
+const NearbyActorSchema = SceneActorRecordSchema.extend({
+  distance: z.number().finite().min(0)
+});
+
+const SceneSummaryContextSchema = z
+  .object({
+    actorCount: z.number().int().min(0),
+    classCount: z.number().int().min(0).optional(),
+    topClasses: z
+      .array(
+        z
+          .object({
+            class: z.string().trim().min(1),
+            count: z.number().int().min(0)
+          })
+          .strict()
+      )
+      .max(64)
+      .optional()
+  })
+  .strict();
+
+const SceneContextSchema = z
+  .object({
+    snapshotId: z.string().uuid(),
+    version: z.number().int().min(0),
+    actorCount: z.number().int().min(0)
+  })
+  .strict();
+
 const LevelContextSchema = z
   .object({
     mapName: z.string().trim().min(1).optional(),
@@ -118,19 +162,43 @@ export const TaskContextSchema = z
     performance: WorldStatePerformanceContextSchema.optional(),
     assets: WorldStateAssetsContextSchema.optional()
     ,
-    level: LevelContextSchema.optional()
+    level: LevelContextSchema.optional(),
+    scene: SceneContextSchema.optional(),
+    sceneSummary: SceneSummaryContextSchema.optional(),
+    nearbyActors: z.array(NearbyActorSchema).max(256).optional()
   })
   .strict();
 
 export const ProviderNameSchema = z.enum(["openai", "gemini", "local"]);
 
+export const SceneDeltaSchema = z
+  .object({
+    snapshotId: z.string().uuid(),
+    version: z.number().int().min(0),
+    baseVersion: z.number().int().min(0),
+    full: z.boolean(),
+    upserts: z.array(SceneActorRecordSchema),
+    removed: z.array(z.string().trim().min(1))
+  })
+  .strict();
+
+export type SceneDelta = z.infer<typeof SceneDeltaSchema>;
+
+export const SceneAckSchema = z.object({
+  snapshotId: z.string().uuid(),
+  version: z.number().int().min(0)
+});
+
+export type SceneAck = z.infer<typeof SceneAckSchema>;
+
 export const TaskRequestSchema = z.object({
   prompt: z.string().min(1),
   mode: z.enum(["chat", "agent"]).default("chat"),
   context: TaskContextSchema.default({}),
   provider: ProviderNameSchema.optional(),
   model: z.string().trim().min(1).optional(),
-  chatId: z.string().uuid().optional()
+  chatId: z.string().uuid().optional(),
+  sceneDelta: SceneDeltaSchema.optional()
 });
 
 export type TaskRequest = z.infer<typeof TaskRequestSchema>;
@@ -181,12 +249,18 @@ export const PlanActionSchema = z.object({
   risk: z.enum(["low", "medium", "high"])
 });
 
-const SceneCreateActorParamsSchema = z.object({
-  actorClass: z.string().min(1),
-  location: DeltaLocationSchema.optional(),
-  rotation: DeltaRotationSchema.optional(),
-  count: z.number().int().min(1).max(200).default(1)
-});
+const SceneCreateActorParamsSchema = z
+  .object({
+    actorClass: z.string().min(1),
+    location: DeltaLocationSchema.optional(),
+    rotation: DeltaRotationSchema.optional(),
+    count: z.number().int().min(1).max(10000).default(1),
+    meshPath: z.string().min(1).optional(),
+    instanced: z.boolean().optional()
+  })
+  .refine((value) => (value.instanced ? Boolean(value.meshPath) : true), {
+    message: "scene.createActor instanced=true needs meshPath"
+  });
 
 const SceneDeleteActorParamsSchema = z
   .object({
@@ -273,7 +347,8 @@ const SceneDuplicateActorsParamsSchema = z
     target: z.enum(["selection", "byName"]),
     actorNames: z.array(z.string().min(1)).optional(),
     count: z.number().int().min(1).max(20).default(1),
-    offset: DeltaLocationSchema.optional()
+    offset: DeltaLocationSchema.optional(),
+    instanced: z.boolean().optional()
   })
   .refine((value) => (value.target === "byName" ? (value.actorNames ?? []).length > 0 : true), {
     message: "scene.duplicateActors target=byName needs actorNames"
@@ -463,10 +538,46 @@ export const SessionStartRequestSchema = TaskRequestSchema.extend({
 });
 export type SessionStartRequest = z.infer<typeof SessionStartRequestSchema>;
 
+export const ToolErrorCodeSchema = z.enum([
+  "none",
+  "editor_unavailable",
+  "world_unavailable",
+  "invalid_arguments",
+  "no_targets",
+  "asset_not_found",
+  "spawn_failed",
+  "transaction_state",
+  "nothing_changed",
+  "stopped"
+]);
+export type ToolErrorCode = z.infer<typeof ToolErrorCodeSchema>;
+
+export const ToolResultCountsSchema = z.object({
+  targets: z.number().int().min(0).default(0),
+  actors: z.number().int().min(0).default(0),
+  components: z.number().int().min(0).default(0),
+  instances: z.number().int().min(0).default(0),
+  requested: z.number().int().min(0).default(0)
+});
+
+// Instances added to one instanced mesh actor: indices start to start + count - 1.
+export const ToolResultInstanceRangeSchema = z.object({
+  actor: z.string().min(1),
+  start: z.number().int().min(0),
+  count: z.number().int().min(1)
+});
+
 export const SessionResultSchema = z.object({
   actionIndex: z.number().int().min(0),
   ok: z.boolean(),
-  message: z.string().optional()
+  message: z.string().optional(),
+  tool: z.string().optional(),
+  errorCode: ToolErrorCodeSchema.optional(),
+  counts: ToolResultCountsSchema.optional(),
+  affectedActors: z.array(z.string()).max(200).optional(),
+  instanceRanges: z.array(ToolResultInstanceRangeSchema).optional(),
+  durationMs: z.number().min(0).optional(),
+  usedSelectionFallback: z.boolean().optional()
 });
 export type SessionResult = z.infer<typeof SessionResultSchema>;
 
@@ -491,6 +602,59 @@ export const SessionResumeRequestSchema = z.object({
 });
 export type SessionResumeRequest = z.infer<typeof SessionResumeRequestSchema>;
 
+const ContextVectorSchema = z.object({ x: z.number().finite(), y: z.number().finite(), z: z.number().finite() }).strict();
+
+const ContextFindNearestActorsQuerySchema = z.object({
+  command: z.literal("context.findNearestActors"),
+  params: z
+    .object({
+      actorName: z.string().trim().min(1).optional(),
+      location: ContextVectorSchema.optional(),
+      classFilter: z.string().trim().min(1).optional(),
+      count: z.number().int().min(1).max(256).optional(),
+      excludeNames: z.array(z.string().trim().min(1)).optional()
+    })
+    .strict()
+    .refine((value) => Boolean(value.actorName) || Boolean(value.location), {
+      message: "context.findNearestActors needs actorName or location"
+    })
+});
+
+const ContextFindActorsInBoxQuerySchema = z.object({
+  command: z.literal("context.findActorsInBox"),
+  params: z
+    .object({
+      min: ContextVectorSchema,
+      max: ContextVectorSchema,
+      classFilter: z.string().trim().min(1).optional(),
+      limit: z.number().int().min(1).max(1024).optional()
+    })
+    .strict()
+});
+
+const ContextGetSceneSummaryQuerySchema = z.object({
+  command: z.literal("context.getSceneSummary"),
+  params: z
+    .object({
+      cursor: z.string().min(1).optional(),
+      pageSize: z.number().int().min(1).max(5000).optional(),
+      fields: z.array(z.enum(["name", "label", "class", "folder", "location", "rotation", "scale", "bounds"])).optional(),
+      classFilter: z.string().trim().min(1).optional(),
+      includeHistograms: z.boolean().optional()
+    })
+    .strict()
+    .default({})
+});
+
+// Read-only context.* commands. Agent Core forwards them to the editor over the event channel,
+// which answers from its scene snapshot.
+export const ContextQueryRequestSchema = z.discriminatedUnion("command", [
+  ContextFindNearestActorsQuerySchema,
+  ContextFindActorsInBoxQuerySchema,
+  ContextGetSceneSummaryQuerySchema
+]);
+export type ContextQueryRequest = z.infer<typeof ContextQueryRequestSchema>;
+
 export const ChatCreateRequestSchema = z.object({
   title: z.string().trim().min(1).max(120).optional()
 });
@@ -0,0 +1,444 @@
+import { createHash } from "node:crypto";
+import type http from "node:http";
+import net from "node:net";
+import type { Duplex } from "node:stream";
+
+// Minimal RFC 6455 server for the editor channel: text messages, fragmentation, ping/pong and close.
+// Kept dependency-free; extensions and binary payload handling are not needed by the plugin.
+
+// Subprotocol the plugin requests. No other protocol is ever echoed back.
+export const EVENT_CHANNEL_PROTOCOL = "ue-ai-agent.events.v1";
+
+const WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+const MAX_MESSAGE_BYTES = 16 * 1024 * 1024;
+const MAX_CONTROL_PAYLOAD_BYTES = 125;
+const PING_INTERVAL_MS = 30_000;
+const DEFAULT_REQUEST_TIMEOUT_MS = 15_000;
+
+const OPCODE_CONTINUATION = 0x0;
+const OPCODE_TEXT = 0x1;
+const OPCODE_BINARY = 0x2;
+const OPCODE_CLOSE = 0x8;
+const OPCODE_PING = 0x9;
+const OPCODE_PONG = 0xa;
+
+const CLOSE_NORMAL = 1000;
+const CLOSE_PROTOCOL_ERROR = 1002;
+const CLOSE_TOO_LARGE = 1009;
+
+interface Frame {
+  fin: boolean;
+  opcode: number;
+  payload: Buffer;
+}
+
+export class EventClient {
+  private buffer: Buffer = Buffer.alloc(0);
+  private fragments: Buffer[] = [];
+  private fragmentBytes = 0;
+  private closed = false;
+
+  constructor(
+    private readonly socket: Duplex,
+    private readonly onText: (client: EventClient, text: string) => void,
+    private readonly onClose: (client: EventClient) => void
+  ) {
+    socket.on("data", (chunk: Buffer) => this.receive(chunk));
+    // The HTTP server allows half-open sockets, so a peer that leaves without a close frame must be ended here.
+    socket.on("end", () => {
+      socket.end();
+      this.finish();
+    });
+    socket.on("close", () => this.finish());
+    socket.on("error", () => this.finish());
+  }
+
+  public send(message: unknown): void {
+    this.writeFrame(OPCODE_TEXT, Buffer.from(JSON.stringify(message), "utf8"));
+  }
+
+  public ping(): void {
+    this.writeFrame(OPCODE_PING, Buffer.alloc(0));
+  }
+
+  public close(code = CLOSE_NORMAL): void {
+    if (this.closed) {
+      return;
+    }
+    const payload = Buffer.alloc(2);
+    payload.writeUInt16BE(code, 0);
+    this.writeFrame(OPCODE_CLOSE, payload);
+    this.socket.end();
+    this.finish();
+  }
+
+  public receive(chunk: Buffer): void {
+    if (this.closed) {
+      return;
+    }
+    this.buffer = this.buffer.length === 0 ? chunk : Buffer.concat([this.buffer, chunk]);
+    for (;;) {
+      const frame = this.readFrame();
+      if (!frame || this.closed) {
+        return;
+      }
+      this.handleFrame(frame);
+    }
+  }
+
+  private readFrame(): Frame | undefined {
+    if (this.buffer.length < 2) {
+      return undefined;
+    }
+
+    const first = this.buffer[0];
+    const second = this.buffer[1];
+    let length = second & 0x7f;
+    let offset = 2;
+    if (length === 126) {
+      if (this.buffer.length < 4) {
+        return undefined;
+      }
+      length = this.buffer.readUInt16BE(2);
+      offset = 4;
+    } else if (length === 127) {
+      if (this.buffer.length < 10) {
+        return undefined;
+      }
+      if (this.buffer.readUInt32BE(2) !== 0) {
+        this.close(CLOSE_TOO_LARGE);
+        return undefined;
+      }
+      length = this.buffer.readUInt32BE(6);
+      offset = 10;
+    }
+
+    // Client frames must be masked. Control frames must be final and carry at most 125 bytes.
+    const fin = (first & 0x80) !== 0;
+    const opcode = first & 0x0f;
+    if ((second & 0x80) === 0 || ((opcode & 0x8) !== 0 && (!fin || length > MAX_CONTROL_PAYLOAD_BYTES))) {
+      this.close(CLOSE_PROTOCOL_ERROR);
+      return undefined;
+    }
+    if (length > MAX_MESSAGE_BYTES) {
+      this.close(CLOSE_TOO_LARGE);
+      return undefined;
+    }
+    if (this.buffer.length < offset + 4 + length) {
+      return undefined;
+    }
+
+    const mask = this.buffer.subarray(offset, offset + 4);
+    const payload = Buffer.from(this.buffer.subarray(offset + 4, offset + 4 + length));
+    for (let index = 0; index < payload.length; index += 1) {
+      payload[index] ^= mask[index & 3];
+    }
+    this.buffer = this.buffer.subarray(offset + 4 + length);
+    return { fin, opcode, payload };
+  }
+
+  private handleFrame(frame: Frame): void {
+    switch (frame.opcode) {
+      case OPCODE_CLOSE:
+        this.close(frame.payload.length >= 2 ? frame.payload.readUInt16BE(0) : CLOSE_NORMAL);
+        return;
+      case OPCODE_PING:
+        this.writeFrame(OPCODE_PONG, frame.payload);
+        return;
+      case OPCODE_PONG:
+        return;
+      case OPCODE_TEXT:
+      case OPCODE_BINARY:
+        if (this.fragments.length > 0) {
+          this.close(CLOSE_PROTOCOL_ERROR);
+          return;
+        }
+        this.appendFragment(frame);
+        return;
+      case OPCODE_CONTINUATION:
+        if (this.fragments.length === 0) {
+          this.close(CLOSE_PROTOCOL_ERROR);
+          return;
+        }
+        this.appendFragment(frame);
+        return;
+      default:
+        this.close(CLOSE_PROTOCOL_ERROR);
+    }
+  }
+
+  private appendFragment(frame: Frame): void {
+    this.fragmentBytes += frame.payload.length;
+    if (this.fragmentBytes > MAX_MESSAGE_BYTES) {
+      this.close(CLOSE_TOO_LARGE);
+      return;
+    }
+    this.fragments.push(frame.payload);
+    if (!frame.fin) {
+      return;
+    }
+
+    const message = this.fragments.length === 1 ? this.fragments[0] : Buffer.concat(this.fragments);
+    this.fragments = [];
+    this.fragmentBytes = 0;
+    this.onText(this, message.toString("utf8"));
+  }
+
+  private writeFrame(opcode: number, payload: Buffer): void {
+    if (this.closed || !this.socket.writable) {
+      return;
+    }
+
+    let header: Buffer;
+    if (payload.length < 126) {
+      header = Buffer.alloc(2);
+      header[1] = payload.length;
+    } else if (payload.length <= 0xffff) {
+      header = Buffer.alloc(4);
+      header[1] = 126;
+      header.writeUInt16BE(payload.length, 2);
+    } else {
+      header = Buffer.alloc(10);
+      header[1] = 127;
+      header.writeUInt32BE(0, 2);
+      header.writeUInt32BE(payload.length, 6);
+    }
+    header[0] = 0x80 | opcode;
+    this.socket.write(header);
+    if (payload.length > 0) {
+      this.socket.write(payload);
+    }
+  }
+
+  private finish(): void {
+    if (this.closed) {
+      return;
+    }
+    this.closed = true;
+    this.fragments = [];
+    this.buffer = Buffer.alloc(0);
+    this.onClose(this);
+  }
+}
+
+export interface EventChannelHandlers {
+  onConnect(client: EventClient): void | Promise<void>;
+  onMessage(client: EventClient, message: Record<string, unknown>, rawText: string): void | Promise<void>;
+}
+
+// statusCode is the HTTP status a route should answer with when it forwards a failed request.
+export class EventChannelRequestError extends Error {
+  constructor(
+    message: string,
+    public readonly statusCode: number
+  ) {
+    super(message);
+  }
+}
+
+interface PendingRequest {
+  client: EventClient;
+  replyType: string;
+  resolve(reply: Record<string, unknown>): void;
+  reject(error: Error): void;
+  timer: NodeJS.Timeout;
+}
+
+export interface EventChannelOptions {
+  // Browser origins allowed to connect, e.g. "http://localhost:3000". Empty by default.
+  allowedOrigins?: string[];
+}
+
+// Browsers always send Origin as "scheme://host[:port]" or "null" and scripts cannot override it.
+// Native clients either omit it or send a bare host name.
+function isBrowserOrigin(origin: string): boolean {
+  return origin === "null" || /^[a-z][a-z0-9+.-]*:\/\//i.test(origin);
+}
+
+function readHeader(value: string | string[] | undefined): string | undefined {
+  return Array.isArray(value) ? value.join(",") : value;
+}
+
+export class EventChannel {
+  private readonly clients = new Set<EventClient>();
+  private readonly allowedOrigins: Set<string>;
+  private readonly pendingRequests = new Map<number, PendingRequest>();
+  private nextRequestId = 1;
+  private pingTimer: NodeJS.Timeout | undefined;
+
+  constructor(
+    private readonly path: string,
+    private readonly handlers: EventChannelHandlers,
+    options: EventChannelOptions = {}
+  ) {
+    this.allowedOrigins = new Set((options.allowedOrigins ?? []).map((origin) => origin.toLowerCase()));
+  }
+
+  public attach(server: http.Server): void {
+    server.on("upgrade", (req: http.IncomingMessage, socket: Duplex, head: Buffer) => {
+      this.handleUpgrade(req, socket, head);
+    });
+    server.on("close", () => {
+      if (this.pingTimer) {
+        clearInterval(this.pingTimer);
+        this.pingTimer = undefined;
+      }
+    });
+    this.pingTimer = setInterval(() => {
+      for (const client of this.clients) {
+        client.ping();
+      }
+    }, PING_INTERVAL_MS);
+    this.pingTimer.unref();
+  }
+
+  public get clientCount(): number {
+    return this.clients.size;
+  }
+
+  public broadcast(message: unknown): void {
+    for (const client of this.clients) {
+      client.send(message);
+    }
+  }
+
+  // Sends { ...body, type, id } to the most recently connected editor and resolves with its
+  // { type: replyType, id } reply. Rejects when no editor is connected, it disconnects, or the timeout passes.
+  public request(
+    type: string,
+    body: Record<string, unknown>,
+    replyType: string,
+    timeoutMs = DEFAULT_REQUEST_TIMEOUT_MS
+  ): Promise<Record<string, unknown>> {
+    let target: EventClient | undefined;
+    for (const client of this.clients) {
+      target = client;
+    }
+    if (!target) {
+      return Promise.reject(new EventChannelRequestError("No editor is connected to the event channel.", 503));
+    }
+
+    const client = target;
+    const id = this.nextRequestId++;
+    return new Promise((resolve, reject) => {
+      const timer = setTimeout(() => {
+        this.pendingRequests.delete(id);
+        reject(new EventChannelRequestError(`The editor did not answer ${type} within ${timeoutMs} ms.`, 504));
+      }, timeoutMs);
+      this.pendingRequests.set(id, { client, replyType, resolve, reject, timer });
+      client.send({ ...body, type, id });
+    });
+  }
+
+  private handleUpgrade(req: http.IncomingMessage, socket: Duplex, head: Buffer): void {
+    const pathname = new URL(req.url ?? "/", "http://localhost").pathname;
+    const key = req.headers["sec-websocket-key"];
+    const upgrade = req.headers.upgrade;
+    if (pathname !== this.path || typeof key !== "string" || upgrade?.toLowerCase() !== "websocket") {
+      socket.end("HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n");
+      return;
+    }
+
+    // Any page open in a browser could otherwise reach the local agent and drive session steps.
+    const origin = readHeader(req.headers.origin);
+    if (origin !== undefined && isBrowserOrigin(origin) && !this.allowedOrigins.has(origin.toLowerCase())) {
+      socket.end("HTTP/1.1 403 Forbidden\r\nConnection: close\r\n\r\n");
+      return;
+    }
+
+    const accept = createHash("sha1").update(key + WEBSOCKET_GUID).digest("base64");
+    const responseLines = [
+      "HTTP/1.1 101 Switching Protocols",
+      "Upgrade: websocket",
+      "Connection: Upgrade",
+      `Sec-WebSocket-Accept: ${accept}`
+    ];
+    const offeredProtocols = (readHeader(req.headers["sec-websocket-protocol"]) ?? "")
+      .split(",")
+      .map((protocol) => protocol.trim());
+    if (offeredProtocols.includes(EVENT_CHANNEL_PROTOCOL)) {
+      responseLines.push(`Sec-WebSocket-Protocol: ${EVENT_CHANNEL_PROTOCOL}`);
+    }
+    socket.write(`${responseLines.join("\r\n")}\r\n\r\n`);
+    if (socket instanceof net.Socket) {
+      socket.setNoDelay(true);
+    }
+
+    const client = new EventClient(
+      socket,
+      (sender, text) => this.dispatch(sender, text),
+      (closed) => this.removeClient(closed)
+    );
+    this.clients.add(client);
+    if (head.length > 0) {
+      client.receive(head);
+    }
+
+    Promise.resolve(this.handlers.onConnect(client)).catch((error: unknown) => {
+      // eslint-disable-next-line no-console
+      console.warn("Event channel connect handler failed:", error);
+    });
+  }
+
+  private dispatch(client: EventClient, text: string): void {
+    let message: unknown;
+    try {
+      message = JSON.parse(text);
+    } catch {
+      client.send({ type: "error", error: "Message is not valid JSON." });
+      return;
+    }
+    if (!message || typeof message !== "object" || Array.isArray(message)) {
+      client.send({ type: "error", error: "Message must be a JSON object." });
+      return;
+    }
+
+    // The editor numbers its own requests too, so a reply must match the client and reply type as well as the id.
+    const record = message as Record<string, unknown>;
+    const pending = typeof record.id === "number" ? this.pendingRequests.get(record.id) : undefined;
+    if (pending && pending.client === client && record.type === pending.replyType) {
+      clearTimeout(pending.timer);
+      this.pendingRequests.delete(record.id as number);
+      pending.resolve(record);
+      return;
+    }
+
+    Promise.resolve(this.handlers.onMessage(client, record, text)).catch((error: unknown) => {
+      // eslint-disable-next-line no-console
+      console.warn("Event channel message handler failed:", error);
+    });
+  }
+
+  private removeClient(client: EventClient): void {
+    this.clients.delete(client);
+    for (const [id, pending] of this.pendingRequests) {
+      if (pending.client === client) {
+        clearTimeout(pending.timer);
+        this.pendingRequests.delete(id);
+        pending.reject(new EventChannelRequestError("The editor disconnected before answering.", 503));
+      }
+    }
+  }
+}
+
+export interface ChannelRequestRoute {
+  type: string;
+  handle(rawText: string): Promise<Record<string, unknown>>;
+}
+
+// Answers { type, id } request messages: the matching route's result is sent back as
+// { type: replyType, id, ...result }, and unknown types get { type: "error", id }.
+export function routeChannelRequests(
+  routes: ChannelRequestRoute[],
+  replyType: string
+): EventChannelHandlers["onMessage"] {
+  return async (client, message, rawText) => {
+    const route = routes.find((candidate) => candidate.type === message.type);
+    if (!route) {
+      client.send({ type: "error", id: message.id, error: `Unknown message type: ${String(message.type)}` });
+      return;
+    }
+    const result = await route.handle(rawText);
+    client.send({ ...result, type: replyType, id: message.id });
+  };
+}
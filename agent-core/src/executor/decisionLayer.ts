@@ -1,4 +1,4 @@
-import type { SessionResult } from "../contracts.js";
+import type { SessionResult, ToolErrorCode } from "../contracts.js";
 import type { SessionData, SessionDecision } from "../sessions/sessionTypes.js";
 
 export function applySessionResult(session: SessionData, result: SessionResult): void {
@@ -12,17 +12,23 @@ export function applySessionResult(session: SessionData, result: SessionResult):
 
   action.attempts += 1;
   action.lastMessage = result.message;
+  action.lastResult = result;
 
   if (result.ok) {
     action.state = "succeeded";
     return;
   }
 
-  if (action.attempts >= session.maxRetries + 1) {
+  if (action.attempts >= session.maxRetries + 1 || isNonRetryableError(result.errorCode)) {
     action.state = "failed";
   }
 }
 
+// Retrying the same action cannot fix these; other codes may clear up once selection or editor state changes.
+function isNonRetryableError(errorCode: ToolErrorCode | undefined): boolean {
+  return errorCode === "invalid_arguments" || errorCode === "asset_not_found";
+}
+
 function riskRank(risk: "low" | "medium" | "high"): number {
   if (risk === "high") {
     return 2;
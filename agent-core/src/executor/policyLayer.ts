@@ -123,6 +123,18 @@ function applyLocalPolicy(action: PlanAction, policy: PolicyRuntimeConfig, mode:
       risk = decision.risk;
       message = decision.message;
     }
+
+    if (action.params.meshPath !== undefined && !isAllowedAssetPath(action.params.meshPath)) {
+      const decision = requireApproval(
+        action,
+        "Policy: meshPath must start with /Game/ or /Engine/.",
+        policy,
+        "high"
+      );
+      approved = decision.approved;
+      risk = decision.risk;
+      message = decision.message;
+    }
   }
 
   if (action.command === "scene.duplicateActors") {
@@ -8,6 +8,8 @@ import { z } from "zod";
 export const AllowedCommands = [
   "context.getSceneSummary",
   "context.getSelection",
+  "context.findNearestActors",
+  "context.findActorsInBox",
   "scene.createActor",
   "scene.modifyActor",
   "scene.deleteActor",
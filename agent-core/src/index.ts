@@ -4,11 +4,16 @@ import { z } from "zod";
 import { AgentService } from "./agent/agentService.js";
 import {
   type PlanOutput,
+  type SceneAck,
+  type SessionApproveRequest,
+  type SessionNextRequest,
+  type SessionResumeRequest,
   type TaskRequest,
   ChatCreateRequestSchema,
   ChatDetailAppendRequestSchema,
   ProviderNameSchema,
   ChatUpdateRequestSchema,
+  ContextQueryRequestSchema,
   SessionApproveRequestSchema,
   SessionNextRequestSchema,
   SessionResumeRequestSchema,
@@ -19,6 +24,7 @@ import { ChatStore } from "./chats/chatStore.js";
 import { resolveContextWithChatMemory } from "./chats/contextMemory.js";
 import { config } from "./config.js";
 import { CredentialStore } from "./credentials/credentialStore.js";
+import { EventChannel, EventChannelRequestError, routeChannelRequests, type EventClient } from "./events/eventChannel.js";
 import { ExecutionLayer } from "./executor/executionLayer.js";
 import { IntentLayer } from "./intent/intentLayer.js";
 import { SessionLogStore } from "./logs/sessionLogStore.js";
@@ -30,6 +36,7 @@ import { createProvider } from "./providers/createProvider.js";
 import { SessionStore } from "./sessions/sessionStore.js";
 import type { SessionDecision, SessionStatus } from "./sessions/sessionTypes.js";
 import { ValidationLayer } from "./validator/validationLayer.js";
+import { SceneSnapshotStore } from "./worldState/sceneSnapshotStore.js";
 import { WorldStateCollector } from "./worldState/worldStateCollector.js";
 
 const taskLogStore = new TaskLogStore(config.taskLogPath);
@@ -38,6 +45,7 @@ const chatStore = new ChatStore(config.dbPath);
 const modelPreferenceStore = new ModelPreferenceStore(config.dbPath);
 const credentialStore = new CredentialStore();
 const sessionStore = new SessionStore(config.policy);
+const sceneSnapshotStore = new SceneSnapshotStore();
 const agentService = new AgentService(
   new IntentLayer(),
   new PlanningLayer(new WorldStateCollector()),
@@ -289,6 +297,11 @@ function errorStatusCode(error: unknown): number {
   return 400;
 }
 
+function withSceneSummary(context: TaskRequest["context"], sceneAck: SceneAck | undefined): TaskRequest["context"] {
+  const scene = sceneAck && sceneAck.version > 0 ? sceneSnapshotStore.summarize(sceneAck.snapshotId) : undefined;
+  return scene ? { ...context, scene } : context;
+}
+
 function parseChatRoute(pathname: string): { chatId: string; isDetails: boolean } | undefined {
   const match = /^\/v1\/chats\/([^/]+)(?:\/(details))?$/.exec(pathname);
   if (!match) {
@@ -459,6 +472,7 @@ function appendUserPromptDetail(
     displayRole: "user",
     displayText: displayPrompt
   });
+  publishChat(chatId);
 }
 
 function appendAssistantDetail(
@@ -473,30 +487,178 @@ function appendAssistantDetail(
     displayRole: "assistant",
     displayText: text
   });
+  publishChat(chatId);
 }
 
 function shouldStoreSessionDecision(decision: SessionDecision): boolean {
   return decision.status === "completed" || decision.status === "failed";
 }
 
+async function readHealth(): Promise<Record<string, unknown>> {
+  try {
+    const provider = await resolveProvider();
+    return {
+      ok: true,
+      provider: provider.name,
+      model: provider.model,
+      adapter: provider.adapter,
+      providerConfigured: provider.hasApiKey
+    };
+  } catch (error) {
+    const message = error instanceof Error ? error.message : "Unknown error";
+    return { ok: false, error: message };
+  }
+}
+
+async function publishHealth(): Promise<void> {
+  if (eventChannel.clientCount === 0) {
+    return;
+  }
+  eventChannel.broadcast({ type: "health", ...(await readHealth()) });
+}
+
+function publishChat(chatId: string): void {
+  if (eventChannel.clientCount === 0) {
+    return;
+  }
+  try {
+    eventChannel.broadcast({ type: "chat.updated", chat: chatStore.getChat(chatId) });
+  } catch {
+    // The chat may have been deleted meanwhile; the delete is published separately.
+  }
+}
+
+type SessionStepRoute = "/v1/session/next" | "/v1/session/approve" | "/v1/session/resume";
+
+interface SessionStep<T extends { chatId?: string }> {
+  route: SessionStepRoute;
+  channelType: string;
+  schema: {
+    parse(data: unknown): T;
+    safeParse(data: unknown): { success: true; data: T } | { success: false };
+  };
+  run(request: T): SessionDecision;
+}
+
+const sessionSteps = [
+  {
+    route: "/v1/session/next",
+    channelType: "session.next",
+    schema: SessionNextRequestSchema,
+    run: (request) => agentService.next(request)
+  } satisfies SessionStep<SessionNextRequest>,
+  {
+    route: "/v1/session/approve",
+    channelType: "session.approve",
+    schema: SessionApproveRequestSchema,
+    run: (request) => agentService.approve(request)
+  } satisfies SessionStep<SessionApproveRequest>,
+  {
+    route: "/v1/session/resume",
+    channelType: "session.resume",
+    schema: SessionResumeRequestSchema,
+    run: (request) => agentService.resume(request)
+  } satisfies SessionStep<SessionResumeRequest>
+];
+
+function findSessionStep(pathname: string): SessionStep<{ chatId?: string }> | undefined {
+  return sessionSteps.find((step) => step.route === pathname) as SessionStep<{ chatId?: string }> | undefined;
+}
+
+// Shared by the HTTP routes and the event channel so both paths log and store chat details identically.
+async function runSessionStep<T extends { chatId?: string }>(
+  step: SessionStep<T>,
+  readRawBody: () => Promise<string>
+): Promise<{ statusCode: number; body: Record<string, unknown> }> {
+  const requestId = sessionLogStore.createRequestId();
+  const startedAt = Date.now();
+  let rawBody = "";
+
+  try {
+    rawBody = await readRawBody();
+    const parsed = step.schema.parse(JSON.parse(rawBody));
+    const decision = step.run(parsed);
+
+    if (parsed.chatId && shouldStoreSessionDecision(decision)) {
+      const assistant = buildSessionAssistantReply(decision);
+      appendAssistantDetail(parsed.chatId, step.route, assistant.summary, assistant.text, {
+        decision
+      });
+    }
+
+    try {
+      await sessionLogStore.appendSessionSuccess({
+        requestId,
+        route: step.route,
+        request: parsed as SessionNextRequest | SessionApproveRequest | SessionResumeRequest,
+        decision,
+        durationMs: Date.now() - startedAt
+      });
+    } catch (logError) {
+      // eslint-disable-next-line no-console
+      console.warn("Session log write failed:", logError);
+    }
+
+    return { statusCode: 200, body: { ok: true, requestId, decision } };
+  } catch (error) {
+    const message = error instanceof Error ? error.message : "Unknown error";
+    try {
+      const parsedBody = rawBody ? step.schema.safeParse(JSON.parse(rawBody)) : null;
+      if (parsedBody?.success && parsedBody.data.chatId) {
+        appendAssistantDetail(
+          parsedBody.data.chatId,
+          step.route,
+          "Request failed.",
+          `Request failed.\n${message}`,
+          { error: message }
+        );
+      }
+    } catch {
+      // ignore chat log write/read error
+    }
+
+    try {
+      await sessionLogStore.appendSessionError({
+        requestId,
+        route: step.route,
+        rawBody,
+        error: message,
+        durationMs: Date.now() - startedAt
+      });
+    } catch (logError) {
+      // eslint-disable-next-line no-console
+      console.warn("Session log write failed:", logError);
+    }
+
+    return { statusCode: errorStatusCode(error), body: { ok: false, requestId, error: message } };
+  }
+}
+
+// Editor channel: pushes health and chat changes, and carries session steps so the agent loop
+// does not pay for an HTTP request per action. Session messages use the HTTP request body plus
+// { type, id }; the reply is the HTTP response body plus { type: "session.decision", id }.
+// In the other direction, /v1/context/query sends { type: "context.query", id } to the editor.
+const eventChannel = new EventChannel("/v1/events", {
+  async onConnect(client: EventClient) {
+    client.send({ type: "health", ...(await readHealth()) });
+  },
+  onMessage: routeChannelRequests(
+    sessionSteps.map((step) => ({
+      type: step.channelType,
+      handle: async (rawText: string) =>
+        (await runSessionStep(step as SessionStep<{ chatId?: string }>, async () => rawText)).body
+    })),
+    "session.decision"
+  )
+});
+
 const server = http.createServer(async (req, res) => {
   const requestUrl = new URL(req.url ?? "/", `http://${config.host}:${config.port}`);
   const pathname = requestUrl.pathname;
 
   if (req.method === "GET" && pathname === "/health") {
-    try {
-      const provider = await resolveProvider();
-      return sendJson(res, 200, {
-        ok: true,
-        provider: provider.name,
-        model: provider.model,
-        adapter: provider.adapter,
-        providerConfigured: provider.hasApiKey
-      });
-    } catch (error) {
-      const message = error instanceof Error ? error.message : "Unknown error";
-      return sendJson(res, 500, { ok: false, error: message });
-    }
+    const health = await readHealth();
+    return sendJson(res, health.ok ? 200 : 500, health);
   }
 
   if (req.method === "GET" && pathname === "/v1/providers/status") {
@@ -560,6 +722,7 @@ const server = http.createServer(async (req, res) => {
       const rawBody = await readBody(req);
       const parsed = ChatCreateRequestSchema.parse(rawBody ? JSON.parse(rawBody) : {});
       const chat = chatStore.createChat(parsed.title);
+      eventChannel.broadcast({ type: "chat.updated", chat });
       return sendJson(res, 200, { ok: true, chat });
     } catch (error) {
       const message = error instanceof Error ? error.message : "Unknown error";
@@ -595,6 +758,7 @@ const server = http.createServer(async (req, res) => {
         const rawBody = await readBody(req);
         const parsed = ChatUpdateRequestSchema.parse(JSON.parse(rawBody));
         const chat = chatStore.updateChat(chatRoute.chatId, parsed);
+        eventChannel.broadcast({ type: "chat.updated", chat });
         return sendJson(res, 200, { ok: true, chat });
       } catch (error) {
         const message = error instanceof Error ? error.message : "Unknown error";
@@ -605,6 +769,7 @@ const server = http.createServer(async (req, res) => {
     if (req.method === "DELETE") {
       try {
         chatStore.deleteChat(chatRoute.chatId);
+        eventChannel.broadcast({ type: "chat.deleted", chatId: chatRoute.chatId });
         return sendJson(res, 200, { ok: true });
       } catch (error) {
         const message = error instanceof Error ? error.message : "Unknown error";
@@ -621,9 +786,17 @@ const server = http.createServer(async (req, res) => {
         requestedLimit !== undefined && Number.isFinite(requestedLimit) && Math.trunc(requestedLimit) > 0
           ? Math.trunc(requestedLimit)
           : undefined;
+      const sinceId = requestUrl.searchParams.get("since") || undefined;
+      const beforeId = requestUrl.searchParams.get("before") || undefined;
       try {
-        const details = chatStore.listDetails(chatRoute.chatId, normalizedLimit);
-        return sendJson(res, 200, { ok: true, count: details.length, details });
+        const page = chatStore.listDetailPage(chatRoute.chatId, { limit: normalizedLimit, sinceId, beforeId });
+        return sendJson(res, 200, {
+          ok: true,
+          count: page.details.length,
+          details: page.details,
+          hasMore: page.hasMore,
+          reset: page.reset
+        });
       } catch (error) {
         const message = error instanceof Error ? error.message : "Unknown error";
         return sendJson(res, errorStatusCode(error), { ok: false, error: message });
@@ -635,6 +808,7 @@ const server = http.createServer(async (req, res) => {
         const rawBody = await readBody(req);
         const parsed = ChatDetailAppendRequestSchema.parse(JSON.parse(rawBody));
         const detail = chatStore.appendDone(chatRoute.chatId, parsed.route, parsed.summary, parsed.payload);
+        publishChat(chatRoute.chatId);
         return sendJson(res, 200, { ok: true, detail });
       } catch (error) {
         const message = error instanceof Error ? error.message : "Unknown error";
@@ -648,6 +822,7 @@ const server = http.createServer(async (req, res) => {
       const rawBody = await readBody(req);
       const parsed = CredentialSetSchema.parse(JSON.parse(rawBody));
       await credentialStore.set(parsed.provider, parsed.apiKey);
+      void publishHealth();
       return sendJson(res, 200, { ok: true, provider: parsed.provider, configured: true });
     } catch (error) {
       const message = error instanceof Error ? error.message : "Unknown error";
@@ -660,6 +835,7 @@ const server = http.createServer(async (req, res) => {
       const rawBody = await readBody(req);
       const parsed = CredentialDeleteSchema.parse(JSON.parse(rawBody));
       await credentialStore.delete(parsed.provider);
+      void publishHealth();
       return sendJson(res, 200, { ok: true, provider: parsed.provider, configured: false });
     } catch (error) {
       const message = error instanceof Error ? error.message : "Unknown error";
@@ -772,8 +948,9 @@ const server = http.createServer(async (req, res) => {
 
     try {
       rawBody = await readBody(req);
-      const parsed = SessionStartRequestSchema.parse(JSON.parse(rawBody));
-      const resolvedContext = resolveContextWithChatMemory(parsed, chatStore);
+      const { sceneDelta, ...parsed } = SessionStartRequestSchema.parse(JSON.parse(rawBody));
+      const sceneAck = sceneDelta ? sceneSnapshotStore.apply(sceneDelta) : undefined;
+      const resolvedContext = withSceneSummary(resolveContextWithChatMemory(parsed, chatStore), sceneAck);
       const requestWithResolvedContext = {
         ...parsed,
         context: resolvedContext
@@ -827,7 +1004,7 @@ const server = http.createServer(async (req, res) => {
         console.warn("Session log write failed:", logError);
       }
 
-      return sendJson(res, 200, { ok: true, requestId, decision, assistantText: noActionAssistantText });
+      return sendJson(res, 200, { ok: true, requestId, decision, assistantText: noActionAssistantText, sceneAck });
     } catch (error) {
       const message = error instanceof Error ? error.message : "Unknown error";
       try {
@@ -862,198 +1039,21 @@ const server = http.createServer(async (req, res) => {
     }
   }
 
-  if (req.method === "POST" && pathname === "/v1/session/next") {
-    const requestId = sessionLogStore.createRequestId();
-    const startedAt = Date.now();
-    let rawBody = "";
-
-    try {
-      rawBody = await readBody(req);
-      const parsed = SessionNextRequestSchema.parse(JSON.parse(rawBody));
-      const decision = agentService.next(parsed);
-
-      if (parsed.chatId && shouldStoreSessionDecision(decision)) {
-        const assistant = buildSessionAssistantReply(decision);
-        appendAssistantDetail(parsed.chatId, "/v1/session/next", assistant.summary, assistant.text, {
-          decision
-        });
-      }
-
-      try {
-        await sessionLogStore.appendSessionSuccess({
-          requestId,
-          route: "/v1/session/next",
-          request: parsed,
-          decision,
-          durationMs: Date.now() - startedAt
-        });
-      } catch (logError) {
-        // eslint-disable-next-line no-console
-        console.warn("Session log write failed:", logError);
-      }
-
-      return sendJson(res, 200, { ok: true, requestId, decision });
-    } catch (error) {
-      const message = error instanceof Error ? error.message : "Unknown error";
-      try {
-        const parsedBody = rawBody ? SessionNextRequestSchema.safeParse(JSON.parse(rawBody)) : null;
-        if (parsedBody?.success && parsedBody.data.chatId) {
-          appendAssistantDetail(
-            parsedBody.data.chatId,
-            "/v1/session/next",
-            "Request failed.",
-            `Request failed.\n${message}`,
-            { error: message }
-          );
-        }
-      } catch {
-        // ignore chat log write/read error
-      }
-
-      try {
-        await sessionLogStore.appendSessionError({
-          requestId,
-          route: "/v1/session/next",
-          rawBody,
-          error: message,
-          durationMs: Date.now() - startedAt
-        });
-      } catch (logError) {
-        // eslint-disable-next-line no-console
-        console.warn("Session log write failed:", logError);
-      }
-
-      return sendJson(res, errorStatusCode(error), { ok: false, requestId, error: message });
-    }
-  }
-
-  if (req.method === "POST" && pathname === "/v1/session/approve") {
-    const requestId = sessionLogStore.createRequestId();
-    const startedAt = Date.now();
-    let rawBody = "";
-
-    try {
-      rawBody = await readBody(req);
-      const parsed = SessionApproveRequestSchema.parse(JSON.parse(rawBody));
-      const decision = agentService.approve(parsed);
-
-      if (parsed.chatId && shouldStoreSessionDecision(decision)) {
-        const assistant = buildSessionAssistantReply(decision);
-        appendAssistantDetail(parsed.chatId, "/v1/session/approve", assistant.summary, assistant.text, {
-          decision
-        });
-      }
-
-      try {
-        await sessionLogStore.appendSessionSuccess({
-          requestId,
-          route: "/v1/session/approve",
-          request: parsed,
-          decision,
-          durationMs: Date.now() - startedAt
-        });
-      } catch (logError) {
-        // eslint-disable-next-line no-console
-        console.warn("Session log write failed:", logError);
-      }
-
-      return sendJson(res, 200, { ok: true, requestId, decision });
-    } catch (error) {
-      const message = error instanceof Error ? error.message : "Unknown error";
-      try {
-        const parsedBody = rawBody ? SessionApproveRequestSchema.safeParse(JSON.parse(rawBody)) : null;
-        if (parsedBody?.success && parsedBody.data.chatId) {
-          appendAssistantDetail(
-            parsedBody.data.chatId,
-            "/v1/session/approve",
-            "Request failed.",
-            `Request failed.\n${message}`,
-            { error: message }
-          );
-        }
-      } catch {
-        // ignore chat log write/read error
-      }
-
-      try {
-        await sessionLogStore.appendSessionError({
-          requestId,
-          route: "/v1/session/approve",
-          rawBody,
-          error: message,
-          durationMs: Date.now() - startedAt
-        });
-      } catch (logError) {
-        // eslint-disable-next-line no-console
-        console.warn("Session log write failed:", logError);
-      }
-
-      return sendJson(res, errorStatusCode(error), { ok: false, requestId, error: message });
-    }
+  const sessionStep = req.method === "POST" ? findSessionStep(pathname) : undefined;
+  if (sessionStep) {
+    const result = await runSessionStep(sessionStep, () => readBody(req));
+    return sendJson(res, result.statusCode, result.body);
   }
 
-  if (req.method === "POST" && pathname === "/v1/session/resume") {
-    const requestId = sessionLogStore.createRequestId();
-    const startedAt = Date.now();
-    let rawBody = "";
-
+  if (req.method === "POST" && pathname === "/v1/context/query") {
     try {
-      rawBody = await readBody(req);
-      const parsed = SessionResumeRequestSchema.parse(JSON.parse(rawBody));
-      const decision = agentService.resume(parsed);
-
-      if (parsed.chatId && shouldStoreSessionDecision(decision)) {
-        const assistant = buildSessionAssistantReply(decision);
-        appendAssistantDetail(parsed.chatId, "/v1/session/resume", assistant.summary, assistant.text, {
-          decision
-        });
-      }
-
-      try {
-        await sessionLogStore.appendSessionSuccess({
-          requestId,
-          route: "/v1/session/resume",
-          request: parsed,
-          decision,
-          durationMs: Date.now() - startedAt
-        });
-      } catch (logError) {
-        // eslint-disable-next-line no-console
-        console.warn("Session log write failed:", logError);
-      }
-
-      return sendJson(res, 200, { ok: true, requestId, decision });
+      const query = ContextQueryRequestSchema.parse(JSON.parse(await readBody(req)));
+      const { type: _type, id: _id, ...reply } = await eventChannel.request("context.query", query, "context.result");
+      return sendJson(res, reply.ok === true ? 200 : 400, reply);
     } catch (error) {
       const message = error instanceof Error ? error.message : "Unknown error";
-      try {
-        const parsedBody = rawBody ? SessionResumeRequestSchema.safeParse(JSON.parse(rawBody)) : null;
-        if (parsedBody?.success && parsedBody.data.chatId) {
-          appendAssistantDetail(
-            parsedBody.data.chatId,
-            "/v1/session/resume",
-            "Request failed.",
-            `Request failed.\n${message}`,
-            { error: message }
-          );
-        }
-      } catch {
-        // ignore chat log write/read error
-      }
-
-      try {
-        await sessionLogStore.appendSessionError({
-          requestId,
-          route: "/v1/session/resume",
-          rawBody,
-          error: message,
-          durationMs: Date.now() - startedAt
-        });
-      } catch (logError) {
-        // eslint-disable-next-line no-console
-        console.warn("Session log write failed:", logError);
-      }
-
-      return sendJson(res, errorStatusCode(error), { ok: false, requestId, error: message });
+      const statusCode = error instanceof EventChannelRequestError ? error.statusCode : 400;
+      return sendJson(res, statusCode, { ok: false, error: message });
     }
   }
 
@@ -1065,14 +1065,15 @@ const server = http.createServer(async (req, res) => {
 
     try {
       rawBody = await readBody(req);
-      const parsed = TaskRequestSchema.parse(JSON.parse(rawBody));
+      const { sceneDelta, ...parsed } = TaskRequestSchema.parse(JSON.parse(rawBody));
+      const sceneAck = sceneDelta ? sceneSnapshotStore.apply(sceneDelta) : undefined;
       const selectedProvider = parsed.provider ?? config.provider;
       const selectedModel = await resolveRequestedModel(selectedProvider, parsed.model);
       if (!selectedModel) {
         return sendJson(res, 400, { ok: false, error: "No model selected. Select a model in Settings." });
       }
       provider = await resolveProvider(selectedProvider, selectedModel);
-      const resolvedContext = resolveContextWithChatMemory(parsed, chatStore);
+      const resolvedContext = withSceneSummary(resolveContextWithChatMemory(parsed, chatStore), sceneAck);
       const requestWithResolvedContext = {
         ...parsed,
         context: resolvedContext,
@@ -1116,7 +1117,7 @@ const server = http.createServer(async (req, res) => {
         console.warn("Task log write failed:", logError);
       }
 
-      return sendJson(res, 200, { ok: true, requestId, plan, assistantText: noActionAssistantText });
+      return sendJson(res, 200, { ok: true, requestId, plan, assistantText: noActionAssistantText, sceneAck });
     } catch (error) {
       const message = error instanceof Error ? error.message : "Unknown error";
       try {
@@ -1156,6 +1157,13 @@ const server = http.createServer(async (req, res) => {
   return sendJson(res, 404, { ok: false, error: "Not found" });
 });
 
+eventChannel.attach(server);
+
+// The editor reuses one keep-alive connection across agent steps. Node's 5s idle default would
+// close it while the editor is executing a step, forcing a reconnect on the next request.
+server.keepAliveTimeout = 120_000;
+server.headersTimeout = 125_000;
+
 server.listen(config.port, config.host, () => {
   // eslint-disable-next-line no-console
   console.log(`Agent Core listening on http://${config.host}:${config.port}`);
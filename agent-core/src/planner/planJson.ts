@@ -1,7 +1,10 @@
 import { PlanOutputSchema, type PlanOutput, AllowedCommands } from "../contracts.js";
 import type { PlanInput } from "../providers/types.js";
 
-const PlanningAllowedCommands = AllowedCommands.filter((command) => !command.startsWith("session."));
+// context.* commands are read-only queries sent to the editor through POST /v1/context/query, not plan actions.
+const PlanningAllowedCommands = AllowedCommands.filter(
+  (command) => !command.startsWith("session.") && !command.startsWith("context.")
+);
 
 function stripCodeFence(raw: string): string {
   const trimmed = raw.trim();
@@ -140,7 +143,7 @@ export function buildPlanPrompt(input: PlanInput): string {
     "You are a planner for Unreal Editor actions.",
     "Return ONLY one valid JSON object. No markdown. No comments. No extra text.",
     "Use normalizedIntent as the main control input for planning decisions.",
-    "Use worldState to ground decisions in current scene state (selection, environment, lighting, materials, performance, assets).",
+    "Use worldState to ground decisions in current scene state (selection, nearby actors, environment, lighting, materials, performance, assets).",
     "Prioritize normalizedIntent.constraints over other heuristics. Do not produce actions that violate constraints.",
     "Before finalizing actions, verify the plan against normalizedIntent.successCriteria and update steps/actions to satisfy them.",
     "If constraints and successCriteria conflict or are not satisfiable from context, return actions: [] and explain the blocker in steps.",
@@ -307,7 +310,7 @@ export function buildPlanPrompt(input: PlanInput): string {
     "- stopConditions must include at least: all_checks_passed, max_iterations, user_denied.",
     "- actions can be empty [] if no executable command is found.",
     "- scene.modifyActor: target must be 'selection' or 'byName'; include actorNames when using 'byName'; include deltaLocation and/or deltaRotation and/or deltaScale and/or scale.",
-    "- scene.createActor: include actorClass; location/rotation optional; count must be integer >= 1.",
+    "- scene.createActor: include actorClass; location/rotation optional; count must be integer >= 1. For many copies of one mesh, set instanced=true and meshPath to pack them into one instanced mesh actor.",
     "- scene.deleteActor: target must be 'selection' or 'byName'; include actorNames when using 'byName'.",
     "- scene.modifyComponent: target must be 'selection' or 'byName'; include actorNames when using 'byName'; include componentName; include a transform or visibility.",
     "- scene.setComponentMaterial: include componentName + materialPath; optional materialSlot.",
@@ -315,7 +318,7 @@ export function buildPlanPrompt(input: PlanInput): string {
     "- scene.addActorTag: target must be 'selection' or 'byName'; include actorNames when using 'byName'; include tag.",
     "- scene.setActorFolder: include folderPath (can be empty to clear).",
     "- scene.addActorLabelPrefix: include prefix.",
-    "- scene.duplicateActors: include count (1-20). Optional offset.",
+    "- scene.duplicateActors: include count (1-20). Optional offset. Optional instanced=true packs copies of static mesh actors into instanced mesh actors.",
     "- session transaction begin/commit/rollback are internal. Do not include any session.* action.",
     "- risk must be low|medium|high.",
     "- Use low for small transform/create, medium for large create (many actors), high for delete.",
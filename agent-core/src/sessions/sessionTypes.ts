@@ -9,6 +9,7 @@ export interface SessionAction {
   state: ActionState;
   attempts: number;
   lastMessage?: string;
+  lastResult?: SessionResult;
 }
 
 export interface SessionData {
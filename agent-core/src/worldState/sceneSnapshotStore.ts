@@ -0,0 +1,79 @@
+import type { SceneAck, SceneActorRecord, SceneDelta } from "../contracts.js";
+
+const DEFAULT_MAX_SNAPSHOTS = 8;
+
+export interface SceneSnapshot {
+  snapshotId: string;
+  version: number;
+  actors: Map<string, SceneActorRecord>;
+}
+
+export interface SceneSnapshotSummary {
+  snapshotId: string;
+  version: number;
+  actorCount: number;
+}
+
+// Mirrors the editor's versioned actor snapshot so requests only need to carry what changed.
+// Snapshots are kept in least-recently-used order and the oldest ones are dropped past the limit.
+export class SceneSnapshotStore {
+  private readonly snapshots = new Map<string, SceneSnapshot>();
+
+  constructor(private readonly maxSnapshots = DEFAULT_MAX_SNAPSHOTS) {}
+
+  apply(delta: SceneDelta): SceneAck {
+    if (delta.full) {
+      const snapshot: SceneSnapshot = {
+        snapshotId: delta.snapshotId,
+        version: delta.version,
+        actors: new Map(delta.upserts.map((record) => [record.name, record]))
+      };
+      this.touch(snapshot);
+      return { snapshotId: snapshot.snapshotId, version: snapshot.version };
+    }
+
+    const snapshot = this.snapshots.get(delta.snapshotId);
+    if (!snapshot || delta.baseVersion > snapshot.version) {
+      // The base this delta was built on never reached us; version 0 asks the editor for a full snapshot.
+      return { snapshotId: delta.snapshotId, version: 0 };
+    }
+
+    // Deltas carry every change after their base, so one built on an older base still lands correctly.
+    if (delta.version >= snapshot.version) {
+      for (const name of delta.removed) {
+        snapshot.actors.delete(name);
+      }
+      for (const record of delta.upserts) {
+        snapshot.actors.set(record.name, record);
+      }
+      snapshot.version = delta.version;
+    }
+
+    this.touch(snapshot);
+    return { snapshotId: snapshot.snapshotId, version: snapshot.version };
+  }
+
+  get(snapshotId: string): SceneSnapshot | undefined {
+    return this.snapshots.get(snapshotId);
+  }
+
+  summarize(snapshotId: string): SceneSnapshotSummary | undefined {
+    const snapshot = this.snapshots.get(snapshotId);
+    if (!snapshot) {
+      return undefined;
+    }
+    return { snapshotId: snapshot.snapshotId, version: snapshot.version, actorCount: snapshot.actors.size };
+  }
+
+  private touch(snapshot: SceneSnapshot): void {
+    this.snapshots.delete(snapshot.snapshotId);
+    this.snapshots.set(snapshot.snapshotId, snapshot);
+    while (this.snapshots.size > this.maxSnapshots) {
+      const oldest = this.snapshots.keys().next().value;
+      if (oldest === undefined) {
+        break;
+      }
+      this.snapshots.delete(oldest);
+    }
+  }
+}
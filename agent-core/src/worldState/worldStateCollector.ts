@@ -6,6 +6,7 @@ export interface WorldState {
     count: number;
     actorNames: string[];
   };
+  nearby: Array<{ name: string; class?: string; distance?: number }>;
   environment: {
     mapName?: string;
     levelName?: string;
@@ -36,6 +37,11 @@ export interface WorldState {
     materialPaths: string[];
     meshPaths: string[];
   };
+  scene?: {
+    actorCount: number;
+    version: number;
+    topClasses: Array<{ class: string; count: number }>;
+  };
   notes: string[];
 }
 
@@ -119,6 +125,39 @@ function readSelectionNames(source: Record<string, unknown>): string[] {
   return Array.from(new Set([...names, ...selectionNames]));
 }
 
+function readClassCounts(source: Record<string, unknown>, key: string): Array<{ class: string; count: number }> {
+  const value = source[key];
+  if (!Array.isArray(value)) {
+    return [];
+  }
+  const out: Array<{ class: string; count: number }> = [];
+  for (const item of value) {
+    const record = asRecord(item);
+    const className = readString(record, "class");
+    const count = readNumber(record, "count");
+    if (className && count !== undefined) {
+      out.push({ class: className, count });
+    }
+  }
+  return out;
+}
+
+function readNearbyActors(source: Record<string, unknown>): WorldState["nearby"] {
+  const value = source.nearbyActors;
+  if (!Array.isArray(value)) {
+    return [];
+  }
+  const out: WorldState["nearby"] = [];
+  for (const item of value) {
+    const record = asRecord(item);
+    const name = readString(record, "name");
+    if (name) {
+      out.push({ name, class: readString(record, "class"), distance: readNumber(record, "distance") });
+    }
+  }
+  return out;
+}
+
 function readQualityTier(source: Record<string, unknown>, key: string): WorldState["performance"]["qualityTier"] {
   const raw = readString(source, key)?.toLowerCase();
   if (raw === "low" || raw === "medium" || raw === "high" || raw === "cinematic") {
@@ -145,6 +184,7 @@ export class WorldStateCollector {
         count: selection.length,
         actorNames: selection
       },
+      nearby: readNearbyActors(context),
       environment: {
         mapName: readString(environment, "mapName") ?? readString(context, "mapName"),
         levelName: readString(environment, "levelName") ?? readString(context, "levelName"),
@@ -178,6 +218,17 @@ export class WorldStateCollector {
       notes: []
     };
 
+    const scene = asRecord(context.scene);
+    const sceneSummary = asRecord(context.sceneSummary);
+    const sceneActorCount = readNumber(scene, "actorCount") ?? readNumber(sceneSummary, "actorCount");
+    if (sceneActorCount !== undefined) {
+      worldState.scene = {
+        actorCount: sceneActorCount,
+        version: readNumber(scene, "version") ?? 0,
+        topClasses: readClassCounts(sceneSummary, "topClasses")
+      };
+    }
+
     if (!worldState.environment.mapName) {
       worldState.environment.mapName = readString(level, "mapName");
     }
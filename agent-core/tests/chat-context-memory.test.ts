@@ -199,3 +199,47 @@ test("ChatStore.listDetails returns latest entries when limit is smaller than hi
     rmSync(dbPath, { force: true });
   }
 });
+
+test("ChatStore.listDetailPage pages by since and before cursors", () => {
+  const dbPath = makeDbPath();
+  const store = new ChatStore(dbPath);
+
+  try {
+    const chat = store.createChat("history paging");
+    for (let index = 0; index < 5; index += 1) {
+      store.appendAsked(chat.id, "/v1/task/plan", `ask ${index + 1}`);
+    }
+
+    const latest = store.listDetailPage(chat.id, { limit: 2 });
+    assert.deepEqual(
+      latest.details.map((entry) => entry.summary),
+      ["ask 4", "ask 5"]
+    );
+    assert.equal(latest.hasMore, true);
+    assert.equal(latest.reset, false);
+
+    const older = store.listDetailPage(chat.id, { limit: 2, beforeId: latest.details[0]?.id });
+    assert.deepEqual(
+      older.details.map((entry) => entry.summary),
+      ["ask 2", "ask 3"]
+    );
+    assert.equal(older.hasMore, true);
+
+    store.appendAsked(chat.id, "/v1/task/plan", "ask 6");
+    const delta = store.listDetailPage(chat.id, { limit: 2, sinceId: latest.details[1]?.id });
+    assert.deepEqual(
+      delta.details.map((entry) => entry.summary),
+      ["ask 6"]
+    );
+    assert.equal(delta.reset, false);
+
+    const unknown = store.listDetailPage(chat.id, { limit: 2, sinceId: "missing" });
+    assert.equal(unknown.reset, true);
+    assert.deepEqual(
+      unknown.details.map((entry) => entry.summary),
+      ["ask 5", "ask 6"]
+    );
+  } finally {
+    rmSync(dbPath, { force: true });
+  }
+});
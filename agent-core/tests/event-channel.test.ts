@@ -0,0 +1,478 @@
+import test from "node:test";
+import assert from "node:assert/strict";
+import { createHash, randomBytes } from "node:crypto";
+import http from "node:http";
+import net from "node:net";
+
+import type { PlanOutput, SessionStartRequest } from "../src/contracts.js";
+import { SessionNextRequestSchema } from "../src/contracts.js";
+import {
+  EVENT_CHANNEL_PROTOCOL,
+  EventChannel,
+  EventChannelRequestError,
+  routeChannelRequests,
+  type EventChannelHandlers
+} from "../src/events/eventChannel.js";
+import { SessionStore } from "../src/sessions/sessionStore.js";
+
+const WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+interface ServerFrame {
+  fin: boolean;
+  opcode: number;
+  payload: Buffer;
+}
+
+// Raw client so tests control every header and frame bit.
+class TestClient {
+  public response = "";
+  public key = "";
+  private buffer = Buffer.alloc(0);
+  private upgraded = false;
+  private readonly frames: ServerFrame[] = [];
+  private readonly waiters: Array<() => void> = [];
+  private ended = false;
+
+  private constructor(private readonly socket: net.Socket) {
+    socket.on("data", (chunk: Buffer) => this.receive(chunk));
+    socket.on("close", () => {
+      this.ended = true;
+      this.wake();
+    });
+  }
+
+  public static async connect(port: number, headers: Record<string, string> = {}): Promise<TestClient> {
+    const socket = net.connect(port, "127.0.0.1");
+    await new Promise<void>((resolve, reject) => {
+      socket.once("connect", resolve);
+      socket.once("error", reject);
+    });
+    const client = new TestClient(socket);
+    client.key = randomBytes(16).toString("base64");
+    const lines = [
+      "GET /v1/events HTTP/1.1",
+      `Host: 127.0.0.1:${port}`,
+      "Upgrade: websocket",
+      "Connection: Upgrade",
+      `Sec-WebSocket-Key: ${client.key}`,
+      "Sec-WebSocket-Version: 13",
+      ...Object.entries(headers).map(([name, value]) => `${name}: ${value}`)
+    ];
+    socket.write(`${lines.join("\r\n")}\r\n\r\n`);
+    await client.waitFor(() => client.upgraded || client.ended);
+    return client;
+  }
+
+  public get status(): number {
+    return Number(this.response.split(" ")[1]);
+  }
+
+  public header(name: string): string | undefined {
+    const prefix = `${name.toLowerCase()}:`;
+    const line = this.response.split("\r\n").find((candidate) => candidate.toLowerCase().startsWith(prefix));
+    return line?.slice(prefix.length).trim();
+  }
+
+  public sendFrame(opcode: number, payload: Buffer, fin = true): void {
+    const mask = randomBytes(4);
+    let header: Buffer;
+    if (payload.length < 126) {
+      header = Buffer.alloc(2);
+      header[1] = 0x80 | payload.length;
+    } else if (payload.length <= 0xffff) {
+      header = Buffer.alloc(4);
+      header[1] = 0x80 | 126;
+      header.writeUInt16BE(payload.length, 2);
+    } else {
+      header = Buffer.alloc(10);
+      header[1] = 0x80 | 127;
+      header.writeUInt32BE(payload.length, 6);
+    }
+    header[0] = (fin ? 0x80 : 0) | opcode;
+    const masked = Buffer.from(payload);
+    for (let index = 0; index < masked.length; index += 1) {
+      masked[index] ^= mask[index & 3];
+    }
+    this.socket.write(Buffer.concat([header, mask, masked]));
+  }
+
+  public sendUnmaskedText(text: string): void {
+    const payload = Buffer.from(text, "utf8");
+    this.socket.write(Buffer.concat([Buffer.from([0x81, payload.length]), payload]));
+  }
+
+  public sendJson(message: unknown): void {
+    this.sendFrame(0x1, Buffer.from(JSON.stringify(message), "utf8"));
+  }
+
+  public async nextFrame(): Promise<ServerFrame> {
+    await this.waitFor(() => this.frames.length > 0 || this.ended);
+    const frame = this.frames.shift();
+    assert.ok(frame, "Connection closed before a frame arrived.");
+    return frame;
+  }
+
+  // Skips frames until a text message of the given type arrives.
+  public async nextMessage(type: string): Promise<Record<string, unknown>> {
+    for (;;) {
+      const frame = await this.nextFrame();
+      if (frame.opcode !== 0x1) {
+        continue;
+      }
+      const message = JSON.parse(frame.payload.toString("utf8")) as Record<string, unknown>;
+      if (message.type === type) {
+        return message;
+      }
+    }
+  }
+
+  public async closed(): Promise<void> {
+    await this.waitFor(() => this.ended);
+  }
+
+  public destroy(): void {
+    this.socket.destroy();
+  }
+
+  private receive(chunk: Buffer): void {
+    this.buffer = Buffer.concat([this.buffer, chunk]);
+    if (!this.upgraded) {
+      const end = this.buffer.indexOf("\r\n\r\n");
+      if (end < 0) {
+        return;
+      }
+      this.response = this.buffer.subarray(0, end).toString("latin1");
+      this.buffer = this.buffer.subarray(end + 4);
+      this.upgraded = this.status === 101;
+    }
+    for (;;) {
+      if (this.buffer.length < 2) {
+        break;
+      }
+      let length = this.buffer[1] & 0x7f;
+      let offset = 2;
+      if (length === 126) {
+        length = this.buffer.readUInt16BE(2);
+        offset = 4;
+      } else if (length === 127) {
+        length = this.buffer.readUInt32BE(6);
+        offset = 10;
+      }
+      if (this.buffer.length < offset + length) {
+        break;
+      }
+      this.frames.push({
+        fin: (this.buffer[0] & 0x80) !== 0,
+        opcode: this.buffer[0] & 0x0f,
+        payload: Buffer.from(this.buffer.subarray(offset, offset + length))
+      });
+      this.buffer = this.buffer.subarray(offset + length);
+    }
+    this.wake();
+  }
+
+  private wake(): void {
+    for (const waiter of this.waiters.splice(0)) {
+      waiter();
+    }
+  }
+
+  private async waitFor(ready: () => boolean): Promise<void> {
+    while (!ready()) {
+      await new Promise<void>((resolve) => this.waiters.push(resolve));
+    }
+  }
+}
+
+async function startChannel(
+  handlers: Partial<EventChannelHandlers> = {},
+  allowedOrigins: string[] = []
+): Promise<{ channel: EventChannel; port: number; stop(): Promise<void> }> {
+  const channel = new EventChannel(
+    "/v1/events",
+    {
+      onConnect: handlers.onConnect ?? ((client) => client.send({ type: "health", ok: true })),
+      onMessage: handlers.onMessage ?? ((client, message) => client.send({ type: "echo", message }))
+    },
+    { allowedOrigins }
+  );
+  const server = http.createServer((_req, res) => {
+    res.statusCode = 404;
+    res.end();
+  });
+  channel.attach(server);
+  await new Promise<void>((resolve) => server.listen(0, "127.0.0.1", resolve));
+  const address = server.address();
+  assert.ok(address && typeof address === "object");
+  return {
+    channel,
+    port: address.port,
+    stop: () =>
+      new Promise<void>((resolve) => {
+        server.closeAllConnections();
+        server.close(() => resolve());
+      })
+  };
+}
+
+function makePlan(): PlanOutput {
+  return {
+    summary: "Test plan",
+    steps: ["Move selection"],
+    actions: [
+      {
+        command: "scene.modifyActor",
+        params: { target: "selection", deltaLocation: { x: 1, y: 0, z: 0 } },
+        risk: "low"
+      }
+    ],
+    goal: { id: "goal_primary", description: "Execute test actions.", priority: "medium" },
+    subgoals: [],
+    checks: [],
+    stopConditions: [{ type: "all_checks_passed" }, { type: "max_iterations", value: 1 }, { type: "user_denied" }]
+  };
+}
+
+function makeStartRequest(): SessionStartRequest {
+  return { prompt: "Test prompt", mode: "agent", context: {}, maxRetries: 2 };
+}
+
+test("Event channel: handshake answers the key and pushes the connect message", async () => {
+  const server = await startChannel();
+  try {
+    const client = await TestClient.connect(server.port, { "Sec-WebSocket-Protocol": `other, ${EVENT_CHANNEL_PROTOCOL}` });
+    assert.equal(client.status, 101);
+    const expected = createHash("sha1").update(client.key + WEBSOCKET_GUID).digest("base64");
+    assert.equal(client.header("Sec-WebSocket-Accept"), expected);
+    assert.equal(client.header("Sec-WebSocket-Protocol"), EVENT_CHANNEL_PROTOCOL);
+
+    const health = await client.nextMessage("health");
+    assert.equal(health.ok, true);
+    assert.equal(server.channel.clientCount, 1);
+    client.destroy();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: unknown subprotocols are never echoed", async () => {
+  const server = await startChannel();
+  try {
+    const client = await TestClient.connect(server.port, { "Sec-WebSocket-Protocol": "chat, superchat" });
+    assert.equal(client.status, 101);
+    assert.equal(client.header("Sec-WebSocket-Protocol"), undefined);
+    client.destroy();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: browser origins are rejected unless allowed", async () => {
+  const server = await startChannel({}, ["http://localhost:3000"]);
+  try {
+    const page = await TestClient.connect(server.port, { Origin: "https://example.com" });
+    assert.equal(page.status, 403);
+    await page.closed();
+
+    const sandboxed = await TestClient.connect(server.port, { Origin: "null" });
+    assert.equal(sandboxed.status, 403);
+    await sandboxed.closed();
+
+    const allowed = await TestClient.connect(server.port, { Origin: "http://localhost:3000" });
+    assert.equal(allowed.status, 101);
+    allowed.destroy();
+
+    // Native WebSocket clients send a bare host, or no Origin at all.
+    const native = await TestClient.connect(server.port, { Origin: "127.0.0.1" });
+    assert.equal(native.status, 101);
+    native.destroy();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: unmasked client frames close the connection", async () => {
+  const server = await startChannel();
+  try {
+    const client = await TestClient.connect(server.port);
+    await client.nextMessage("health");
+    client.sendUnmaskedText("{}");
+    const close = await client.nextFrame();
+    assert.equal(close.opcode, 0x8);
+    assert.equal(close.payload.readUInt16BE(0), 1002);
+    await client.closed();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: fragmented and large messages are reassembled", async () => {
+  const server = await startChannel();
+  try {
+    const client = await TestClient.connect(server.port);
+    await client.nextMessage("health");
+
+    const text = Buffer.from(JSON.stringify({ type: "fragmented", value: "x".repeat(70_000) }), "utf8");
+    client.sendFrame(0x1, text.subarray(0, 10), false);
+    client.sendFrame(0x9, Buffer.from("mid"));
+    client.sendFrame(0x0, text.subarray(10, 40_000), false);
+    client.sendFrame(0x0, text.subarray(40_000), true);
+
+    const pong = await client.nextFrame();
+    assert.equal(pong.opcode, 0xa);
+    assert.equal(pong.payload.toString("utf8"), "mid");
+
+    const echo = await client.nextMessage("echo");
+    const message = echo.message as { type: string; value: string };
+    assert.equal(message.type, "fragmented");
+    assert.equal(message.value.length, 70_000);
+    client.destroy();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: continuation without a started message is a protocol error", async () => {
+  const server = await startChannel();
+  try {
+    const client = await TestClient.connect(server.port);
+    await client.nextMessage("health");
+    client.sendFrame(0x0, Buffer.from("{}"));
+    const close = await client.nextFrame();
+    assert.equal(close.opcode, 0x8);
+    assert.equal(close.payload.readUInt16BE(0), 1002);
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: oversized or fragmented control frames are rejected", async () => {
+  const server = await startChannel();
+  try {
+    const oversized = await TestClient.connect(server.port);
+    await oversized.nextMessage("health");
+    oversized.sendFrame(0x9, Buffer.alloc(126));
+    const first = await oversized.nextFrame();
+    assert.equal(first.opcode, 0x8);
+    assert.equal(first.payload.readUInt16BE(0), 1002);
+    await oversized.closed();
+
+    const fragmented = await TestClient.connect(server.port);
+    await fragmented.nextMessage("health");
+    fragmented.sendFrame(0x9, Buffer.from("ping"), false);
+    const second = await fragmented.nextFrame();
+    assert.equal(second.opcode, 0x8);
+    assert.equal(second.payload.readUInt16BE(0), 1002);
+    await fragmented.closed();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: ping is answered and close is echoed", async () => {
+  const server = await startChannel();
+  try {
+    const client = await TestClient.connect(server.port);
+    await client.nextMessage("health");
+
+    client.sendFrame(0x9, Buffer.from("hello"));
+    const pong = await client.nextFrame();
+    assert.equal(pong.opcode, 0xa);
+    assert.equal(pong.payload.toString("utf8"), "hello");
+
+    const code = Buffer.alloc(2);
+    code.writeUInt16BE(1000, 0);
+    client.sendFrame(0x8, code);
+    const close = await client.nextFrame();
+    assert.equal(close.opcode, 0x8);
+    assert.equal(close.payload.readUInt16BE(0), 1000);
+    await client.closed();
+    assert.equal(server.channel.clientCount, 0);
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: session messages are answered with the decision and request id", async () => {
+  const store = new SessionStore();
+  const started = store.create(makeStartRequest(), makePlan());
+  const server = await startChannel({
+    onMessage: routeChannelRequests(
+      [
+        {
+          type: "session.next",
+          handle: async (rawText) => {
+            const request = SessionNextRequestSchema.parse(JSON.parse(rawText));
+            return { ok: true, decision: store.nextRequest(request) };
+          }
+        }
+      ],
+      "session.decision"
+    )
+  });
+  try {
+    const client = await TestClient.connect(server.port);
+    await client.nextMessage("health");
+
+    client.sendJson({
+      type: "session.next",
+      id: 7,
+      sessionId: started.sessionId,
+      result: { actionIndex: 0, ok: true, message: "moved" }
+    });
+    const reply = await client.nextMessage("session.decision");
+    assert.equal(reply.id, 7);
+    assert.equal(reply.ok, true);
+    const decision = reply.decision as { sessionId: string; status: string };
+    assert.equal(decision.sessionId, started.sessionId);
+    assert.notEqual(decision.status, "ready_to_execute");
+
+    client.sendJson({ type: "session.unknown", id: 8 });
+    const error = await client.nextMessage("error");
+    assert.equal(error.id, 8);
+
+    client.sendFrame(0x1, Buffer.from("not json"));
+    const invalid = await client.nextMessage("error");
+    assert.equal(invalid.error, "Message is not valid JSON.");
+    client.destroy();
+  } finally {
+    await server.stop();
+  }
+});
+
+test("Event channel: requests to the editor resolve with the matching reply only", async () => {
+  const server = await startChannel();
+  try {
+    await assert.rejects(
+      server.channel.request("context.query", { command: "context.findActorsInBox" }, "context.result"),
+      (error: unknown) => error instanceof EventChannelRequestError && error.statusCode === 503
+    );
+
+    const client = await TestClient.connect(server.port);
+    await client.nextMessage("health");
+
+    const pending = server.channel.request("context.query", { command: "context.findActorsInBox" }, "context.result");
+    const query = await client.nextMessage("context.query");
+    assert.equal(query.command, "context.findActorsInBox");
+
+    // The editor's own request with the same id is routed to the message handler, not taken as the reply.
+    client.sendJson({ type: "session.next", id: query.id });
+    const echo = await client.nextMessage("echo");
+    assert.equal((echo.message as { type: string }).type, "session.next");
+
+    client.sendJson({ type: "context.result", id: query.id, ok: true, actors: [] });
+    const reply = await pending;
+    assert.equal(reply.ok, true);
+    assert.deepEqual(reply.actors, []);
+
+    const timedOut = server.channel.request("context.query", {}, "context.result", 20);
+    await assert.rejects(timedOut, (error: unknown) => error instanceof EventChannelRequestError && error.statusCode === 504);
+
+    const dropped = server.channel.request("context.query", {}, "context.result");
+    await client.nextMessage("context.query");
+    client.destroy();
+    await assert.rejects(dropped, (error: unknown) => error instanceof EventChannelRequestError && error.statusCode === 503);
+  } finally {
+    await server.stop();
+  }
+});
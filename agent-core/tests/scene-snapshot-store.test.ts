@@ -0,0 +1,86 @@
+import assert from "node:assert/strict";
+import { randomUUID } from "node:crypto";
+import test from "node:test";
+
+import type { SceneActorRecord, SceneDelta } from "../src/contracts.js";
+import { SceneSnapshotStore } from "../src/worldState/sceneSnapshotStore.js";
+
+function makeRecord(name: string, x = 0): SceneActorRecord {
+  return {
+    name,
+    label: name,
+    class: "StaticMeshActor",
+    location: { x, y: 0, z: 0 },
+    rotation: { pitch: 0, yaw: 0, roll: 0 },
+    scale: { x: 1, y: 1, z: 1 }
+  };
+}
+
+function makeDelta(snapshotId: string, overrides: Partial<SceneDelta>): SceneDelta {
+  return {
+    snapshotId,
+    version: 1,
+    baseVersion: 0,
+    full: false,
+    upserts: [],
+    removed: [],
+    ...overrides
+  };
+}
+
+test("applies deltas on top of a full snapshot", () => {
+  const store = new SceneSnapshotStore();
+  const snapshotId = randomUUID();
+
+  assert.deepEqual(
+    store.apply(makeDelta(snapshotId, { full: true, version: 1, upserts: [makeRecord("Cube_1"), makeRecord("Cube_2")] })),
+    { snapshotId, version: 1 }
+  );
+
+  const ack = store.apply(
+    makeDelta(snapshotId, { version: 2, baseVersion: 1, upserts: [makeRecord("Cube_1", 50)], removed: ["Cube_2"] })
+  );
+  assert.deepEqual(ack, { snapshotId, version: 2 });
+
+  const snapshot = store.get(snapshotId);
+  assert.equal(snapshot?.actors.size, 1);
+  assert.equal(snapshot?.actors.get("Cube_1")?.location.x, 50);
+});
+
+test("requests a full snapshot when the delta base is unknown", () => {
+  const store = new SceneSnapshotStore();
+  const snapshotId = randomUUID();
+
+  assert.deepEqual(store.apply(makeDelta(snapshotId, { version: 3, baseVersion: 2 })), { snapshotId, version: 0 });
+
+  store.apply(makeDelta(snapshotId, { full: true, version: 1, upserts: [makeRecord("Cube_1")] }));
+  assert.deepEqual(store.apply(makeDelta(snapshotId, { version: 5, baseVersion: 4 })), { snapshotId, version: 0 });
+});
+
+test("keeps the newer version when a stale delta arrives late", () => {
+  const store = new SceneSnapshotStore();
+  const snapshotId = randomUUID();
+
+  store.apply(makeDelta(snapshotId, { full: true, version: 1, upserts: [makeRecord("Cube_1")] }));
+  store.apply(makeDelta(snapshotId, { version: 3, baseVersion: 1, upserts: [makeRecord("Cube_1", 30)] }));
+
+  const ack = store.apply(makeDelta(snapshotId, { version: 2, baseVersion: 1, upserts: [makeRecord("Cube_1", 20)] }));
+  assert.deepEqual(ack, { snapshotId, version: 3 });
+  assert.equal(store.get(snapshotId)?.actors.get("Cube_1")?.location.x, 30);
+});
+
+test("drops the least recently used snapshot past the limit", () => {
+  const store = new SceneSnapshotStore(2);
+  const first = randomUUID();
+  const second = randomUUID();
+  const third = randomUUID();
+
+  store.apply(makeDelta(first, { full: true }));
+  store.apply(makeDelta(second, { full: true }));
+  store.apply(makeDelta(first, { version: 1, baseVersion: 1 }));
+  store.apply(makeDelta(third, { full: true }));
+
+  assert.ok(store.get(first));
+  assert.equal(store.get(second), undefined);
+  assert.ok(store.get(third));
+});
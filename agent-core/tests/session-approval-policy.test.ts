@@ -1,6 +1,7 @@
 import test from "node:test";
 import assert from "node:assert/strict";
 
+import { SceneCreateActorActionSchema } from "../src/contracts.js";
 import type { PlanAction, PlanOutput, SessionStartRequest } from "../src/contracts.js";
 import { SessionStore } from "../src/sessions/sessionStore.js";
 
@@ -110,3 +111,49 @@ test("Agent mode: high first action requires confirmation immediately", () => {
   assert.equal(decision.nextActionIndex, 0);
   assert.equal(decision.nextActionApproved, false);
 });
+
+test("Agent mode: structured error codes decide whether a failed action is retried", () => {
+  const store = new SessionStore();
+  const decision0 = store.create(makeStartRequest("agent"), makePlan(["low", "low"]));
+
+  const retried = store.next(decision0.sessionId, {
+    actionIndex: 0,
+    ok: false,
+    errorCode: "no_targets",
+    counts: { targets: 0, actors: 0, components: 0, instances: 0, requested: 0 }
+  });
+  assert.equal(retried.status, "ready_to_execute");
+  assert.equal(retried.nextActionIndex, 0);
+  assert.equal(retried.nextActionAttempts, 1);
+
+  const failed = store.next(decision0.sessionId, { actionIndex: 0, ok: false, errorCode: "asset_not_found" });
+  assert.equal(failed.status, "failed");
+  assert.equal(failed.nextActionIndex, 0);
+  assert.equal(failed.nextActionAttempts, 2);
+});
+
+test("Agent mode: createActor meshPath outside /Game/ or /Engine/ requires confirmation", () => {
+  const plan = makePlan(["low"]);
+  plan.actions = [
+    {
+      command: "scene.createActor",
+      params: { actorClass: "StaticMeshActor", count: 4, meshPath: "/Temp/SM_Crate.SM_Crate", instanced: true },
+      risk: "low"
+    }
+  ];
+
+  const store = new SessionStore();
+  const decision = store.create(makeStartRequest("agent"), plan);
+  assert.equal(decision.status, "awaiting_approval");
+  assert.equal(decision.nextActionIndex, 0);
+  assert.equal(decision.nextActionApproved, false);
+});
+
+test("createActor with instanced=true is rejected without meshPath", () => {
+  const parsed = SceneCreateActorActionSchema.safeParse({
+    command: "scene.createActor",
+    params: { actorClass: "StaticMeshActor", count: 4, instanced: true },
+    risk: "low"
+  });
+  assert.equal(parsed.success, false);
+});
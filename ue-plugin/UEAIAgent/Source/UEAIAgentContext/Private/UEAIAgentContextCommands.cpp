@@ -0,0 +1,236 @@
+#include "UEAIAgentContextCommands.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UEAIAgentSceneSnapshot.h"
+
+namespace
+{
+    constexpr int32 DefaultNearestCount = 16;
+    constexpr int32 MaxNearestCount = 256;
+    constexpr int32 DefaultBoxLimit = 256;
+    constexpr int32 MaxBoxLimit = 1024;
+
+    void WriteActors(const TSharedRef<FUEAIAgentContextJsonWriter>& Writer, const TArray<TSharedPtr<FJsonValue>>& Actors)
+    {
+        const TSharedPtr<FJsonValue> Value = MakeShared<FJsonValueArray>(Actors);
+        FJsonSerializer::Serialize(Value, TEXT("actors"), Writer, false);
+    }
+
+    bool TryReadVector(const TSharedPtr<FJsonObject>& Params, const TCHAR* FieldName, FVector& OutVector)
+    {
+        const TSharedPtr<FJsonObject>* VectorObj = nullptr;
+        if (!Params->TryGetObjectField(FieldName, VectorObj) || !VectorObj || !VectorObj->IsValid())
+        {
+            return false;
+        }
+
+        double X = 0.0;
+        double Y = 0.0;
+        double Z = 0.0;
+        if (!(*VectorObj)->TryGetNumberField(TEXT("x"), X) ||
+            !(*VectorObj)->TryGetNumberField(TEXT("y"), Y) ||
+            !(*VectorObj)->TryGetNumberField(TEXT("z"), Z))
+        {
+            return false;
+        }
+
+        OutVector = FVector(X, Y, Z);
+        return true;
+    }
+
+    int32 ReadClampedCount(const TSharedPtr<FJsonObject>& Params, const TCHAR* FieldName, int32 DefaultValue, int32 MaxValue)
+    {
+        double Value = 0.0;
+        if (!Params->TryGetNumberField(FieldName, Value))
+        {
+            return DefaultValue;
+        }
+        return FMath::Clamp(FMath::TruncToInt(Value), 1, MaxValue);
+    }
+
+    bool TryParseSceneField(const FString& FieldName, EUEAIAgentSceneField& OutField)
+    {
+        static const TMap<FString, EUEAIAgentSceneField> FieldsByName = {
+            { TEXT("label"), EUEAIAgentSceneField::Label },
+            { TEXT("class"), EUEAIAgentSceneField::Class },
+            { TEXT("folder"), EUEAIAgentSceneField::Folder },
+            { TEXT("location"), EUEAIAgentSceneField::Location },
+            { TEXT("rotation"), EUEAIAgentSceneField::Rotation },
+            { TEXT("scale"), EUEAIAgentSceneField::Scale },
+            { TEXT("bounds"), EUEAIAgentSceneField::Bounds }
+        };
+
+        const EUEAIAgentSceneField* Field = FieldsByName.Find(FieldName);
+        if (!Field)
+        {
+            return false;
+        }
+        OutField = *Field;
+        return true;
+    }
+
+    bool ParseSceneSummaryQuery(const TSharedPtr<FJsonObject>& Params, FUEAIAgentSceneSummaryQuery& OutQuery, FString& OutMessage)
+    {
+        Params->TryGetStringField(TEXT("cursor"), OutQuery.Cursor);
+        Params->TryGetStringField(TEXT("classFilter"), OutQuery.ClassFilter);
+        OutQuery.PageSize = ReadClampedCount(Params, TEXT("pageSize"), OutQuery.PageSize, FUEAIAgentSceneSummaryQuery::MaxPageSize);
+
+        // Histograms describe the whole level, so by default they ride along with the first page only.
+        OutQuery.bIncludeHistograms = OutQuery.Cursor.IsEmpty();
+        Params->TryGetBoolField(TEXT("includeHistograms"), OutQuery.bIncludeHistograms);
+
+        const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
+        if (!Params->TryGetArrayField(TEXT("fields"), FieldsArray) || !FieldsArray)
+        {
+            return true;
+        }
+
+        OutQuery.Fields = EUEAIAgentSceneField::None;
+        for (const TSharedPtr<FJsonValue>& Value : *FieldsArray)
+        {
+            FString FieldName;
+            EUEAIAgentSceneField Field = EUEAIAgentSceneField::None;
+            if (!Value.IsValid() || !Value->TryGetString(FieldName))
+            {
+                continue;
+            }
+            if (FieldName == TEXT("name"))
+            {
+                continue;
+            }
+            if (!TryParseSceneField(FieldName, Field))
+            {
+                OutMessage = FString::Printf(TEXT("Unknown scene summary field: %s"), *FieldName);
+                return false;
+            }
+            OutQuery.Fields |= Field;
+        }
+        return true;
+    }
+}
+
+bool FUEAIAgentContextCommands::Execute(
+    const FString& Command,
+    const TSharedPtr<FJsonObject>& Params,
+    const TSharedRef<FUEAIAgentContextJsonWriter>& Writer,
+    FString& OutMessage)
+{
+    const TSharedPtr<FJsonObject> SafeParams = Params.IsValid() ? Params : MakeShared<FJsonObject>();
+    FUEAIAgentSceneSnapshot::Get().Refresh();
+
+    if (Command == TEXT("context.findNearestActors"))
+    {
+        return FindNearestActors(SafeParams, Writer, OutMessage);
+    }
+    if (Command == TEXT("context.findActorsInBox"))
+    {
+        return FindActorsInBox(SafeParams, Writer, OutMessage);
+    }
+    if (Command == TEXT("context.getSceneSummary"))
+    {
+        return GetSceneSummary(SafeParams, Writer, OutMessage);
+    }
+
+    OutMessage = FString::Printf(TEXT("Unsupported context command: %s"), *Command);
+    return false;
+}
+
+bool FUEAIAgentContextCommands::FindNearestActors(
+    const TSharedPtr<FJsonObject>& Params,
+    const TSharedRef<FUEAIAgentContextJsonWriter>& Writer,
+    FString& OutMessage)
+{
+    const FUEAIAgentSceneSnapshot& Snapshot = FUEAIAgentSceneSnapshot::Get();
+
+    TSet<FString> ExcludedNames;
+    const TArray<TSharedPtr<FJsonValue>>* ExcludedArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("excludeNames"), ExcludedArray) && ExcludedArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ExcludedArray)
+        {
+            FString Name;
+            if (Value.IsValid() && Value->TryGetString(Name))
+            {
+                ExcludedNames.Add(Name);
+            }
+        }
+    }
+
+    FVector Origin = FVector::ZeroVector;
+    FString ActorName;
+    if (Params->TryGetStringField(TEXT("actorName"), ActorName) && !ActorName.IsEmpty())
+    {
+        FBox Bounds(ForceInit);
+        if (!Snapshot.GetActorBounds(ActorName, Bounds))
+        {
+            OutMessage = FString::Printf(TEXT("Actor not found: %s"), *ActorName);
+            return false;
+        }
+        Origin = Bounds.GetCenter();
+        ExcludedNames.Add(ActorName);
+    }
+    else if (!TryReadVector(Params, TEXT("location"), Origin))
+    {
+        OutMessage = TEXT("context.findNearestActors needs 'actorName' or 'location'.");
+        return false;
+    }
+
+    FString ClassFilter;
+    Params->TryGetStringField(TEXT("classFilter"), ClassFilter);
+    const int32 Count = ReadClampedCount(Params, TEXT("count"), DefaultNearestCount, MaxNearestCount);
+
+    TArray<TSharedPtr<FJsonValue>> Actors;
+    Snapshot.FindNearestActors(Origin, Count, ClassFilter, ExcludedNames, Actors);
+
+    WriteActors(Writer, Actors);
+    OutMessage = FString::Printf(TEXT("Found %d actor(s) near the requested point."), Actors.Num());
+    return true;
+}
+
+bool FUEAIAgentContextCommands::FindActorsInBox(
+    const TSharedPtr<FJsonObject>& Params,
+    const TSharedRef<FUEAIAgentContextJsonWriter>& Writer,
+    FString& OutMessage)
+{
+    FVector Min = FVector::ZeroVector;
+    FVector Max = FVector::ZeroVector;
+    if (!TryReadVector(Params, TEXT("min"), Min) || !TryReadVector(Params, TEXT("max"), Max))
+    {
+        OutMessage = TEXT("context.findActorsInBox needs 'min' and 'max' corners.");
+        return false;
+    }
+
+    FString ClassFilter;
+    Params->TryGetStringField(TEXT("classFilter"), ClassFilter);
+    const int32 Limit = ReadClampedCount(Params, TEXT("limit"), DefaultBoxLimit, MaxBoxLimit);
+
+    TArray<TSharedPtr<FJsonValue>> Actors;
+    const FBox Box(Min.ComponentMin(Max), Min.ComponentMax(Max));
+    const bool bComplete = FUEAIAgentSceneSnapshot::Get().FindActorsInBox(Box, Limit, ClassFilter, Actors);
+
+    WriteActors(Writer, Actors);
+    Writer->WriteValue(TEXT("truncated"), !bComplete);
+    OutMessage = FString::Printf(TEXT("Found %d actor(s) in the requested box%s."), Actors.Num(), bComplete ? TEXT("") : TEXT(" (truncated)"));
+    return true;
+}
+
+bool FUEAIAgentContextCommands::GetSceneSummary(
+    const TSharedPtr<FJsonObject>& Params,
+    const TSharedRef<FUEAIAgentContextJsonWriter>& Writer,
+    FString& OutMessage)
+{
+    FUEAIAgentSceneSummaryQuery Query;
+    if (!ParseSceneSummaryQuery(Params, Query, OutMessage))
+    {
+        return false;
+    }
+
+    const FUEAIAgentSceneSnapshot& Snapshot = FUEAIAgentSceneSnapshot::Get();
+    Snapshot.WriteSceneSummary(Query, *Writer);
+    OutMessage = FString::Printf(TEXT("Scene summary of %d actor(s)."), Snapshot.GetActorCount());
+    return true;
+}
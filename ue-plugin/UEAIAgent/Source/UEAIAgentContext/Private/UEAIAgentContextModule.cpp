@@ -1,16 +1,19 @@
 #include "UEAIAgentContextModule.h"
 
 #include "Modules/ModuleManager.h"
+#include "UEAIAgentSceneSnapshot.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUEAIAgentContext, Log, All);
 
 void FUEAIAgentContextModule::StartupModule()
 {
+    FUEAIAgentSceneSnapshot::Get().Startup();
     UE_LOG(LogUEAIAgentContext, Log, TEXT("UEAIAgentContext started."));
 }
 
 void FUEAIAgentContextModule::ShutdownModule()
 {
+    FUEAIAgentSceneSnapshot::Get().Shutdown();
     UE_LOG(LogUEAIAgentContext, Log, TEXT("UEAIAgentContext stopped."));
 }
 
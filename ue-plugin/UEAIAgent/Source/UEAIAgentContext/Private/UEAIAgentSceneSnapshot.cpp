@@ -0,0 +1,776 @@
+#include "UEAIAgentSceneSnapshot.h"
+
+#include "UEAIAgentSpatialIndex.h"
+
+#include "Algo/Sort.h"
+#include "Components/ActorComponent.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    TSharedRef<FJsonObject> VectorToJson(const FVector& Value)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("x"), Value.X);
+        Object->SetNumberField(TEXT("y"), Value.Y);
+        Object->SetNumberField(TEXT("z"), Value.Z);
+        return Object;
+    }
+
+    struct FFolderNode
+    {
+        int32 ActorCount = 0;
+        int32 TotalCount = 0;
+        TMap<FString, FFolderNode> Children;
+    };
+
+    void AdjustCount(TMap<FString, int32>& Counts, const FString& Key, int32 Delta)
+    {
+        int32& Count = Counts.FindOrAdd(Key);
+        Count += Delta;
+        if (Count <= 0)
+        {
+            Counts.Remove(Key);
+        }
+    }
+
+    // Summary order: by name, then by object path so same-named actors from different levels stay distinct.
+    bool IsSortKeyBefore(const FString& NameA, const FString& PathA, const FString& NameB, const FString& PathB)
+    {
+        const int32 NameOrder = NameA.Compare(NameB, ESearchCase::CaseSensitive);
+        return NameOrder != 0 ? NameOrder < 0 : PathA.Compare(PathB, ESearchCase::CaseSensitive) < 0;
+    }
+
+    void WriteVector(FUEAIAgentContextJsonWriter& Writer, const TCHAR* Identifier, const FVector& Value)
+    {
+        Writer.WriteObjectStart(Identifier);
+        Writer.WriteValue(TEXT("x"), Value.X);
+        Writer.WriteValue(TEXT("y"), Value.Y);
+        Writer.WriteValue(TEXT("z"), Value.Z);
+        Writer.WriteObjectEnd();
+    }
+
+    void WriteFolderNode(FUEAIAgentContextJsonWriter& Writer, const TCHAR* Identifier, const FString& Name, const FFolderNode& Node)
+    {
+        if (Identifier)
+        {
+            Writer.WriteObjectStart(Identifier);
+        }
+        else
+        {
+            Writer.WriteObjectStart();
+        }
+        Writer.WriteValue(TEXT("name"), Name);
+        Writer.WriteValue(TEXT("actors"), Node.ActorCount);
+        Writer.WriteValue(TEXT("total"), Node.TotalCount);
+        if (Node.Children.Num() > 0)
+        {
+            TArray<FString> ChildNames;
+            Node.Children.GetKeys(ChildNames);
+            ChildNames.Sort();
+
+            Writer.WriteArrayStart(TEXT("children"));
+            for (const FString& ChildName : ChildNames)
+            {
+                WriteFolderNode(Writer, nullptr, ChildName, Node.Children.FindChecked(ChildName));
+            }
+            Writer.WriteArrayEnd();
+        }
+        Writer.WriteObjectEnd();
+    }
+
+    TSharedRef<FJsonObject> RotatorToJson(const FRotator& Value)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("pitch"), Value.Pitch);
+        Object->SetNumberField(TEXT("yaw"), Value.Yaw);
+        Object->SetNumberField(TEXT("roll"), Value.Roll);
+        return Object;
+    }
+}
+
+bool FUEAIAgentSceneSnapshot::FActorRecord::HasSameContent(const FActorRecord& Other) const
+{
+    return Name == Other.Name &&
+        Path == Other.Path &&
+        Label == Other.Label &&
+        ClassName == Other.ClassName &&
+        Folder == Other.Folder &&
+        Location == Other.Location &&
+        Rotation == Other.Rotation &&
+        Scale == Other.Scale &&
+        Bounds == Other.Bounds;
+}
+
+FUEAIAgentSceneSnapshot& FUEAIAgentSceneSnapshot::Get()
+{
+    static FUEAIAgentSceneSnapshot Instance;
+    return Instance;
+}
+
+FUEAIAgentSceneSnapshot::FUEAIAgentSceneSnapshot()
+    : SpatialIndex(MakeUnique<FUEAIAgentSpatialIndex>())
+{
+}
+
+FUEAIAgentSceneSnapshot::~FUEAIAgentSceneSnapshot() = default;
+
+void FUEAIAgentSceneSnapshot::Startup()
+{
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FUEAIAgentSceneSnapshot::HandleActorLabelChanged);
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FUEAIAgentSceneSnapshot::HandleObjectModified);
+    ObjectPropertyChangedHandle =
+        FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FUEAIAgentSceneSnapshot::HandleObjectPropertyChanged);
+    LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FUEAIAgentSceneSnapshot::HandleLevelAddedToWorld);
+    LevelRemovedFromWorldHandle =
+        FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FUEAIAgentSceneSnapshot::HandleLevelRemovedFromWorld);
+    PostUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FUEAIAgentSceneSnapshot::HandlePostUndoRedo);
+    MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FUEAIAgentSceneSnapshot::HandleMapChange);
+
+    if (GEngine)
+    {
+        BindEngineDelegates();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FUEAIAgentSceneSnapshot::BindEngineDelegates);
+    }
+}
+
+void FUEAIAgentSceneSnapshot::Shutdown()
+{
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedFromWorldHandle);
+    FEditorDelegates::PostUndoRedo.Remove(PostUndoRedoHandle);
+    FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+    if (GEngine && bEngineDelegatesBound)
+    {
+        GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+    }
+    bEngineDelegatesBound = false;
+
+    Reset(nullptr);
+    SnapshotId.Invalidate();
+}
+
+void FUEAIAgentSceneSnapshot::BindEngineDelegates()
+{
+    if (!GEngine || bEngineDelegatesBound)
+    {
+        return;
+    }
+
+    LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FUEAIAgentSceneSnapshot::HandleLevelActorAdded);
+    LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FUEAIAgentSceneSnapshot::HandleLevelActorDeleted);
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FUEAIAgentSceneSnapshot::HandleActorMoved);
+    bEngineDelegatesBound = true;
+    bNeedsFullScan = true;
+}
+
+void FUEAIAgentSceneSnapshot::Refresh()
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (SnapshotWorld.Get() != World)
+    {
+        Reset(World);
+    }
+    if (!World)
+    {
+        return;
+    }
+
+    const uint64 NextVersion = Version + 1;
+    bool bChanged = false;
+
+    if (bNeedsFullScan)
+    {
+        bNeedsFullScan = false;
+        TSet<FObjectKey> SeenActors;
+        SeenActors.Reserve(Records.Num());
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            const FObjectKey ActorKey(*It);
+            SeenActors.Add(ActorKey);
+            DirtyActors.Add(ActorKey, *It);
+        }
+        for (const TPair<FObjectKey, FActorRecord>& Pair : Records)
+        {
+            if (!SeenActors.Contains(Pair.Key))
+            {
+                RemovedActors.Add(Pair.Key);
+            }
+        }
+    }
+
+    for (const FObjectKey& ActorKey : RemovedActors)
+    {
+        bChanged |= RemoveRecord(ActorKey, NextVersion);
+    }
+    RemovedActors.Reset();
+
+    for (const TPair<FObjectKey, TWeakObjectPtr<AActor>>& Pair : DirtyActors)
+    {
+        const AActor* Actor = Pair.Value.Get();
+        if (!IsTrackedWorldActor(Actor))
+        {
+            bChanged |= RemoveRecord(Pair.Key, NextVersion);
+            continue;
+        }
+
+        FActorRecord Record;
+        ReadRecord(Actor, Record);
+        const FActorRecord* Existing = Records.Find(Pair.Key);
+        if (Existing && Existing->HasSameContent(Record))
+        {
+            continue;
+        }
+        if (Existing && Existing->Name != Record.Name)
+        {
+            RemovedNames.Add(Existing->Name, NextVersion);
+        }
+
+        Record.Version = NextVersion;
+        AddRecord(Pair.Key, MoveTemp(Record));
+        bChanged = true;
+    }
+    DirtyActors.Reset();
+
+    if (bChanged)
+    {
+        Version = NextVersion;
+    }
+}
+
+const FGuid& FUEAIAgentSceneSnapshot::GetSnapshotId() const
+{
+    return SnapshotId;
+}
+
+uint64 FUEAIAgentSceneSnapshot::GetVersion() const
+{
+    return Version;
+}
+
+int32 FUEAIAgentSceneSnapshot::GetActorCount() const
+{
+    return Records.Num();
+}
+
+TSharedRef<FJsonObject> FUEAIAgentSceneSnapshot::BuildDelta(const FGuid& BaseSnapshotId, uint64 BaseVersion) const
+{
+    const bool bFull = BaseSnapshotId != SnapshotId || BaseVersion == 0 || BaseVersion > Version;
+
+    TSharedRef<FJsonObject> Delta = MakeShared<FJsonObject>();
+    Delta->SetStringField(TEXT("snapshotId"), SnapshotId.ToString(EGuidFormats::DigitsWithHyphensLower));
+    Delta->SetNumberField(TEXT("version"), static_cast<double>(Version));
+    Delta->SetNumberField(TEXT("baseVersion"), bFull ? 0.0 : static_cast<double>(BaseVersion));
+    Delta->SetBoolField(TEXT("full"), bFull);
+
+    TArray<TSharedPtr<FJsonValue>> Upserts;
+    for (const TPair<FObjectKey, FActorRecord>& Pair : Records)
+    {
+        if (bFull || Pair.Value.Version > BaseVersion)
+        {
+            Upserts.Add(MakeShared<FJsonValueObject>(RecordToJson(Pair.Value)));
+        }
+    }
+    Delta->SetArrayField(TEXT("upserts"), Upserts);
+
+    TArray<TSharedPtr<FJsonValue>> Removed;
+    if (!bFull)
+    {
+        for (const TPair<FString, uint64>& Pair : RemovedNames)
+        {
+            if (Pair.Value > BaseVersion)
+            {
+                Removed.Add(MakeShared<FJsonValueString>(Pair.Key));
+            }
+        }
+    }
+    Delta->SetArrayField(TEXT("removed"), Removed);
+    return Delta;
+}
+
+TSharedRef<FJsonObject> FUEAIAgentSceneSnapshot::BuildSummary(int32 MaxClasses) const
+{
+    TArray<TPair<FString, int32>> SortedClasses;
+    SortedClasses.Reserve(ClassCounts.Num());
+    for (const TPair<FString, int32>& Pair : ClassCounts)
+    {
+        SortedClasses.Emplace(Pair.Key, Pair.Value);
+    }
+
+    Algo::Sort(SortedClasses, [](const TPair<FString, int32>& A, const TPair<FString, int32>& B)
+    {
+        return A.Value > B.Value;
+    });
+    const int32 ReportedCount = FMath::Min(SortedClasses.Num(), FMath::Max(0, MaxClasses));
+
+    TArray<TSharedPtr<FJsonValue>> Classes;
+    Classes.Reserve(ReportedCount);
+    for (int32 Index = 0; Index < ReportedCount; ++Index)
+    {
+        TSharedRef<FJsonObject> ClassObj = MakeShared<FJsonObject>();
+        ClassObj->SetStringField(TEXT("class"), SortedClasses[Index].Key);
+        ClassObj->SetNumberField(TEXT("count"), SortedClasses[Index].Value);
+        Classes.Add(MakeShared<FJsonValueObject>(ClassObj));
+    }
+
+    TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+    Summary->SetNumberField(TEXT("actorCount"), Records.Num());
+    Summary->SetNumberField(TEXT("classCount"), ClassCounts.Num());
+    Summary->SetArrayField(TEXT("topClasses"), Classes);
+    return Summary;
+}
+
+void FUEAIAgentSceneSnapshot::WriteSceneSummary(const FUEAIAgentSceneSummaryQuery& Query, FUEAIAgentContextJsonWriter& Writer) const
+{
+    const TArray<FObjectKey>& Keys = GetSortedKeys();
+    const int32 PageSize = FMath::Clamp(Query.PageSize, 1, FUEAIAgentSceneSummaryQuery::MaxPageSize);
+
+    // Keyset pagination: the page starts after the cursor actor's path, so edits between pages never shift it.
+    // The name is the path's last segment, since actor names cannot contain '.'.
+    int32 StartIndex = 0;
+    if (!Query.Cursor.IsEmpty())
+    {
+        int32 DotIndex = INDEX_NONE;
+        const FString CursorName = Query.Cursor.FindLastChar(TEXT('.'), DotIndex) ? Query.Cursor.RightChop(DotIndex + 1) : Query.Cursor;
+        int32 High = Keys.Num();
+        while (StartIndex < High)
+        {
+            const int32 Mid = StartIndex + (High - StartIndex) / 2;
+            const FActorRecord& MidRecord = Records.FindChecked(Keys[Mid]);
+            if (IsSortKeyBefore(CursorName, Query.Cursor, MidRecord.Name, MidRecord.Path))
+            {
+                High = Mid;
+            }
+            else
+            {
+                StartIndex = Mid + 1;
+            }
+        }
+    }
+
+    Writer.WriteValue(TEXT("snapshotId"), SnapshotId.ToString(EGuidFormats::DigitsWithHyphensLower));
+    Writer.WriteValue(TEXT("version"), static_cast<double>(Version));
+    Writer.WriteValue(TEXT("actorCount"), Records.Num());
+
+    if (Query.bIncludeHistograms)
+    {
+        Writer.WriteObjectStart(TEXT("classHistogram"));
+        for (const TPair<FString, int32>& Pair : ClassCounts)
+        {
+            Writer.WriteValue(Pair.Key, Pair.Value);
+        }
+        Writer.WriteObjectEnd();
+
+        FFolderNode Root;
+        for (const TPair<FString, int32>& Pair : FolderCounts)
+        {
+            Root.TotalCount += Pair.Value;
+            FFolderNode* Node = &Root;
+            TArray<FString> Segments;
+            Pair.Key.ParseIntoArray(Segments, TEXT("/"));
+            for (const FString& Segment : Segments)
+            {
+                Node = &Node->Children.FindOrAdd(Segment);
+                Node->TotalCount += Pair.Value;
+            }
+            Node->ActorCount += Pair.Value;
+        }
+        WriteFolderNode(Writer, TEXT("folderTree"), FString(), Root);
+    }
+
+    const EUEAIAgentSceneField Fields = Query.Fields;
+    const auto MatchesFilter = [&Query](const FActorRecord& Record)
+    {
+        return Query.ClassFilter.IsEmpty() || Record.ClassName == Query.ClassFilter;
+    };
+    int32 Written = 0;
+    int32 Index = StartIndex;
+    const FActorRecord* LastWritten = nullptr;
+    Writer.WriteArrayStart(TEXT("actors"));
+    for (; Index < Keys.Num() && Written < PageSize; ++Index)
+    {
+        const FActorRecord& Record = Records.FindChecked(Keys[Index]);
+        if (!MatchesFilter(Record))
+        {
+            continue;
+        }
+
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("name"), Record.Name);
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Label))
+        {
+            Writer.WriteValue(TEXT("label"), Record.Label);
+        }
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Class))
+        {
+            Writer.WriteValue(TEXT("class"), Record.ClassName);
+        }
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Folder) && !Record.Folder.IsEmpty())
+        {
+            Writer.WriteValue(TEXT("folder"), Record.Folder);
+        }
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Location))
+        {
+            WriteVector(Writer, TEXT("location"), Record.Location);
+        }
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Rotation))
+        {
+            Writer.WriteObjectStart(TEXT("rotation"));
+            Writer.WriteValue(TEXT("pitch"), Record.Rotation.Pitch);
+            Writer.WriteValue(TEXT("yaw"), Record.Rotation.Yaw);
+            Writer.WriteValue(TEXT("roll"), Record.Rotation.Roll);
+            Writer.WriteObjectEnd();
+        }
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Scale))
+        {
+            WriteVector(Writer, TEXT("scale"), Record.Scale);
+        }
+        if (EnumHasAnyFlags(Fields, EUEAIAgentSceneField::Bounds))
+        {
+            Writer.WriteObjectStart(TEXT("bounds"));
+            WriteVector(Writer, TEXT("min"), Record.Bounds.Min);
+            WriteVector(Writer, TEXT("max"), Record.Bounds.Max);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteObjectEnd();
+        LastWritten = &Record;
+        ++Written;
+    }
+    Writer.WriteArrayEnd();
+
+    // Only hand out a cursor when a later record would actually pass the filter.
+    while (Index < Keys.Num() && !MatchesFilter(Records.FindChecked(Keys[Index])))
+    {
+        ++Index;
+    }
+    if (Index < Keys.Num() && LastWritten)
+    {
+        Writer.WriteValue(TEXT("nextCursor"), LastWritten->Path);
+    }
+    else
+    {
+        Writer.WriteNull(TEXT("nextCursor"));
+    }
+}
+
+void FUEAIAgentSceneSnapshot::FindNearestActors(
+    const FVector& Origin,
+    int32 Count,
+    const FString& ClassFilter,
+    const TSet<FString>& ExcludedNames,
+    TArray<TSharedPtr<FJsonValue>>& OutActors) const
+{
+    TArray<TPair<FObjectKey, double>> Hits;
+    SpatialIndex->QueryNearest(Origin, Count, [this, &ClassFilter, &ExcludedNames](const FObjectKey& ActorKey)
+    {
+        const FActorRecord& Record = Records.FindChecked(ActorKey);
+        return (ClassFilter.IsEmpty() || Record.ClassName == ClassFilter) && !ExcludedNames.Contains(Record.Name);
+    }, Hits);
+
+    OutActors.Reserve(OutActors.Num() + Hits.Num());
+    for (const TPair<FObjectKey, double>& Hit : Hits)
+    {
+        TSharedRef<FJsonObject> ActorObj = RecordToJson(Records.FindChecked(Hit.Key));
+        ActorObj->SetNumberField(TEXT("distance"), Hit.Value);
+        OutActors.Add(MakeShared<FJsonValueObject>(ActorObj));
+    }
+}
+
+bool FUEAIAgentSceneSnapshot::FindActorsInBox(
+    const FBox& Box,
+    int32 Limit,
+    const FString& ClassFilter,
+    TArray<TSharedPtr<FJsonValue>>& OutActors) const
+{
+    TArray<FObjectKey> Keys;
+    const bool bComplete = SpatialIndex->QueryBox(Box, Limit, [this, &ClassFilter](const FObjectKey& ActorKey)
+    {
+        return ClassFilter.IsEmpty() || Records.FindChecked(ActorKey).ClassName == ClassFilter;
+    }, Keys);
+
+    const FVector Center = Box.GetCenter();
+    OutActors.Reserve(OutActors.Num() + Keys.Num());
+    for (const FObjectKey& ActorKey : Keys)
+    {
+        const FActorRecord& Record = Records.FindChecked(ActorKey);
+        TSharedRef<FJsonObject> ActorObj = RecordToJson(Record);
+        ActorObj->SetNumberField(TEXT("distance"), FMath::Sqrt(Record.Bounds.ComputeSquaredDistanceToPoint(Center)));
+        OutActors.Add(MakeShared<FJsonValueObject>(ActorObj));
+    }
+    return bComplete;
+}
+
+bool FUEAIAgentSceneSnapshot::GetActorBounds(const FString& ActorName, FBox& OutBounds) const
+{
+    const FObjectKey* ActorKey = KeysByName.Find(ActorName);
+    if (!ActorKey)
+    {
+        return false;
+    }
+
+    OutBounds = Records.FindChecked(*ActorKey).Bounds;
+    return true;
+}
+
+void FUEAIAgentSceneSnapshot::Acknowledge(const FGuid& AckSnapshotId, uint64 AckVersion)
+{
+    if (AckSnapshotId != SnapshotId)
+    {
+        return;
+    }
+
+    for (auto It = RemovedNames.CreateIterator(); It; ++It)
+    {
+        if (It.Value() <= AckVersion)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FUEAIAgentSceneSnapshot::AddRecord(const FObjectKey& ActorKey, FActorRecord&& Record)
+{
+    if (const FActorRecord* Existing = Records.Find(ActorKey))
+    {
+        AdjustCount(ClassCounts, Existing->ClassName, -1);
+        AdjustCount(FolderCounts, Existing->Folder, -1);
+        RemoveNameKey(Existing->Name, ActorKey);
+    }
+
+    AdjustCount(ClassCounts, Record.ClassName, 1);
+    AdjustCount(FolderCounts, Record.Folder, 1);
+    RemovedNames.Remove(Record.Name);
+    KeysByName.Add(Record.Name, ActorKey);
+    SpatialIndex->Update(ActorKey, Record.Bounds);
+    Records.Add(ActorKey, MoveTemp(Record));
+}
+
+bool FUEAIAgentSceneSnapshot::RemoveRecord(const FObjectKey& ActorKey, uint64 RemovedVersion)
+{
+    FActorRecord Removed;
+    if (!Records.RemoveAndCopyValue(ActorKey, Removed))
+    {
+        return false;
+    }
+
+    AdjustCount(ClassCounts, Removed.ClassName, -1);
+    AdjustCount(FolderCounts, Removed.Folder, -1);
+    RemoveNameKey(Removed.Name, ActorKey);
+    SpatialIndex->Remove(ActorKey);
+    RemovedNames.Add(Removed.Name, RemovedVersion);
+    return true;
+}
+
+void FUEAIAgentSceneSnapshot::RemoveNameKey(const FString& ActorName, const FObjectKey& ActorKey)
+{
+    // Streamed sublevels can hold actors with the same object name; keep the mapping if it points elsewhere.
+    const FObjectKey* MappedKey = KeysByName.Find(ActorName);
+    if (MappedKey && *MappedKey == ActorKey)
+    {
+        KeysByName.Remove(ActorName);
+    }
+}
+
+const TArray<FObjectKey>& FUEAIAgentSceneSnapshot::GetSortedKeys() const
+{
+    if (SortedKeysSnapshotId == SnapshotId && SortedKeysVersion == Version && SortedKeys.Num() == Records.Num())
+    {
+        return SortedKeys;
+    }
+
+    SortedKeys.Reset(Records.Num());
+    Records.GetKeys(SortedKeys);
+    SortedKeys.Sort([this](const FObjectKey& A, const FObjectKey& B)
+    {
+        const FActorRecord& RecordA = Records.FindChecked(A);
+        const FActorRecord& RecordB = Records.FindChecked(B);
+        return IsSortKeyBefore(RecordA.Name, RecordA.Path, RecordB.Name, RecordB.Path);
+    });
+    SortedKeysSnapshotId = SnapshotId;
+    SortedKeysVersion = Version;
+    return SortedKeys;
+}
+
+void FUEAIAgentSceneSnapshot::Reset(UWorld* World)
+{
+    SnapshotWorld = World;
+    SnapshotId = FGuid::NewGuid();
+    Version = 0;
+    Records.Reset();
+    RemovedNames.Reset();
+    ClassCounts.Reset();
+    FolderCounts.Reset();
+    KeysByName.Reset();
+    SpatialIndex->Reset();
+    DirtyActors.Reset();
+    RemovedActors.Reset();
+    bNeedsFullScan = true;
+}
+
+void FUEAIAgentSceneSnapshot::MarkDirty(AActor* Actor)
+{
+    if (bNeedsFullScan || !IsTrackedWorldActor(Actor))
+    {
+        return;
+    }
+
+    const FObjectKey ActorKey(Actor);
+    RemovedActors.Remove(ActorKey);
+    DirtyActors.Add(ActorKey, Actor);
+}
+
+void FUEAIAgentSceneSnapshot::MarkRemoved(AActor* Actor)
+{
+    if (bNeedsFullScan || !Actor)
+    {
+        return;
+    }
+
+    const FObjectKey ActorKey(Actor);
+    DirtyActors.Remove(ActorKey);
+    RemovedActors.Add(ActorKey);
+}
+
+bool FUEAIAgentSceneSnapshot::IsTrackedWorldActor(const AActor* Actor) const
+{
+    return IsValid(Actor) && SnapshotWorld.IsValid() && Actor->GetWorld() == SnapshotWorld.Get();
+}
+
+void FUEAIAgentSceneSnapshot::ReadRecord(const AActor* Actor, FActorRecord& OutRecord) const
+{
+    OutRecord.Name = Actor->GetName();
+    OutRecord.Path = Actor->GetPathName();
+    OutRecord.Label = Actor->GetActorLabel();
+    OutRecord.ClassName = Actor->GetClass() ? Actor->GetClass()->GetName() : TEXT("Unknown");
+    const FName FolderPath = Actor->GetFolderPath();
+    OutRecord.Folder = FolderPath.IsNone() ? FString() : FolderPath.ToString();
+    OutRecord.Location = Actor->GetActorLocation();
+    OutRecord.Rotation = Actor->GetActorRotation();
+    OutRecord.Scale = Actor->GetActorScale3D();
+
+    FVector BoundsOrigin;
+    FVector BoundsExtent;
+    Actor->GetActorBounds(false, BoundsOrigin, BoundsExtent);
+    OutRecord.Bounds = BoundsExtent.IsNearlyZero()
+        ? FBox(OutRecord.Location, OutRecord.Location)
+        : FBox(BoundsOrigin - BoundsExtent, BoundsOrigin + BoundsExtent);
+}
+
+TSharedRef<FJsonObject> FUEAIAgentSceneSnapshot::RecordToJson(const FActorRecord& Record) const
+{
+    TSharedRef<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+    ActorObj->SetStringField(TEXT("name"), Record.Name);
+    ActorObj->SetStringField(TEXT("label"), Record.Label);
+    ActorObj->SetStringField(TEXT("class"), Record.ClassName);
+    if (!Record.Folder.IsEmpty())
+    {
+        ActorObj->SetStringField(TEXT("folder"), Record.Folder);
+    }
+    ActorObj->SetObjectField(TEXT("location"), VectorToJson(Record.Location));
+    ActorObj->SetObjectField(TEXT("rotation"), RotatorToJson(Record.Rotation));
+    ActorObj->SetObjectField(TEXT("scale"), VectorToJson(Record.Scale));
+    return ActorObj;
+}
+
+void FUEAIAgentSceneSnapshot::HandleLevelActorAdded(AActor* Actor)
+{
+    MarkDirty(Actor);
+}
+
+void FUEAIAgentSceneSnapshot::HandleLevelActorDeleted(AActor* Actor)
+{
+    MarkRemoved(Actor);
+}
+
+void FUEAIAgentSceneSnapshot::HandleActorMoved(AActor* Actor)
+{
+    MarkDirty(Actor);
+}
+
+void FUEAIAgentSceneSnapshot::HandleActorLabelChanged(AActor* Actor)
+{
+    MarkDirty(Actor);
+}
+
+void FUEAIAgentSceneSnapshot::HandleObjectModified(UObject* Object)
+{
+    // Modify() runs before the edit lands; the record is only re-read on the next Refresh.
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        MarkDirty(Actor);
+    }
+    else if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+    {
+        MarkDirty(Component->GetOwner());
+    }
+}
+
+void FUEAIAgentSceneSnapshot::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    HandleObjectModified(Object);
+}
+
+void FUEAIAgentSceneSnapshot::HandleLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+    if (!Level || World != SnapshotWorld.Get())
+    {
+        return;
+    }
+
+    for (AActor* Actor : Level->Actors)
+    {
+        MarkDirty(Actor);
+    }
+}
+
+void FUEAIAgentSceneSnapshot::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+    if (World != SnapshotWorld.Get())
+    {
+        return;
+    }
+
+    // A null level means every level of the world is going away.
+    if (!Level)
+    {
+        bNeedsFullScan = true;
+        return;
+    }
+
+    for (AActor* Actor : Level->Actors)
+    {
+        MarkRemoved(Actor);
+    }
+}
+
+void FUEAIAgentSceneSnapshot::HandlePostUndoRedo()
+{
+    // Undo can resurrect or discard actors without the add/delete broadcasts.
+    bNeedsFullScan = true;
+}
+
+void FUEAIAgentSceneSnapshot::HandleMapChange(uint32 MapChangeFlags)
+{
+    SnapshotWorld.Reset();
+}
@@ -0,0 +1,318 @@
+#include "UEAIAgentSpatialIndex.h"
+
+#include "Algo/Sort.h"
+
+namespace
+{
+    constexpr double CellSize = 2000.0;
+    constexpr int64 MaxCellsPerEntry = 64;
+    constexpr int32 MaxShellRadius = 32;
+    constexpr int32 BruteForceThreshold = 256;
+
+    FIntVector ComponentMinCell(const FIntVector& A, const FIntVector& B)
+    {
+        return FIntVector(FMath::Min(A.X, B.X), FMath::Min(A.Y, B.Y), FMath::Min(A.Z, B.Z));
+    }
+
+    FIntVector ComponentMaxCell(const FIntVector& A, const FIntVector& B)
+    {
+        return FIntVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z));
+    }
+
+    void SortHits(TArray<TPair<FObjectKey, double>>& Hits)
+    {
+        Algo::Sort(Hits, [](const TPair<FObjectKey, double>& A, const TPair<FObjectKey, double>& B)
+        {
+            return A.Value < B.Value;
+        });
+    }
+}
+
+void FUEAIAgentSpatialIndex::Update(const FObjectKey& Key, const FBox& Bounds)
+{
+    Remove(Key);
+
+    FEntry Entry;
+    Entry.Bounds = Bounds;
+    Entry.MinCell = ToCell(Bounds.Min);
+    Entry.MaxCell = ToCell(Bounds.Max);
+    const FIntVector Span = Entry.MaxCell - Entry.MinCell + FIntVector(1);
+    Entry.bOversized = static_cast<int64>(Span.X) * Span.Y * Span.Z > MaxCellsPerEntry;
+
+    AddToCells(Key, Entry);
+    Entries.Add(Key, Entry);
+}
+
+void FUEAIAgentSpatialIndex::Remove(const FObjectKey& Key)
+{
+    FEntry Entry;
+    if (Entries.RemoveAndCopyValue(Key, Entry))
+    {
+        RemoveFromCells(Key, Entry);
+    }
+}
+
+void FUEAIAgentSpatialIndex::Reset()
+{
+    Entries.Reset();
+    Cells.Reset();
+    Oversized.Reset();
+    bHasOccupiedCells = false;
+}
+
+void FUEAIAgentSpatialIndex::QueryNearest(
+    const FVector& Origin,
+    int32 Count,
+    TFunctionRef<bool(const FObjectKey&)> Filter,
+    TArray<TPair<FObjectKey, double>>& OutHits) const
+{
+    OutHits.Reset();
+    if (Count <= 0 || Entries.IsEmpty())
+    {
+        return;
+    }
+
+    TSet<FObjectKey> Visited;
+    auto Consider = [this, &Origin, &Filter, &Visited, &OutHits](const FObjectKey& Key)
+    {
+        bool bAlreadyVisited = false;
+        Visited.Add(Key, &bAlreadyVisited);
+        if (bAlreadyVisited || !Filter(Key))
+        {
+            return;
+        }
+        const FEntry& Entry = Entries.FindChecked(Key);
+        OutHits.Emplace(Key, FMath::Sqrt(Entry.Bounds.ComputeSquaredDistanceToPoint(Origin)));
+    };
+
+    bool bComplete = false;
+    if (Entries.Num() > BruteForceThreshold && bHasOccupiedCells)
+    {
+        for (const FObjectKey& Key : Oversized)
+        {
+            Consider(Key);
+        }
+
+        const FIntVector Center = ToCell(Origin);
+        const int32 LastUsefulRadius = FMath::Max3(
+            FMath::Max(FMath::Abs(Center.X - OccupiedMin.X), FMath::Abs(OccupiedMax.X - Center.X)),
+            FMath::Max(FMath::Abs(Center.Y - OccupiedMin.Y), FMath::Abs(OccupiedMax.Y - Center.Y)),
+            FMath::Max(FMath::Abs(Center.Z - OccupiedMin.Z), FMath::Abs(OccupiedMax.Z - Center.Z)));
+
+        for (int32 Radius = 0; Radius <= FMath::Min(LastUsefulRadius, MaxShellRadius); ++Radius)
+        {
+            VisitShell(Center, Radius, [&Consider](const TArray<FObjectKey>& Keys)
+            {
+                for (const FObjectKey& Key : Keys)
+                {
+                    Consider(Key);
+                }
+            });
+
+            if (Radius == LastUsefulRadius)
+            {
+                bComplete = true;
+                break;
+            }
+
+            // Entries not reached yet lie only in outer shells, at least Radius cells away from Origin.
+            if (OutHits.Num() >= Count)
+            {
+                SortHits(OutHits);
+                if (OutHits[Count - 1].Value <= Radius * CellSize)
+                {
+                    bComplete = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (!bComplete)
+    {
+        for (const TPair<FObjectKey, FEntry>& Pair : Entries)
+        {
+            Consider(Pair.Key);
+        }
+    }
+
+    SortHits(OutHits);
+    if (OutHits.Num() > Count)
+    {
+        OutHits.SetNum(Count);
+    }
+}
+
+bool FUEAIAgentSpatialIndex::QueryBox(
+    const FBox& Box,
+    int32 Limit,
+    TFunctionRef<bool(const FObjectKey&)> Filter,
+    TArray<FObjectKey>& OutKeys) const
+{
+    OutKeys.Reset();
+    if (!Box.IsValid || Entries.IsEmpty())
+    {
+        return true;
+    }
+
+    bool bComplete = true;
+    TSet<FObjectKey> Visited;
+    auto Consider = [this, &Box, &Filter, &Visited, &OutKeys, &bComplete, Limit](const FObjectKey& Key)
+    {
+        bool bAlreadyVisited = false;
+        Visited.Add(Key, &bAlreadyVisited);
+        if (bAlreadyVisited || !Entries.FindChecked(Key).Bounds.Intersect(Box) || !Filter(Key))
+        {
+            return;
+        }
+        if (OutKeys.Num() >= Limit)
+        {
+            bComplete = false;
+            return;
+        }
+        OutKeys.Add(Key);
+    };
+
+    const FIntVector FirstCell = ComponentMaxCell(ToCell(Box.Min), OccupiedMin);
+    const FIntVector LastCell = ComponentMinCell(ToCell(Box.Max), OccupiedMax);
+    const FIntVector Span = LastCell - FirstCell + FIntVector(1);
+    const int64 CellCount = Span.X > 0 && Span.Y > 0 && Span.Z > 0 ? static_cast<int64>(Span.X) * Span.Y * Span.Z : 0;
+
+    if (!bHasOccupiedCells || CellCount > Entries.Num())
+    {
+        for (const TPair<FObjectKey, FEntry>& Pair : Entries)
+        {
+            Consider(Pair.Key);
+        }
+        return bComplete;
+    }
+
+    for (const FObjectKey& Key : Oversized)
+    {
+        Consider(Key);
+    }
+    for (int32 X = FirstCell.X; X <= LastCell.X; ++X)
+    {
+        for (int32 Y = FirstCell.Y; Y <= LastCell.Y; ++Y)
+        {
+            for (int32 Z = FirstCell.Z; Z <= LastCell.Z; ++Z)
+            {
+                if (const TArray<FObjectKey>* Keys = Cells.Find(FIntVector(X, Y, Z)))
+                {
+                    for (const FObjectKey& Key : *Keys)
+                    {
+                        Consider(Key);
+                    }
+                }
+            }
+        }
+    }
+    return bComplete;
+}
+
+FIntVector FUEAIAgentSpatialIndex::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize),
+        FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void FUEAIAgentSpatialIndex::AddToCells(const FObjectKey& Key, const FEntry& Entry)
+{
+    if (Entry.bOversized)
+    {
+        Oversized.Add(Key);
+        return;
+    }
+
+    for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+    {
+        for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+        {
+            for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+            {
+                Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Key);
+            }
+        }
+    }
+
+    // Grow-only; removals leave the range wide, which only costs a few empty cell lookups.
+    OccupiedMin = bHasOccupiedCells ? ComponentMinCell(OccupiedMin, Entry.MinCell) : Entry.MinCell;
+    OccupiedMax = bHasOccupiedCells ? ComponentMaxCell(OccupiedMax, Entry.MaxCell) : Entry.MaxCell;
+    bHasOccupiedCells = true;
+}
+
+void FUEAIAgentSpatialIndex::RemoveFromCells(const FObjectKey& Key, const FEntry& Entry)
+{
+    if (Entry.bOversized)
+    {
+        Oversized.Remove(Key);
+        return;
+    }
+
+    for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+    {
+        for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+        {
+            for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+            {
+                const FIntVector Cell(X, Y, Z);
+                TArray<FObjectKey>* Keys = Cells.Find(Cell);
+                if (!Keys)
+                {
+                    continue;
+                }
+                Keys->RemoveSwap(Key);
+                if (Keys->IsEmpty())
+                {
+                    Cells.Remove(Cell);
+                }
+            }
+        }
+    }
+}
+
+void FUEAIAgentSpatialIndex::VisitShell(
+    const FIntVector& Center,
+    int32 Radius,
+    TFunctionRef<void(const TArray<FObjectKey>&)> Visitor) const
+{
+    const FIntVector ShellMin = Center - FIntVector(Radius);
+    const FIntVector ShellMax = Center + FIntVector(Radius);
+    const FIntVector ClampedMin = ComponentMaxCell(ShellMin, OccupiedMin);
+    const FIntVector ClampedMax = ComponentMinCell(ShellMax, OccupiedMax);
+
+    auto VisitCell = [this, &Visitor](int32 X, int32 Y, int32 Z)
+    {
+        if (const TArray<FObjectKey>* Keys = Cells.Find(FIntVector(X, Y, Z)))
+        {
+            Visitor(*Keys);
+        }
+    };
+
+    for (int32 X = ClampedMin.X; X <= ClampedMax.X; ++X)
+    {
+        for (int32 Y = ClampedMin.Y; Y <= ClampedMax.Y; ++Y)
+        {
+            // Columns on the shell's side faces are visited top to bottom; interior columns only at the caps.
+            if (X == ShellMin.X || X == ShellMax.X || Y == ShellMin.Y || Y == ShellMax.Y)
+            {
+                for (int32 Z = ClampedMin.Z; Z <= ClampedMax.Z; ++Z)
+                {
+                    VisitCell(X, Y, Z);
+                }
+                continue;
+            }
+
+            if (ShellMin.Z >= OccupiedMin.Z && ShellMin.Z <= OccupiedMax.Z)
+            {
+                VisitCell(X, Y, ShellMin.Z);
+            }
+            if (ShellMax.Z >= OccupiedMin.Z && ShellMax.Z <= OccupiedMax.Z)
+            {
+                VisitCell(X, Y, ShellMax.Z);
+            }
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "UObject/ObjectKey.h"
+
+// Uniform grid hash over actor bounds. Each entry is stored in every cell its bounds touch;
+// bounds spanning too many cells (landscapes, sky spheres) live in a separate list checked by every query.
+class FUEAIAgentSpatialIndex
+{
+public:
+    void Update(const FObjectKey& Key, const FBox& Bounds);
+    void Remove(const FObjectKey& Key);
+    void Reset();
+
+    // Up to Count keys whose bounds are closest to Origin, nearest first. Distance is measured to the bounds surface.
+    void QueryNearest(
+        const FVector& Origin,
+        int32 Count,
+        TFunctionRef<bool(const FObjectKey&)> Filter,
+        TArray<TPair<FObjectKey, double>>& OutHits) const;
+    // Keys whose bounds intersect Box. Returns false when more than Limit matched and OutKeys was cut off.
+    bool QueryBox(const FBox& Box, int32 Limit, TFunctionRef<bool(const FObjectKey&)> Filter, TArray<FObjectKey>& OutKeys) const;
+
+private:
+    struct FEntry
+    {
+        FBox Bounds;
+        FIntVector MinCell;
+        FIntVector MaxCell;
+        bool bOversized = false;
+    };
+
+    FIntVector ToCell(const FVector& Location) const;
+    void AddToCells(const FObjectKey& Key, const FEntry& Entry);
+    void RemoveFromCells(const FObjectKey& Key, const FEntry& Entry);
+    void VisitShell(const FIntVector& Center, int32 Radius, TFunctionRef<void(const TArray<FObjectKey>&)> Visitor) const;
+
+    TMap<FObjectKey, FEntry> Entries;
+    TMap<FIntVector, TArray<FObjectKey>> Cells;
+    TSet<FObjectKey> Oversized;
+    FIntVector OccupiedMin = FIntVector::ZeroValue;
+    FIntVector OccupiedMax = FIntVector::ZeroValue;
+    bool bHasOccupiedCells = false;
+};
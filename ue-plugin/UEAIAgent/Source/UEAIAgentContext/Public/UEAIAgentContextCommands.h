@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEAIAgentSceneSnapshot.h"
+
+class FJsonObject;
+
+// Read-only context.* commands answered from the scene snapshot, so Agent Core can ask about one
+// region of the level instead of serializing every actor. They arrive as context.query messages on
+// the event channel.
+class UEAIAGENTCONTEXT_API FUEAIAgentContextCommands
+{
+public:
+    // Writes the result fields into the object Writer has open. Nothing is written when it fails.
+    static bool Execute(
+        const FString& Command,
+        const TSharedPtr<FJsonObject>& Params,
+        const TSharedRef<FUEAIAgentContextJsonWriter>& Writer,
+        FString& OutMessage);
+
+private:
+    static bool FindNearestActors(const TSharedPtr<FJsonObject>& Params, const TSharedRef<FUEAIAgentContextJsonWriter>& Writer, FString& OutMessage);
+    static bool FindActorsInBox(const TSharedPtr<FJsonObject>& Params, const TSharedRef<FUEAIAgentContextJsonWriter>& Writer, FString& OutMessage);
+    static bool GetSceneSummary(const TSharedPtr<FJsonObject>& Params, const TSharedRef<FUEAIAgentContextJsonWriter>& Writer, FString& OutMessage);
+};
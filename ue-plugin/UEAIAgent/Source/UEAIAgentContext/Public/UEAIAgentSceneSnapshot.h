@@ -0,0 +1,162 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class FJsonObject;
+class FJsonValue;
+class FUEAIAgentSpatialIndex;
+class ULevel;
+class UObject;
+class UWorld;
+struct FPropertyChangedEvent;
+
+enum class EUEAIAgentSceneField : uint32
+{
+    None = 0,
+    Label = 1 << 0,
+    Class = 1 << 1,
+    Folder = 1 << 2,
+    Location = 1 << 3,
+    Rotation = 1 << 4,
+    Scale = 1 << 5,
+    Bounds = 1 << 6,
+    All = Label | Class | Folder | Location | Rotation | Scale | Bounds
+};
+ENUM_CLASS_FLAGS(EUEAIAgentSceneField);
+
+// Condensed writer over a UTF-8 byte buffer, the same kind the transport builds request bodies with.
+using FUEAIAgentContextJsonWriter = TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>;
+
+struct FUEAIAgentSceneSummaryQuery
+{
+    static constexpr int32 MaxPageSize = 5000;
+
+    // Object path of the last actor on the previous page; empty for the first page.
+    FString Cursor;
+    int32 PageSize = 500;
+    // Actor names are always written; other record fields only when set here.
+    EUEAIAgentSceneField Fields = EUEAIAgentSceneField::All;
+    FString ClassFilter;
+    bool bIncludeHistograms = true;
+};
+
+// Versioned model of the editor world's actors. Editor change delegates only mark actors dirty;
+// Refresh re-reads the dirty ones and bumps the version, so a request can ship just the records
+// that changed since the version Agent Core last acknowledged. Game thread only.
+class UEAIAGENTCONTEXT_API FUEAIAgentSceneSnapshot
+{
+public:
+    static FUEAIAgentSceneSnapshot& Get();
+
+    FUEAIAgentSceneSnapshot();
+    ~FUEAIAgentSceneSnapshot();
+
+    void Startup();
+    void Shutdown();
+
+    // Folds pending editor changes into the snapshot. The first call after a map change rescans the world.
+    void Refresh();
+
+    const FGuid& GetSnapshotId() const;
+    uint64 GetVersion() const;
+    int32 GetActorCount() const;
+
+    // Records changed after BaseVersion plus names removed since then. Falls back to a full snapshot
+    // when the base belongs to another snapshot id or is not a version this snapshot has produced.
+    TSharedRef<FJsonObject> BuildDelta(const FGuid& BaseSnapshotId, uint64 BaseVersion) const;
+
+    // Actor count plus the most common classes, at most MaxClasses entries.
+    TSharedRef<FJsonObject> BuildSummary(int32 MaxClasses) const;
+
+    // Streams one page of actor records, sorted by name then object path, into the object Writer has open without
+    // building a JSON object tree. The class histogram and folder tree are included when the query asks for them.
+    void WriteSceneSummary(const FUEAIAgentSceneSummaryQuery& Query, FUEAIAgentContextJsonWriter& Writer) const;
+
+    // Spatial queries over the last Refresh. Records carry a "distance" field measured to the actor bounds.
+    // An empty ClassFilter matches every class; otherwise the class name must match exactly.
+    void FindNearestActors(
+        const FVector& Origin,
+        int32 Count,
+        const FString& ClassFilter,
+        const TSet<FString>& ExcludedNames,
+        TArray<TSharedPtr<FJsonValue>>& OutActors) const;
+    // Returns false when more than Limit actors matched and the result was cut off.
+    bool FindActorsInBox(const FBox& Box, int32 Limit, const FString& ClassFilter, TArray<TSharedPtr<FJsonValue>>& OutActors) const;
+    bool GetActorBounds(const FString& ActorName, FBox& OutBounds) const;
+
+    // Agent Core holds Version; removals at or before it no longer need to be sent.
+    void Acknowledge(const FGuid& AckSnapshotId, uint64 AckVersion);
+
+private:
+    struct FActorRecord
+    {
+        FString Name;
+        FString Path;
+        FString Label;
+        FString ClassName;
+        FString Folder;
+        FVector Location = FVector::ZeroVector;
+        FRotator Rotation = FRotator::ZeroRotator;
+        FVector Scale = FVector::OneVector;
+        FBox Bounds = FBox(ForceInit);
+        uint64 Version = 0;
+
+        bool HasSameContent(const FActorRecord& Other) const;
+    };
+
+    void BindEngineDelegates();
+    void Reset(UWorld* World);
+    void MarkDirty(AActor* Actor);
+    void MarkRemoved(AActor* Actor);
+    bool IsTrackedWorldActor(const AActor* Actor) const;
+    void AddRecord(const FObjectKey& ActorKey, FActorRecord&& Record);
+    bool RemoveRecord(const FObjectKey& ActorKey, uint64 RemovedVersion);
+    void RemoveNameKey(const FString& ActorName, const FObjectKey& ActorKey);
+    const TArray<FObjectKey>& GetSortedKeys() const;
+    void ReadRecord(const AActor* Actor, FActorRecord& OutRecord) const;
+    TSharedRef<FJsonObject> RecordToJson(const FActorRecord& Record) const;
+    void HandleLevelActorAdded(AActor* Actor);
+    void HandleLevelActorDeleted(AActor* Actor);
+    void HandleActorMoved(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleLevelAddedToWorld(ULevel* Level, UWorld* World);
+    void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+    void HandlePostUndoRedo();
+    void HandleMapChange(uint32 MapChangeFlags);
+
+    TWeakObjectPtr<UWorld> SnapshotWorld;
+    FGuid SnapshotId;
+    uint64 Version = 0;
+    TMap<FObjectKey, FActorRecord> Records;
+    TMap<FString, uint64> RemovedNames;
+    TMap<FString, int32> ClassCounts;
+    TMap<FString, FObjectKey> KeysByName;
+    TMap<FString, int32> FolderCounts;
+    mutable TArray<FObjectKey> SortedKeys;
+    mutable FGuid SortedKeysSnapshotId;
+    mutable uint64 SortedKeysVersion = 0;
+    TUniquePtr<FUEAIAgentSpatialIndex> SpatialIndex;
+    TMap<FObjectKey, TWeakObjectPtr<AActor>> DirtyActors;
+    TSet<FObjectKey> RemovedActors;
+    bool bNeedsFullScan = true;
+    bool bEngineDelegatesBound = false;
+
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle LevelActorAddedHandle;
+    FDelegateHandle LevelActorDeletedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle LevelAddedToWorldHandle;
+    FDelegateHandle LevelRemovedFromWorldHandle;
+    FDelegateHandle PostUndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+};
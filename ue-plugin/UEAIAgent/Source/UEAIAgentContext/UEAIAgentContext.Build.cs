@@ -9,7 +9,8 @@ public class UEAIAgentContext : ModuleRules
         PublicDependencyModuleNames.AddRange(
             new string[]
             {
-                "Core"
+                "Core",
+                "Json"
             }
         );
 
@@ -19,7 +20,6 @@ public class UEAIAgentContext : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "UnrealEd",
-                "Json",
                 "JsonUtilities",
                 "Landscape"
             }
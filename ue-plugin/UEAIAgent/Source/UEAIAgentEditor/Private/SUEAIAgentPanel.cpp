@@ -3,13 +3,16 @@
 #include "Editor.h"
 #include "Engine/Selection.h"
 #include "GameFramework/Actor.h"
+#include "UEAIAgentRichTextCache.h"
 #include "UEAIAgentSceneTools.h"
 #include "UEAIAgentSettings.h"
 #include "UEAIAgentTransportModule.h"
 #include "Misc/MessageDialog.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Text/RichTextLayoutMarshaller.h"
+#include "Framework/Text/RichTextMarkupProcessing.h"
 #include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/DateTime.h"
 #include "Styling/AppStyle.h"
 #include "Styling/CoreStyle.h"
@@ -46,14 +49,15 @@ namespace
 
     bool ShouldRefreshChatsForAutoTitle(const FUEAIAgentTransportModule& Transport)
     {
+        // Title changes arrive as chat.updated events while the event channel is up.
         const FString ActiveChatId = Transport.GetActiveChatId();
-        if (ActiveChatId.IsEmpty())
+        if (ActiveChatId.IsEmpty() || Transport.IsEventChannelConnected())
         {
             return false;
         }
 
-        const TArray<FUEAIAgentChatSummary>& Chats = Transport.GetChats();
-        for (const FUEAIAgentChatSummary& Chat : Chats)
+        const TSharedRef<const TArray<FUEAIAgentChatSummary>> Chats = Transport.GetChats();
+        for (const FUEAIAgentChatSummary& Chat : *Chats)
         {
             if (Chat.Id != ActiveChatId)
             {
@@ -67,6 +71,42 @@ namespace
         return false;
     }
 
+    bool IsUserHistoryEntry(const FUEAIAgentChatHistoryEntry& Entry)
+    {
+        return Entry.DisplayRole.Equals(TEXT("user"), ESearchCase::IgnoreCase) ||
+            (Entry.DisplayRole.IsEmpty() && Entry.Kind.Equals(TEXT("asked"), ESearchCase::IgnoreCase));
+    }
+
+    const FString& GetHistoryMessageText(const FUEAIAgentChatHistoryEntry& Entry)
+    {
+        return Entry.DisplayText.IsEmpty() ? Entry.Summary : Entry.DisplayText;
+    }
+
+    bool IsSameChatSummary(const FUEAIAgentChatSummary& Left, const FUEAIAgentChatSummary& Right)
+    {
+        return Left.Id == Right.Id &&
+            Left.Title == Right.Title &&
+            Left.bArchived == Right.bArchived &&
+            Left.LastActivityAt == Right.LastActivityAt;
+    }
+
+    // The chat list and the history both rebuild by reusing the item of every id already on screen,
+    // so SListView keeps those rows and only generates widgets for new items. Items without an id are skipped.
+    template <typename ItemType>
+    TMap<FString, TSharedPtr<ItemType>> MapItemsById(const TArray<TSharedPtr<ItemType>>& Items)
+    {
+        TMap<FString, TSharedPtr<ItemType>> ItemsById;
+        ItemsById.Reserve(Items.Num());
+        for (const TSharedPtr<ItemType>& Item : Items)
+        {
+            if (Item.IsValid() && !Item->Id.IsEmpty())
+            {
+                ItemsById.Add(Item->Id, Item);
+            }
+        }
+        return ItemsById;
+    }
+
     bool IsReferentialPrompt(const FString& Prompt)
     {
         const FString Lower = Prompt.ToLower();
@@ -98,80 +138,49 @@ namespace
         return Result;
     }
 
-    bool IsUserCanceledSessionMessage(const FString& Message)
-    {
-        return Message.Contains(TEXT("stopCondition=user_denied"), ESearchCase::IgnoreCase) ||
-            Message.Contains(TEXT("Rejected by user."), ESearchCase::IgnoreCase);
-    }
-
-    FString ExtractDecisionMessageBody(const FString& Message)
+    FString DescribeToolFailure(const FUEAIAgentToolResult& Result)
     {
-        const FString Prefix = TEXT("Session:");
-        if (!Message.StartsWith(Prefix))
+        FString Reason;
+        switch (Result.ErrorCode)
         {
-            return NormalizeSingleLineStatusText(Message);
-        }
-
-        int32 FirstNewline = INDEX_NONE;
-        if (!Message.FindChar(TEXT('\n'), FirstNewline))
-        {
-            return TEXT("");
-        }
-
-        const int32 SecondNewline = Message.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, FirstNewline + 1);
-        if (SecondNewline == INDEX_NONE)
-        {
-            return NormalizeSingleLineStatusText(Message.Mid(FirstNewline + 1));
-        }
-
-        FString Body = Message.Mid(SecondNewline + 1);
-        const int32 AssistantToken = Body.Find(TEXT("\nAssistant:"), ESearchCase::IgnoreCase);
-        if (AssistantToken != INDEX_NONE)
-        {
-            Body = Body.Left(AssistantToken);
-        }
-
-        return NormalizeSingleLineStatusText(Body);
-    }
-
-    FString ExtractFailedReasonFromSessionMessage(const FString& Message)
-    {
-        const FString Body = ExtractDecisionMessageBody(Message);
-        if (Body.IsEmpty())
-        {
-            return TEXT("");
-        }
-
-        const FString LastErrorToken = TEXT("Last error:");
-        const int32 LastErrorPos = Body.Find(LastErrorToken, ESearchCase::IgnoreCase);
-        if (LastErrorPos != INDEX_NONE)
-        {
-            const FString Reason = NormalizeSingleLineStatusText(Body.Mid(LastErrorPos + LastErrorToken.Len()));
-            if (!Reason.IsEmpty())
-            {
-                return Reason;
-            }
+        case EUEAIAgentToolErrorCode::EditorUnavailable:
+            Reason = TEXT("editor is not available.");
+            break;
+        case EUEAIAgentToolErrorCode::WorldUnavailable:
+            Reason = TEXT("no editor world is open.");
+            break;
+        case EUEAIAgentToolErrorCode::InvalidArguments:
+            Reason = TEXT("invalid arguments.");
+            break;
+        case EUEAIAgentToolErrorCode::NoTargets:
+            Reason = TEXT("no matching targets.");
+            break;
+        case EUEAIAgentToolErrorCode::AssetNotFound:
+            Reason = TEXT("asset not found.");
+            break;
+        case EUEAIAgentToolErrorCode::SpawnFailed:
+            Reason = FString::Printf(TEXT("spawned %d of %d actor(s)."), Result.ActorCount, Result.RequestedCount);
+            break;
+        case EUEAIAgentToolErrorCode::TransactionState:
+            Reason = TEXT("another edit is still running.");
+            break;
+        case EUEAIAgentToolErrorCode::NothingChanged:
+            Reason = FString::Printf(TEXT("nothing changed on %d target(s)."), Result.TargetCount);
+            break;
+        case EUEAIAgentToolErrorCode::Stopped:
+            Reason = FString::Printf(TEXT("stopped with %d target(s) left."), Result.TargetCount);
+            break;
+        default:
+            Reason = TEXT("operation could not be applied.");
+            break;
         }
 
-        const FString StopConditionToken = TEXT("Stopped by stopCondition=");
-        const int32 StopConditionPos = Body.Find(StopConditionToken, ESearchCase::IgnoreCase);
-        if (StopConditionPos != INDEX_NONE)
+        FString Description = FString::Printf(TEXT("%s: %s"), Result.Tool, *Reason);
+        if (!Result.Detail.IsEmpty())
         {
-            FString Condition = Body.Mid(StopConditionPos + StopConditionToken.Len());
-            int32 EndPos = INDEX_NONE;
-            if (Condition.FindChar(TEXT('.'), EndPos))
-            {
-                Condition = Condition.Left(EndPos);
-            }
-            Condition = Condition.Replace(TEXT("_"), TEXT(" "));
-            Condition = NormalizeSingleLineStatusText(Condition);
-            if (!Condition.IsEmpty())
-            {
-                return FString::Printf(TEXT("stopped by %s."), *Condition.ToLower());
-            }
+            Description += TEXT(" ") + NormalizeSingleLineStatusText(Result.Detail);
         }
-
-        return Body;
+        return Description;
     }
 
     FString ProviderCodeToLabel(const FString& ProviderCode)
@@ -191,302 +200,6 @@ namespace
         return ProviderCode;
     }
 
-    void AppendEscapedRichChar(FString& Out, TCHAR Ch)
-    {
-        if (Ch == TEXT('&'))
-        {
-            Out += TEXT("&amp;");
-            return;
-        }
-        if (Ch == TEXT('<'))
-        {
-            Out += TEXT("&lt;");
-            return;
-        }
-        if (Ch == TEXT('>'))
-        {
-            Out += TEXT("&gt;");
-            return;
-        }
-        Out.AppendChar(Ch);
-    }
-
-    FString EscapeRichText(const FString& Source)
-    {
-        FString Out;
-        Out.Reserve(Source.Len());
-        for (int32 Index = 0; Index < Source.Len(); ++Index)
-        {
-            AppendEscapedRichChar(Out, Source[Index]);
-        }
-        return Out;
-    }
-
-    FString ParseInlineMarkdown(const FString& Source)
-    {
-        FString Out;
-        Out.Reserve(Source.Len() + 32);
-
-        int32 Index = 0;
-        while (Index < Source.Len())
-        {
-            if (Source[Index] == TEXT('`'))
-            {
-                const int32 Close = Source.Find(TEXT("`"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1);
-                if (Close != INDEX_NONE && Close > Index + 1)
-                {
-                    const FString Code = Source.Mid(Index + 1, Close - Index - 1);
-                    Out += TEXT("<md.code>");
-                    Out += EscapeRichText(Code);
-                    Out += TEXT("</>");
-                    Index = Close + 1;
-                    continue;
-                }
-            }
-
-            if (Index + 1 < Source.Len() && Source[Index] == TEXT('*') && Source[Index + 1] == TEXT('*'))
-            {
-                const int32 Close = Source.Find(TEXT("**"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 2);
-                if (Close != INDEX_NONE && Close > Index + 2)
-                {
-                    const FString Bold = Source.Mid(Index + 2, Close - Index - 2);
-                    Out += TEXT("<md.bold>");
-                    Out += EscapeRichText(Bold);
-                    Out += TEXT("</>");
-                    Index = Close + 2;
-                    continue;
-                }
-            }
-
-            if (Source[Index] == TEXT('*'))
-            {
-                const int32 Close = Source.Find(TEXT("*"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1);
-                if (Close != INDEX_NONE && Close > Index + 1)
-                {
-                    const FString Italic = Source.Mid(Index + 1, Close - Index - 1);
-                    Out += TEXT("<md.italic>");
-                    Out += EscapeRichText(Italic);
-                    Out += TEXT("</>");
-                    Index = Close + 1;
-                    continue;
-                }
-            }
-
-            AppendEscapedRichChar(Out, Source[Index]);
-            ++Index;
-        }
-
-        return Out;
-    }
-
-    bool IsMarkdownTableRow(const FString& Line)
-    {
-        const FString Trimmed = Line.TrimStartAndEnd();
-        if (Trimmed.IsEmpty())
-        {
-            return false;
-        }
-
-        int32 PipeCount = 0;
-        for (int32 Index = 0; Index < Trimmed.Len(); ++Index)
-        {
-            if (Trimmed[Index] == TEXT('|'))
-            {
-                ++PipeCount;
-            }
-        }
-        return PipeCount >= 2;
-    }
-
-    bool IsMarkdownTableSeparator(const FString& Line)
-    {
-        FString Compact = Line.TrimStartAndEnd().Replace(TEXT(" "), TEXT(""));
-        if (Compact.IsEmpty() || !Compact.Contains(TEXT("|")))
-        {
-            return false;
-        }
-
-        bool bHasDash = false;
-        for (int32 Index = 0; Index < Compact.Len(); ++Index)
-        {
-            const TCHAR Ch = Compact[Index];
-            if (Ch == TEXT('|'))
-            {
-                continue;
-            }
-            if (Ch == TEXT('-'))
-            {
-                bHasDash = true;
-                continue;
-            }
-            if (Ch == TEXT(':'))
-            {
-                continue;
-            }
-            return false;
-        }
-        return bHasDash;
-    }
-
-    void ParseMarkdownTableCells(const FString& Line, TArray<FString>& OutCells)
-    {
-        OutCells.Empty();
-
-        FString Work = Line.TrimStartAndEnd();
-        if (Work.StartsWith(TEXT("|")))
-        {
-            Work = Work.Mid(1);
-        }
-        if (Work.EndsWith(TEXT("|")))
-        {
-            Work = Work.LeftChop(1);
-        }
-
-        Work.ParseIntoArray(OutCells, TEXT("|"), false);
-        for (FString& Cell : OutCells)
-        {
-            Cell = Cell.TrimStartAndEnd();
-        }
-    }
-
-    FString BuildMarkdownTableRowText(const TArray<FString>& Headers, const TArray<FString>& Cells)
-    {
-        FString RowText;
-        for (int32 CellIndex = 0; CellIndex < Cells.Num(); ++CellIndex)
-        {
-            if (CellIndex > 0)
-            {
-                RowText += TEXT("  ");
-            }
-
-            if (Headers.IsValidIndex(CellIndex))
-            {
-                const FString Header = Headers[CellIndex].TrimStartAndEnd();
-                if (!Header.IsEmpty())
-                {
-                    RowText += TEXT("<md.bold>");
-                    RowText += ParseInlineMarkdown(Header);
-                    RowText += TEXT(":</> ");
-                }
-            }
-
-            RowText += ParseInlineMarkdown(Cells[CellIndex]);
-        }
-
-        return RowText;
-    }
-
-    FString ConvertMarkdownToRichText(const FString& Source)
-    {
-        const FString Normalized = Source.Replace(TEXT("\r\n"), TEXT("\n")).Replace(TEXT("\r"), TEXT("\n"));
-        TArray<FString> Lines;
-        Normalized.ParseIntoArray(Lines, TEXT("\n"), false);
-
-        FString Out;
-        bool bInCodeBlock = false;
-        for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
-        {
-            const FString& Line = Lines[LineIndex];
-            const FString Trimmed = Line.TrimStartAndEnd();
-
-            if (Trimmed.StartsWith(TEXT("```")))
-            {
-                bInCodeBlock = !bInCodeBlock;
-                if (LineIndex + 1 < Lines.Num())
-                {
-                    Out += TEXT("\n");
-                }
-                continue;
-            }
-
-            if (bInCodeBlock)
-            {
-                Out += TEXT("<md.code>");
-                Out += EscapeRichText(Line);
-                Out += TEXT("</>");
-            }
-            else if (LineIndex + 1 < Lines.Num() &&
-                IsMarkdownTableRow(Trimmed) &&
-                IsMarkdownTableSeparator(Lines[LineIndex + 1].TrimStartAndEnd()))
-            {
-                TArray<FString> Headers;
-                ParseMarkdownTableCells(Trimmed, Headers);
-
-                int32 RowIndex = LineIndex + 2;
-                bool bHasDataRows = false;
-                while (RowIndex < Lines.Num())
-                {
-                    const FString RowTrimmed = Lines[RowIndex].TrimStartAndEnd();
-                    if (!IsMarkdownTableRow(RowTrimmed))
-                    {
-                        break;
-                    }
-
-                    TArray<FString> Cells;
-                    ParseMarkdownTableCells(RowTrimmed, Cells);
-                    if (Cells.Num() > 0)
-                    {
-                        Out += TEXT("• ");
-                        Out += BuildMarkdownTableRowText(Headers, Cells);
-                        bHasDataRows = true;
-                        if (RowIndex + 1 < Lines.Num())
-                        {
-                            Out += TEXT("\n");
-                        }
-                    }
-
-                    ++RowIndex;
-                }
-
-                if (!bHasDataRows)
-                {
-                    Out += ParseInlineMarkdown(Trimmed);
-                    if (LineIndex + 2 < Lines.Num())
-                    {
-                        Out += TEXT("\n");
-                    }
-                }
-
-                LineIndex = bHasDataRows ? (RowIndex - 1) : (LineIndex + 1);
-                continue;
-            }
-            else if (Trimmed.StartsWith(TEXT("# ")))
-            {
-                Out += TEXT("<md.bold>");
-                Out += ParseInlineMarkdown(Trimmed.Mid(2));
-                Out += TEXT("</>");
-            }
-            else if (Trimmed.StartsWith(TEXT("## ")))
-            {
-                Out += TEXT("<md.bold>");
-                Out += ParseInlineMarkdown(Trimmed.Mid(3));
-                Out += TEXT("</>");
-            }
-            else if (Trimmed.StartsWith(TEXT("### ")))
-            {
-                Out += TEXT("<md.bold>");
-                Out += ParseInlineMarkdown(Trimmed.Mid(4));
-                Out += TEXT("</>");
-            }
-            else if (Trimmed.StartsWith(TEXT("- ")) || Trimmed.StartsWith(TEXT("* ")))
-            {
-                Out += TEXT("• ");
-                Out += ParseInlineMarkdown(Trimmed.Mid(2));
-            }
-            else
-            {
-                Out += ParseInlineMarkdown(Line);
-            }
-
-            if (LineIndex + 1 < Lines.Num())
-            {
-                Out += TEXT("\n");
-            }
-        }
-
-        return Out;
-    }
-
     const ISlateStyle& GetChatMarkdownStyle()
     {
         static TSharedPtr<FSlateStyleSet> StyleSet;
@@ -594,8 +307,20 @@ namespace
 
 }
 
+SUEAIAgentPanel::~SUEAIAgentPanel()
+{
+    USelection::SelectionChangedEvent.RemoveAll(this);
+    USelection::SelectObjectEvent.RemoveAll(this);
+    FCoreDelegates::OnActorLabelChanged.RemoveAll(this);
+    if (GEngine)
+    {
+        GEngine->OnLevelActorDeleted().RemoveAll(this);
+    }
+}
+
 void SUEAIAgentPanel::Construct(const FArguments& InArgs)
 {
+    RichTextCache = MakeShared<FUEAIAgentRichTextCache, ESPMode::ThreadSafe>();
     ProviderItems.Empty();
     ProviderItems.Add(MakeShared<FString>(TEXT("OpenAI")));
     ProviderItems.Add(MakeShared<FString>(TEXT("Gemini")));
@@ -804,6 +529,21 @@ void SUEAIAgentPanel::Construct(const FArguments& InArgs)
                     ]
                 ]
                 + SVerticalBox::Slot()
+                .AutoHeight()
+                .HAlign(HAlign_Center)
+                .Padding(0.0f, 0.0f, 0.0f, 4.0f)
+                [
+                    SNew(SButton)
+                    .Text(FText::FromString(TEXT("Load earlier messages")))
+                    .Visibility_Lambda([this]()
+                    {
+                        return !bIsLoadingHistory && FUEAIAgentTransportModule::Get().HasOlderActiveChatHistory()
+                            ? EVisibility::Visible
+                            : EVisibility::Collapsed;
+                    })
+                    .OnClicked(this, &SUEAIAgentPanel::OnLoadOlderHistoryClicked)
+                ]
+                + SVerticalBox::Slot()
                 .FillHeight(1.0f)
                 [
                     SNew(SBorder)
@@ -1057,6 +797,10 @@ void SUEAIAgentPanel::Construct(const FArguments& InArgs)
                     [
                         SNew(SButton)
                         .Text(FText::FromString(TEXT("Apply")))
+                        .IsEnabled_Lambda([]()
+                        {
+                            return !FUEAIAgentSceneTools::IsTimeSlicedBatchRunning();
+                        })
                         .OnClicked(this, &SUEAIAgentPanel::OnApplyPlannedActionClicked)
                     ]
                 ]
@@ -1219,12 +963,21 @@ void SUEAIAgentPanel::Construct(const FArguments& InArgs)
         HandlePromptTextChanged(PromptInput->GetText());
     }
 
-    FUEAIAgentTransportModule::Get().CheckHealth(FOnUEAIAgentHealthChecked::CreateSP(
+    FUEAIAgentTransportModule& Transport = FUEAIAgentTransportModule::Get();
+    Transport.OnHealthChanged().AddSP(this, &SUEAIAgentPanel::HandleHealthResult);
+    Transport.OnChatsChanged().AddSP(this, &SUEAIAgentPanel::HandleChatsChanged);
+    Transport.ConnectEventChannel();
+    Transport.CheckHealth(FOnUEAIAgentHealthChecked::CreateSP(
         this,
         &SUEAIAgentPanel::HandleHealthResult));
-    RegisterActiveTimer(10.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SUEAIAgentPanel::HandleHealthTimer));
-    RegisterActiveTimer(0.75f, FWidgetActiveTimerDelegate::CreateSP(this, &SUEAIAgentPanel::HandleSelectionTimer));
-    UpdateSelectionSummaryText();
+    USelection::SelectionChangedEvent.AddSP(this, &SUEAIAgentPanel::HandleEditorSelectionChanged);
+    USelection::SelectObjectEvent.AddSP(this, &SUEAIAgentPanel::HandleEditorObjectSelected);
+    FCoreDelegates::OnActorLabelChanged.AddSP(this, &SUEAIAgentPanel::HandleActorLabelChanged);
+    if (GEngine)
+    {
+        GEngine->OnLevelActorDeleted().AddSP(this, &SUEAIAgentPanel::HandleLevelActorDeleted);
+    }
+    RebuildSelectedActors();
     UpdateChatListStateText();
     UpdateHistoryStateText();
     OnRefreshChatsClicked();
@@ -1455,6 +1208,7 @@ void SUEAIAgentPanel::RunWithActiveChat(
         {
             PlanText->SetText(FText::FromString(TEXT("Agent: starting session...")));
         }
+        LastAgentActionResult.Reset();
         Transport.StartSession(
             Prompt,
             TEXT("agent"),
@@ -1529,14 +1283,14 @@ bool SUEAIAgentPanel::TryRestoreLatestChatFromTransport()
         return true;
     }
 
-    const TArray<FUEAIAgentChatSummary>& Chats = Transport.GetChats();
-    if (Chats.Num() == 0)
+    const TSharedRef<const TArray<FUEAIAgentChatSummary>> Chats = Transport.GetChats();
+    if (Chats->Num() == 0)
     {
         return false;
     }
 
-    const FUEAIAgentChatSummary* LatestChat = &Chats[0];
-    for (const FUEAIAgentChatSummary& Chat : Chats)
+    const FUEAIAgentChatSummary* LatestChat = &(*Chats)[0];
+    for (const FUEAIAgentChatSummary& Chat : *Chats)
     {
         if (Chat.LastActivityAt > LatestChat->LastActivityAt)
         {
@@ -1568,7 +1322,7 @@ FReply SUEAIAgentPanel::OnCreateChatClicked()
     }
 
     FUEAIAgentTransportModule& Transport = FUEAIAgentTransportModule::Get();
-    if (!Transport.GetActiveChatId().IsEmpty() && Transport.GetActiveChatHistory().Num() == 0)
+    if (!Transport.GetActiveChatId().IsEmpty() && Transport.GetActiveChatHistory()->Num() == 0)
     {
         return FReply::Handled();
     }
@@ -1723,7 +1477,7 @@ void SUEAIAgentPanel::PersistPreferredModels()
     TArray<FUEAIAgentModelOption> SelectedModels;
     const FString CurrentProvider = GetSelectedProviderCode();
 
-    for (const FUEAIAgentModelOption& Existing : Transport.GetPreferredModels())
+    for (const FUEAIAgentModelOption& Existing : *Transport.GetPreferredModels())
     {
         if (!Existing.Provider.Equals(CurrentProvider, ESearchCase::IgnoreCase))
         {
@@ -1784,15 +1538,48 @@ FReply SUEAIAgentPanel::OnApplyPlannedActionClicked()
         return FReply::Handled();
     }
 
+    FString StartMessage;
+    const bool bStarted = FUEAIAgentSceneTools::ExecuteBatchTimeSliced(
+        MoveTemp(ApprovedActions),
+        FOnUEAIAgentBatchProgress::CreateSP(this, &SUEAIAgentPanel::HandleApplyProgress),
+        FOnUEAIAgentBatchFinished::CreateSP(this, &SUEAIAgentPanel::HandleApplyFinished),
+        StartMessage);
+    if (!bStarted)
+    {
+        PlanText->SetText(FText::FromString(FString::Printf(TEXT("Execute: error\n%s"), *StartMessage)));
+    }
+
+    return FReply::Handled();
+}
+
+void SUEAIAgentPanel::HandleApplyProgress(const FUEAIAgentBatchProgress& Progress)
+{
+    if (!PlanText.IsValid() || Progress.ActionIndex >= Progress.ActionCount)
+    {
+        return;
+    }
+
+    FString ProgressMessage = FString::Printf(TEXT("Applying: action %d/%d"), Progress.ActionIndex + 1, Progress.ActionCount);
+    if (Progress.TargetCount > 0)
+    {
+        ProgressMessage += FString::Printf(TEXT(", %d/%d target(s)"), Progress.ProcessedTargets, Progress.TargetCount);
+    }
+    PlanText->SetText(FText::FromString(ProgressMessage));
+}
+
+void SUEAIAgentPanel::HandleApplyFinished(bool bAllOk, const TArray<FUEAIAgentToolResult>& Results)
+{
+    if (!PlanText.IsValid())
+    {
+        return;
+    }
+
     int32 SuccessCount = 0;
     int32 FailedCount = 0;
     FString FirstFailureReason;
-    for (const FUEAIAgentPlannedSceneAction& PlannedAction : ApprovedActions)
+    for (const FUEAIAgentToolResult& Result : Results)
     {
-        FString ResultMessage;
-        const bool bOk = ExecutePlannedAction(PlannedAction, ResultMessage);
-
-        if (bOk)
+        if (Result.bOk)
         {
             ++SuccessCount;
             continue;
@@ -1801,13 +1588,12 @@ FReply SUEAIAgentPanel::OnApplyPlannedActionClicked()
         ++FailedCount;
         if (FirstFailureReason.IsEmpty())
         {
-            const FString NormalizedReason = NormalizeSingleLineStatusText(ResultMessage);
-            FirstFailureReason = NormalizedReason.IsEmpty() ? TEXT("operation could not be applied.") : NormalizedReason;
+            FirstFailureReason = DescribeToolFailure(Result);
         }
     }
 
     UpdateActionApprovalUi();
-    if (FailedCount == 0 && SuccessCount == ApprovedActions.Num())
+    if (FailedCount == 0 && SuccessCount == Results.Num())
     {
         const FString StatusMessage = TEXT("Completed.");
         PlanText->SetText(FText::FromString(StatusMessage));
@@ -1816,9 +1602,9 @@ FReply SUEAIAgentPanel::OnApplyPlannedActionClicked()
     else
     {
         FString StatusMessage;
-        if (ApprovedActions.Num() > 1)
+        if (Results.Num() > 1)
         {
-            StatusMessage = FString::Printf(TEXT("Failed: %d of %d action(s) failed. %s"), FailedCount, ApprovedActions.Num(), *FirstFailureReason);
+            StatusMessage = FString::Printf(TEXT("Failed: %d of %d action(s) failed. %s"), FailedCount, Results.Num(), *FirstFailureReason);
         }
         else
         {
@@ -1828,7 +1614,12 @@ FReply SUEAIAgentPanel::OnApplyPlannedActionClicked()
         AppendChatOutcomeToHistory(StatusMessage);
     }
 
-    return FReply::Handled();
+    if (DeferredSessionMessage.IsSet())
+    {
+        const FString SessionMessage = DeferredSessionMessage.GetValue();
+        DeferredSessionMessage.Reset();
+        HandleSessionUpdate(true, SessionMessage);
+    }
 }
 
 FReply SUEAIAgentPanel::OnCancelPlannedActionClicked()
@@ -2054,22 +1845,27 @@ void SUEAIAgentPanel::HandleSessionUpdate(bool bOk, const FString& Message)
     CurrentSessionStatus = ParseSessionStatusFromMessage(Message);
     if (CurrentSessionStatus == ESessionStatus::Failed)
     {
-        const FString DecisionMessage = ExtractDecisionMessageBody(Message);
-        if (IsUserCanceledSessionMessage(DecisionMessage))
+        const FString StopCondition = Transport.GetSessionStopCondition();
+        if (StopCondition.Equals(TEXT("user_denied"), ESearchCase::IgnoreCase))
         {
             PlanText->SetText(FText::FromString(TEXT("Canceled")));
         }
         else
         {
-            const FString Reason = ExtractFailedReasonFromSessionMessage(Message);
-            if (Reason.IsEmpty())
+            FString Reason;
+            if (!StopCondition.IsEmpty())
             {
-                PlanText->SetText(FText::FromString(TEXT("Failed")));
+                Reason = FString::Printf(TEXT("stopped by %s."), *StopCondition.Replace(TEXT("_"), TEXT(" ")).ToLower());
+            }
+            else if (LastAgentActionResult.IsSet() && !LastAgentActionResult->bOk)
+            {
+                Reason = DescribeToolFailure(LastAgentActionResult.GetValue());
             }
             else
             {
-                PlanText->SetText(FText::FromString(FString::Printf(TEXT("Failed: %s"), *Reason)));
+                Reason = TEXT("an action failed.");
             }
+            PlanText->SetText(FText::FromString(FString::Printf(TEXT("Failed: %s"), *Reason)));
         }
         RefreshActiveChatHistory();
         return;
@@ -2110,21 +1906,52 @@ void SUEAIAgentPanel::HandleSessionUpdate(bool bOk, const FString& Message)
         return;
     }
 
-    FString ExecuteMessage;
-    const bool bOkExecute = ExecutePlannedAction(NextAction, ExecuteMessage);
-    if (!bOkExecute)
+    if (FUEAIAgentSceneTools::IsTimeSlicedBatchRunning())
+    {
+        DeferredSessionMessage = Message;
+        PlanText->SetText(FText::FromString(TEXT("Agent: waiting for the applied plan to finish...")));
+        return;
+    }
+
+    // Runs as a one-action batch so large agent edits are sliced across ticks like applied plans.
+    FString StartMessage;
+    TArray<FUEAIAgentPlannedSceneAction> AgentActions;
+    AgentActions.Add(MoveTemp(NextAction));
+    const bool bStarted = FUEAIAgentSceneTools::ExecuteBatchTimeSliced(
+        MoveTemp(AgentActions),
+        FOnUEAIAgentBatchProgress::CreateSP(this, &SUEAIAgentPanel::HandleApplyProgress),
+        FOnUEAIAgentBatchFinished::CreateSP(this, &SUEAIAgentPanel::HandleAgentActionFinished),
+        StartMessage);
+    if (!bStarted)
+    {
+        CurrentSessionStatus = ESessionStatus::AwaitingApproval;
+        UpdateActionApprovalUi();
+        PlanText->SetText(FText::FromString(FString::Printf(TEXT("Agent: local execute failed\n%s\nClick Resume to retry."), *StartMessage)));
+    }
+}
+
+void SUEAIAgentPanel::HandleAgentActionFinished(bool bAllOk, const TArray<FUEAIAgentToolResult>& Results)
+{
+    if (!PlanText.IsValid() || Results.IsEmpty())
+    {
+        return;
+    }
+
+    // The next session step supersedes anything that arrived while the action ran.
+    DeferredSessionMessage.Reset();
+    const FUEAIAgentToolResult& ExecuteResult = Results[0];
+    LastAgentActionResult = ExecuteResult;
+    if (!bAllOk)
     {
         CurrentSessionStatus = ESessionStatus::AwaitingApproval;
         UpdateActionApprovalUi();
-        PlanText->SetText(FText::FromString(TEXT("Agent: local execute failed\n") + ExecuteMessage + TEXT("\nFix selection/target and click Resume.")));
+        PlanText->SetText(FText::FromString(TEXT("Agent: local execute failed\n") + DescribeToolFailure(ExecuteResult) + TEXT("\nFix selection/target and click Resume.")));
         return;
     }
 
     PlanText->SetText(FText::FromString(TEXT("Agent: action executed, syncing...")));
-    Transport.NextSession(
-        true,
-        true,
-        ExecuteMessage,
+    FUEAIAgentTransportModule::Get().NextSession(
+        &ExecuteResult,
         FOnUEAIAgentSessionUpdated::CreateSP(this, &SUEAIAgentPanel::HandleSessionUpdate));
 }
 
@@ -2163,191 +1990,6 @@ SUEAIAgentPanel::ESessionStatus SUEAIAgentPanel::ParseSessionStatusFromMessage(c
     return ESessionStatus::Unknown;
 }
 
-bool SUEAIAgentPanel::ExecutePlannedAction(const FUEAIAgentPlannedSceneAction& PlannedAction, FString& OutMessage) const
-{
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SessionBeginTransaction)
-    {
-        return FUEAIAgentSceneTools::SessionBeginTransaction(PlannedAction.TransactionDescription, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SessionCommitTransaction)
-    {
-        return FUEAIAgentSceneTools::SessionCommitTransaction(OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SessionRollbackTransaction)
-    {
-        return FUEAIAgentSceneTools::SessionRollbackTransaction(OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::CreateActor)
-    {
-        FUEAIAgentCreateActorParams Params;
-        Params.ActorClass = PlannedAction.ActorClass;
-        Params.Location = PlannedAction.SpawnLocation;
-        Params.Rotation = PlannedAction.SpawnRotation;
-        Params.Count = PlannedAction.SpawnCount;
-        return FUEAIAgentSceneTools::SceneCreateActor(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::DeleteActor)
-    {
-        FUEAIAgentDeleteActorParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped delete action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneDeleteActor(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::ModifyComponent)
-    {
-        FUEAIAgentModifyComponentParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.ComponentName = PlannedAction.ComponentName;
-        Params.DeltaLocation = PlannedAction.ComponentDeltaLocation;
-        Params.DeltaRotation = PlannedAction.ComponentDeltaRotation;
-        Params.DeltaScale = PlannedAction.ComponentDeltaScale;
-        Params.Scale = PlannedAction.ComponentScale;
-        Params.bHasScale = PlannedAction.bComponentHasScale;
-        Params.bSetVisibility = PlannedAction.bComponentVisibilityEdit;
-        Params.bVisible = PlannedAction.bComponentVisible;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped component action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneModifyComponent(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::AddActorTag)
-    {
-        FUEAIAgentAddActorTagParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.Tag = PlannedAction.ActorTag;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped tag action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneAddActorTag(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SetComponentMaterial)
-    {
-        FUEAIAgentSetComponentMaterialParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.ComponentName = PlannedAction.ComponentName;
-        Params.MaterialPath = PlannedAction.MaterialPath;
-        Params.MaterialSlot = PlannedAction.MaterialSlot;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped material action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneSetComponentMaterial(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SetComponentStaticMesh)
-    {
-        FUEAIAgentSetComponentStaticMeshParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.ComponentName = PlannedAction.ComponentName;
-        Params.MeshPath = PlannedAction.MeshPath;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped mesh action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneSetComponentStaticMesh(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SetActorFolder)
-    {
-        FUEAIAgentSetActorFolderParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.FolderPath = PlannedAction.FolderPath;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped folder action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneSetActorFolder(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::AddActorLabelPrefix)
-    {
-        FUEAIAgentAddActorLabelPrefixParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.Prefix = PlannedAction.LabelPrefix;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped label prefix action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneAddActorLabelPrefix(Params, OutMessage);
-    }
-
-    if (PlannedAction.Type == EUEAIAgentPlannedActionType::DuplicateActors)
-    {
-        FUEAIAgentDuplicateActorsParams Params;
-        Params.ActorNames = PlannedAction.ActorNames;
-        Params.Count = PlannedAction.DuplicateCount;
-        Params.Offset = PlannedAction.DuplicateOffset;
-        Params.bUseSelectionIfActorNamesEmpty = false;
-        if (Params.ActorNames.IsEmpty())
-        {
-            OutMessage = TEXT("Skipped duplicate action with no target actors.");
-            return false;
-        }
-        return FUEAIAgentSceneTools::SceneDuplicateActors(Params, OutMessage);
-    }
-
-    FUEAIAgentModifyActorParams Params;
-    Params.ActorNames = PlannedAction.ActorNames;
-    Params.DeltaLocation = PlannedAction.DeltaLocation;
-    Params.DeltaRotation = PlannedAction.DeltaRotation;
-    Params.DeltaScale = PlannedAction.DeltaScale;
-    Params.Scale = PlannedAction.Scale;
-    Params.bHasScale = PlannedAction.bHasScale;
-    Params.bUseSelectionIfActorNamesEmpty = false;
-    if (Params.ActorNames.IsEmpty())
-    {
-        OutMessage = TEXT("Skipped modify action with no target actors.");
-        return false;
-    }
-    const bool bOkModifyByName = FUEAIAgentSceneTools::SceneModifyActor(Params, OutMessage);
-    if (bOkModifyByName)
-    {
-        return true;
-    }
-
-    // Fallback for planner byName misses when the user's active selection is the intended target.
-    if (OutMessage.Contains(TEXT("No target actors found."), ESearchCase::IgnoreCase))
-    {
-        Params.ActorNames.Empty();
-        Params.bUseSelectionIfActorNamesEmpty = true;
-        FString FallbackMessage;
-        const bool bOkSelectionFallback = FUEAIAgentSceneTools::SceneModifyActor(Params, FallbackMessage);
-        if (bOkSelectionFallback)
-        {
-            OutMessage = FString::Printf(TEXT("%s (fallback: used current selection)"), *FallbackMessage);
-            return true;
-        }
-    }
-
-    return false;
-}
-
 void SUEAIAgentPanel::AppendChatOutcomeToHistory(const FString& OutcomeText)
 {
     const FString NormalizedStatus = NormalizeSingleLineStatusText(OutcomeText);
@@ -2435,13 +2077,17 @@ void SUEAIAgentPanel::HandleChatHistoryResult(bool bOk, const FString& Message)
     UpdateHistoryStateText();
 }
 
+void SUEAIAgentPanel::HandleChatsChanged()
+{
+    RefreshChatUiFromTransport(true);
+}
+
 void SUEAIAgentPanel::RefreshChatUiFromTransport(bool bKeepCurrentSelection)
 {
     FUEAIAgentTransportModule& Transport = FUEAIAgentTransportModule::Get();
     const FString PreviousActiveId = Transport.GetActiveChatId();
 
-    RebuildChatListItems();
-    if (ChatListView.IsValid())
+    if (RebuildChatListItems() && ChatListView.IsValid())
     {
         ChatListView->RequestListRefresh();
     }
@@ -2487,13 +2133,10 @@ void SUEAIAgentPanel::RefreshChatUiFromTransport(bool bKeepCurrentSelection)
     UpdateHistoryStateText();
 }
 
-void SUEAIAgentPanel::RebuildChatListItems()
+bool SUEAIAgentPanel::RebuildChatListItems()
 {
-    ChatListItems.Empty();
-    ChatTitleEditors.Empty();
-
     FUEAIAgentTransportModule& Transport = FUEAIAgentTransportModule::Get();
-    TArray<FUEAIAgentChatSummary> Chats = Transport.GetChats();
+    TArray<FUEAIAgentChatSummary> Chats = *Transport.GetChats();
     Chats.Sort([](const FUEAIAgentChatSummary& Left, const FUEAIAgentChatSummary& Right)
     {
         if (Left.LastActivityAt != Right.LastActivityAt)
@@ -2503,8 +2146,14 @@ void SUEAIAgentPanel::RebuildChatListItems()
         return Left.Id < Right.Id;
     });
 
+    // Unchanged chats keep their item, so the list keeps their row widgets and title editors.
+    const TMap<FString, TSharedPtr<FUEAIAgentChatSummary>> ExistingById = MapItemsById(ChatListItems);
+    TSet<FString> ListedIds;
+
     const FString FilterLower = ChatSearchFilter.ToLower();
-    for (const FUEAIAgentChatSummary& Chat : Chats)
+    TArray<TSharedPtr<FUEAIAgentChatSummary>> NewItems;
+    NewItems.Reserve(Chats.Num());
+    for (FUEAIAgentChatSummary& Chat : Chats)
     {
         if (!FilterLower.IsEmpty())
         {
@@ -2514,27 +2163,90 @@ void SUEAIAgentPanel::RebuildChatListItems()
                 continue;
             }
         }
-        ChatListItems.Add(MakeShared<FUEAIAgentChatSummary>(Chat));
+
+        ListedIds.Add(Chat.Id);
+        const TSharedPtr<FUEAIAgentChatSummary>* Existing = ExistingById.Find(Chat.Id);
+        if (Existing && IsSameChatSummary(**Existing, Chat))
+        {
+            NewItems.Add(*Existing);
+            continue;
+        }
+
+        // A changed chat gets a new row, which registers its own title editor.
+        ChatTitleEditors.Remove(Chat.Id);
+        NewItems.Add(MakeShared<FUEAIAgentChatSummary>(MoveTemp(Chat)));
+    }
+
+    // Deleted, archived or filtered-out chats lose their row, and with it their title editor.
+    for (auto It = ChatTitleEditors.CreateIterator(); It; ++It)
+    {
+        if (!ListedIds.Contains(It.Key()))
+        {
+            It.RemoveCurrent();
+        }
     }
+
+    if (NewItems == ChatListItems)
+    {
+        return false;
+    }
+
+    ChatListItems = MoveTemp(NewItems);
+    return true;
 }
 
 void SUEAIAgentPanel::RebuildHistoryItems()
 {
-    ChatHistoryItems.Empty();
     FUEAIAgentTransportModule& Transport = FUEAIAgentTransportModule::Get();
-    const TArray<FUEAIAgentChatHistoryEntry>& Entries = Transport.GetActiveChatHistory();
-    for (const FUEAIAgentChatHistoryEntry& Entry : Entries)
+    const TSharedRef<const FUEAIAgentChatHistoryView> Entries = Transport.GetActiveChatHistory();
+
+    // Stored entries never change, so every row already on screen is kept. Prompts shown before
+    // Agent Core stored them have no id and are replaced by the stored copy here.
+    const TMap<FString, TSharedPtr<FUEAIAgentChatHistoryEntry>> ExistingById = MapItemsById(ChatHistoryItems);
+
+    TArray<TSharedPtr<FUEAIAgentChatHistoryEntry>> NewItems;
+    TArray<FString> NewAssistantTexts;
+    NewItems.Reserve(Entries->Num());
+    for (const TSharedRef<const FUEAIAgentChatHistoryEntry>& EntryRef : *Entries)
     {
-        ChatHistoryItems.Add(MakeShared<FUEAIAgentChatHistoryEntry>(Entry));
+        const FUEAIAgentChatHistoryEntry& Entry = *EntryRef;
+        const TSharedPtr<FUEAIAgentChatHistoryEntry>* Existing = Entry.Id.IsEmpty() ? nullptr : ExistingById.Find(Entry.Id);
+        if (Existing)
+        {
+            NewItems.Add(*Existing);
+            continue;
+        }
+
+        NewItems.Add(MakeShared<FUEAIAgentChatHistoryEntry>(Entry));
+        if (!IsUserHistoryEntry(Entry))
+        {
+            NewAssistantTexts.Add(GetHistoryMessageText(Entry));
+        }
     }
 
+    // Parse new answers off the game thread before their rows are generated while scrolling.
+    RichTextCache->Prepare(MoveTemp(NewAssistantTexts));
+
+    if (NewItems == ChatHistoryItems)
+    {
+        return;
+    }
+
+    const TSharedPtr<FUEAIAgentChatHistoryEntry> PreviousLast = ChatHistoryItems.Num() > 0 ? ChatHistoryItems.Last() : nullptr;
+    ChatHistoryItems = MoveTemp(NewItems);
     if (MainChatHistoryListView.IsValid())
     {
         MainChatHistoryListView->RequestListRefresh();
     }
 
+    // Only older pages were added; keep the reader where they are.
+    if (ChatHistoryItems.Num() == 0 || ChatHistoryItems.Last() == PreviousLast)
+    {
+        return;
+    }
+
     ScrollHistoryViewsToBottom();
-    if (!bHistoryAutoScrollPending && ChatHistoryItems.Num() > 0)
+    if (!bHistoryAutoScrollPending)
     {
         bHistoryAutoScrollPending = true;
         RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SUEAIAgentPanel::HandleDeferredHistoryScroll));
@@ -2580,6 +2292,16 @@ void SUEAIAgentPanel::RefreshActiveChatHistory()
     Transport.LoadActiveChatHistory(0, FOnUEAIAgentChatOpFinished::CreateSP(this, &SUEAIAgentPanel::HandleChatHistoryResult));
 }
 
+FReply SUEAIAgentPanel::OnLoadOlderHistoryClicked()
+{
+    bIsLoadingHistory = true;
+    HistoryErrorMessage.Reset();
+    UpdateHistoryStateText();
+    FUEAIAgentTransportModule::Get().LoadOlderActiveChatHistory(
+        FOnUEAIAgentChatOpFinished::CreateSP(this, &SUEAIAgentPanel::HandleChatHistoryResult));
+    return FReply::Handled();
+}
+
 EActiveTimerReturnType SUEAIAgentPanel::HandleDeferredHistoryScroll(double InCurrentTime, float InDeltaTime)
 {
     (void)InCurrentTime;
@@ -2592,19 +2314,127 @@ EActiveTimerReturnType SUEAIAgentPanel::HandleDeferredHistoryScroll(double InCur
 
 void SUEAIAgentPanel::UpdateSelectionSummaryText()
 {
-    const FString NewSummary = BuildSelectionSummary();
-    if (CachedSelectionSummary == NewSummary)
+    if (DisplayedSelectionVersion == SelectionVersion)
     {
         return;
     }
 
-    CachedSelectionSummary = NewSummary;
+    DisplayedSelectionVersion = SelectionVersion;
     if (SelectionSummaryText.IsValid())
     {
-        SelectionSummaryText->SetText(FText::FromString(NewSummary));
+        SelectionSummaryText->SetText(FText::FromString(BuildSelectionSummary()));
     }
 }
 
+void SUEAIAgentPanel::HandleEditorSelectionChanged(UObject* ChangedSelection)
+{
+    // Fired for every selection set (assets, components, ...) and once at the end of a batch.
+    USelection* ActorSelection = GEditor ? GEditor->GetSelectedActors() : nullptr;
+    if (ChangedSelection && ChangedSelection != ActorSelection)
+    {
+        return;
+    }
+
+    RebuildSelectedActors();
+}
+
+void SUEAIAgentPanel::HandleEditorObjectSelected(UObject* ChangedObject)
+{
+    USelection* ActorSelection = GEditor ? GEditor->GetSelectedActors() : nullptr;
+    const AActor* Actor = Cast<AActor>(ChangedObject);
+    if (!ActorSelection || !Actor || ActorSelection->IsBatchSelecting())
+    {
+        // A batch ends with SelectionChangedEvent, which rebuilds once.
+        return;
+    }
+
+    const int32 ExistingIndex = SelectedActors.IndexOfByPredicate([Actor](const FSelectedActor& Entry)
+    {
+        return Entry.Actor.Get() == Actor;
+    });
+    const bool bSelected = ActorSelection->IsSelected(Actor);
+    if (bSelected && ExistingIndex == INDEX_NONE)
+    {
+        SelectedActors.Add({ Actor, Actor->GetName() });
+    }
+    else if (!bSelected && ExistingIndex != INDEX_NONE)
+    {
+        SelectedActors.RemoveAt(ExistingIndex);
+    }
+    else
+    {
+        return;
+    }
+
+    ++SelectionVersion;
+    UpdateSelectionSummaryText();
+}
+
+void SUEAIAgentPanel::HandleActorLabelChanged(AActor* Actor)
+{
+    // Relabeling can rename the actor object too, which changes the names sent to Agent Core.
+    for (FSelectedActor& Entry : SelectedActors)
+    {
+        if (Entry.Actor.Get() != Actor)
+        {
+            continue;
+        }
+
+        FString NewName = Actor->GetName();
+        if (Entry.Name != NewName)
+        {
+            Entry.Name = MoveTemp(NewName);
+            ++SelectionVersion;
+            UpdateSelectionSummaryText();
+        }
+        return;
+    }
+}
+
+void SUEAIAgentPanel::HandleLevelActorDeleted(AActor* Actor)
+{
+    // Deleting a selected actor does not always deselect it first.
+    const int32 Removed = SelectedActors.RemoveAll([Actor](const FSelectedActor& Entry)
+    {
+        return Entry.Actor.Get() == Actor;
+    });
+    if (Removed > 0)
+    {
+        ++SelectionVersion;
+        UpdateSelectionSummaryText();
+    }
+}
+
+void SUEAIAgentPanel::RebuildSelectedActors()
+{
+    TArray<FSelectedActor> NewSelection;
+    if (GEditor)
+    {
+        for (FSelectionIterator It(*GEditor->GetSelectedActors()); It; ++It)
+        {
+            if (const AActor* Actor = Cast<AActor>(*It))
+            {
+                NewSelection.Add({ Actor, Actor->GetName() });
+            }
+        }
+    }
+
+    bool bChanged = NewSelection.Num() != SelectedActors.Num();
+    for (int32 Index = 0; !bChanged && Index < NewSelection.Num(); ++Index)
+    {
+        bChanged = NewSelection[Index].Actor != SelectedActors[Index].Actor ||
+            NewSelection[Index].Name != SelectedActors[Index].Name;
+    }
+    if (!bChanged)
+    {
+        return;
+    }
+
+    SelectedActors = MoveTemp(NewSelection);
+    ++SelectionVersion;
+    UpdateSelectionSummaryText();
+}
+
 void SUEAIAgentPanel::UpdateChatListStateText()
 {
     if (!ChatListStateText.IsValid())
@@ -2890,10 +2720,8 @@ TSharedRef<ITableRow> SUEAIAgentPanel::HandleGenerateChatHistoryRow(
         ];
     }
 
-    const bool bIsUserMessage = InItem->DisplayRole.Equals(TEXT("user"), ESearchCase::IgnoreCase) ||
-        (InItem->DisplayRole.IsEmpty() && InItem->Kind.Equals(TEXT("asked"), ESearchCase::IgnoreCase));
-    const FString MessageText = InItem->DisplayText.IsEmpty() ? InItem->Summary : InItem->DisplayText;
-    const FString RichMessageText = bIsUserMessage ? MessageText : ConvertMarkdownToRichText(MessageText);
+    const bool bIsUserMessage = IsUserHistoryEntry(*InItem);
+    const FString& MessageText = GetHistoryMessageText(*InItem);
 
     if (bIsUserMessage)
     {
@@ -2923,7 +2751,10 @@ TSharedRef<ITableRow> SUEAIAgentPanel::HandleGenerateChatHistoryRow(
         ];
     }
 
+    const FString RichMessageText = RichTextCache->GetMarkup(MessageText);
     TSharedPtr<ITextLayoutMarshaller> MarkdownMarshaller = FRichTextLayoutMarshaller::Create(
+        RichTextCache->GetParser(),
+        FDefaultRichTextMarkupWriter::Create(),
         TArray<TSharedRef<ITextDecorator>>(),
         &GetChatMarkdownStyle());
 
@@ -2986,13 +2817,14 @@ void SUEAIAgentPanel::TryRestoreRunSelectionsFromHistory()
     }
     bPendingRunSelectionRestore = false;
 
-    const TArray<FUEAIAgentChatHistoryEntry>& Entries = FUEAIAgentTransportModule::Get().GetActiveChatHistory();
+    const TSharedRef<const FUEAIAgentChatHistoryView> History = FUEAIAgentTransportModule::Get().GetActiveChatHistory();
+    const FUEAIAgentChatHistoryView& Entries = *History;
     FString RestoredProvider;
     FString RestoredModel;
     FString RestoredChatType;
     for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
     {
-        const FUEAIAgentChatHistoryEntry& Entry = Entries[Index];
+        const FUEAIAgentChatHistoryEntry& Entry = *Entries[Index];
         if (RestoredProvider.IsEmpty() && !Entry.Provider.IsEmpty())
         {
             RestoredProvider = Entry.Provider.TrimStartAndEnd().ToLower();
@@ -3434,20 +3266,15 @@ void SUEAIAgentPanel::RebuildActionApprovalUi()
 TArray<FString> SUEAIAgentPanel::CollectSelectedActorNames() const
 {
     TArray<FString> Names;
-    if (!GEditor)
+    Names.Reserve(SelectedActors.Num());
+    for (const FSelectedActor& Entry : SelectedActors)
     {
-        return Names;
-    }
-
-    for (FSelectionIterator It(*GEditor->GetSelectedActors()); It; ++It)
-    {
-        const AActor* Actor = Cast<AActor>(*It);
-        if (Actor)
+        // Actors destroyed without a deletion notification (level unload, undo) must not be sent.
+        if (Entry.Actor.IsValid())
         {
-            Names.Add(Actor->GetName());
+            Names.Add(Entry.Name);
         }
     }
-
     return Names;
 }
 
@@ -3582,8 +3409,10 @@ FString SUEAIAgentPanel::BuildModelOptionKey(const FUEAIAgentModelOption& Option
 void SUEAIAgentPanel::RebuildModelUi()
 {
     FUEAIAgentTransportModule& Transport = FUEAIAgentTransportModule::Get();
-    const TArray<FUEAIAgentModelOption>& Available = Transport.GetAvailableModels();
-    const TArray<FUEAIAgentModelOption>& Preferred = Transport.GetPreferredModels();
+    const TSharedRef<const TArray<FUEAIAgentModelOption>> AvailableSnapshot = Transport.GetAvailableModels();
+    const TSharedRef<const TArray<FUEAIAgentModelOption>> PreferredSnapshot = Transport.GetPreferredModels();
+    const TArray<FUEAIAgentModelOption>& Available = *AvailableSnapshot;
+    const TArray<FUEAIAgentModelOption>& Preferred = *PreferredSnapshot;
     const FString PreviousSelection = SelectedModelItem.IsValid() ? *SelectedModelItem : FString();
 
     ModelItems.Empty();
@@ -3730,20 +3559,3 @@ FReply SUEAIAgentPanel::HandlePromptKeyDown(const FGeometry& MyGeometry, const F
     return FReply::Unhandled();
 }
 
-EActiveTimerReturnType SUEAIAgentPanel::HandleHealthTimer(double InCurrentTime, float InDeltaTime)
-{
-    (void)InCurrentTime;
-    (void)InDeltaTime;
-    FUEAIAgentTransportModule::Get().CheckHealth(FOnUEAIAgentHealthChecked::CreateSP(
-        this,
-        &SUEAIAgentPanel::HandleHealthResult));
-    return EActiveTimerReturnType::Continue;
-}
-
-EActiveTimerReturnType SUEAIAgentPanel::HandleSelectionTimer(double InCurrentTime, float InDeltaTime)
-{
-    (void)InCurrentTime;
-    (void)InDeltaTime;
-    UpdateSelectionSummaryText();
-    return EActiveTimerReturnType::Continue;
-}
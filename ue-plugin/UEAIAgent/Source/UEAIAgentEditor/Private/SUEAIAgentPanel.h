@@ -17,6 +17,9 @@ class SButton;
 class SInlineEditableTextBlock;
 class ITableRow;
 class STableViewBase;
+class FUEAIAgentRichTextCache;
+class AActor;
+class UObject;
 template<typename ItemType>
 class SListView;
 template<typename OptionType>
@@ -27,6 +30,7 @@ enum class ECheckBoxState : uint8;
 struct FUEAIAgentPlannedSceneAction;
 struct FUEAIAgentChatSummary;
 struct FUEAIAgentChatHistoryEntry;
+struct FUEAIAgentBatchProgress;
 
 class SUEAIAgentPanel : public SCompoundWidget
 {
@@ -36,6 +40,8 @@ public:
     }
     SLATE_END_ARGS()
 
+    virtual ~SUEAIAgentPanel() override;
+
     void Construct(const FArguments& InArgs);
     virtual bool SupportsKeyboardFocus() const override;
     virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
@@ -73,11 +79,16 @@ private:
     FReply OnCancelPlannedActionClicked();
     FReply OnApproveLowRiskClicked();
     FReply OnRejectAllClicked();
+    FReply OnLoadOlderHistoryClicked();
     void HandleHealthResult(bool bOk, const FString& Message);
     void HandleCredentialOperationResult(bool bOk, const FString& Message);
     void HandlePlanResult(bool bOk, const FString& Message);
     void HandleSessionUpdate(bool bOk, const FString& Message);
+    void HandleApplyProgress(const FUEAIAgentBatchProgress& Progress);
+    void HandleApplyFinished(bool bAllOk, const TArray<FUEAIAgentToolResult>& Results);
+    void HandleAgentActionFinished(bool bAllOk, const TArray<FUEAIAgentToolResult>& Results);
     void HandleChatOperationResult(bool bOk, const FString& Message);
+    void HandleChatsChanged();
     void HandleChatHistoryResult(bool bOk, const FString& Message);
     void HandleActionApprovalChanged(int32 ActionIndex, ECheckBoxState NewState);
     void HandleChatSelectionChanged(TSharedPtr<FUEAIAgentChatSummary> InItem, ESelectInfo::Type SelectInfo);
@@ -133,7 +144,8 @@ private:
     FString BuildModelItemLabel(const FUEAIAgentModelOption& Option) const;
     FReply HandlePromptKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent);
     void RefreshChatUiFromTransport(bool bKeepCurrentSelection);
-    void RebuildChatListItems();
+    // Returns whether the visible items changed.
+    bool RebuildChatListItems();
     void RebuildHistoryItems();
     void ScrollHistoryViewsToBottom();
     void RefreshActiveChatHistory();
@@ -147,12 +159,14 @@ private:
     ESessionStatus ParseSessionStatusFromMessage(const FString& Message) const;
     void UpdateActionApprovalUi();
     void RebuildActionApprovalUi();
-    bool ExecutePlannedAction(const FUEAIAgentPlannedSceneAction& PlannedAction, FString& OutMessage) const;
     void AppendChatOutcomeToHistory(const FString& OutcomeText);
     TArray<FString> CollectSelectedActorNames() const;
     EActiveTimerReturnType HandleDeferredHistoryScroll(double InCurrentTime, float InDeltaTime);
-    EActiveTimerReturnType HandleHealthTimer(double InCurrentTime, float InDeltaTime);
-    EActiveTimerReturnType HandleSelectionTimer(double InCurrentTime, float InDeltaTime);
+    void HandleEditorSelectionChanged(UObject* ChangedSelection);
+    void HandleEditorObjectSelected(UObject* ChangedObject);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleLevelActorDeleted(AActor* Actor);
+    void RebuildSelectedActors();
     void SetCurrentView(EPanelView NewView);
 
     TSharedPtr<SMultiLineEditableTextBox> CredentialText;
@@ -162,6 +176,7 @@ private:
     TSharedPtr<SListView<TSharedPtr<FUEAIAgentChatSummary>>> ChatListView;
     TArray<TSharedPtr<FUEAIAgentChatSummary>> ChatListItems;
     TSharedPtr<SListView<TSharedPtr<FUEAIAgentChatHistoryEntry>>> MainChatHistoryListView;
+    TSharedPtr<FUEAIAgentRichTextCache, ESPMode::ThreadSafe> RichTextCache;
     TArray<TSharedPtr<FUEAIAgentChatHistoryEntry>> ChatHistoryItems;
     TSharedPtr<STextBlock> ChatListStateText;
     TSharedPtr<STextBlock> HistoryStateText;
@@ -190,7 +205,17 @@ private:
     TArray<TSharedPtr<STextBlock>> ActionDetailTexts;
     TArray<bool> ActionExpandedStates;
     int32 PromptVisibleLineCount = 1;
-    FString CachedSelectionSummary;
+    struct FSelectedActor
+    {
+        TWeakObjectPtr<const AActor> Actor;
+        FString Name;
+    };
+
+    // Mirrors the editor actor selection in selection order. Kept up to date from selection,
+    // label-change, and deletion notifications; SelectionVersion increments whenever the names change.
+    TArray<FSelectedActor> SelectedActors;
+    uint64 SelectionVersion = 0;
+    uint64 DisplayedSelectionVersion = 0;
     TArray<FString> LastNonEmptySelection;
     FString ChatSearchFilter;
     bool bIncludeArchivedChats = false;
@@ -207,5 +232,9 @@ private:
     FString PendingRestoredModelProvider;
     FString PendingRestoredModelName;
     ESessionStatus CurrentSessionStatus = ESessionStatus::Unknown;
+    // Session update that arrived while an applied plan was still running; handled once it finishes.
+    TOptional<FString> DeferredSessionMessage;
+    // Result of the last agent action run locally; explains a session that then fails on it.
+    TOptional<FUEAIAgentToolResult> LastAgentActionResult;
     EPanelView CurrentView = EPanelView::Main;
 };
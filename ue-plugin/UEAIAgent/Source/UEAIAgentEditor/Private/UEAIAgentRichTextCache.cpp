@@ -0,0 +1,446 @@
+#include "UEAIAgentRichTextCache.h"
+
+#include "Async/Async.h"
+#include "Framework/Text/RichTextMarkupProcessing.h"
+#include "Hash/xxhash.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    // Long agent sessions can produce thousands of messages; past this the cache starts over.
+    constexpr int32 MaxCachedTexts = 4096;
+
+    void AppendEscapedRichChar(FString& Out, TCHAR Ch)
+    {
+        if (Ch == TEXT('&'))
+        {
+            Out += TEXT("&amp;");
+            return;
+        }
+        if (Ch == TEXT('<'))
+        {
+            Out += TEXT("&lt;");
+            return;
+        }
+        if (Ch == TEXT('>'))
+        {
+            Out += TEXT("&gt;");
+            return;
+        }
+        Out.AppendChar(Ch);
+    }
+
+    FString EscapeRichText(const FString& Source)
+    {
+        FString Out;
+        Out.Reserve(Source.Len());
+        for (int32 Index = 0; Index < Source.Len(); ++Index)
+        {
+            AppendEscapedRichChar(Out, Source[Index]);
+        }
+        return Out;
+    }
+
+    FString ParseInlineMarkdown(const FString& Source)
+    {
+        FString Out;
+        Out.Reserve(Source.Len() + 32);
+
+        int32 Index = 0;
+        while (Index < Source.Len())
+        {
+            if (Source[Index] == TEXT('`'))
+            {
+                const int32 Close = Source.Find(TEXT("`"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1);
+                if (Close != INDEX_NONE && Close > Index + 1)
+                {
+                    const FString Code = Source.Mid(Index + 1, Close - Index - 1);
+                    Out += TEXT("<md.code>");
+                    Out += EscapeRichText(Code);
+                    Out += TEXT("</>");
+                    Index = Close + 1;
+                    continue;
+                }
+            }
+
+            if (Index + 1 < Source.Len() && Source[Index] == TEXT('*') && Source[Index + 1] == TEXT('*'))
+            {
+                const int32 Close = Source.Find(TEXT("**"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 2);
+                if (Close != INDEX_NONE && Close > Index + 2)
+                {
+                    const FString Bold = Source.Mid(Index + 2, Close - Index - 2);
+                    Out += TEXT("<md.bold>");
+                    Out += EscapeRichText(Bold);
+                    Out += TEXT("</>");
+                    Index = Close + 2;
+                    continue;
+                }
+            }
+
+            if (Source[Index] == TEXT('*'))
+            {
+                const int32 Close = Source.Find(TEXT("*"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1);
+                if (Close != INDEX_NONE && Close > Index + 1)
+                {
+                    const FString Italic = Source.Mid(Index + 1, Close - Index - 1);
+                    Out += TEXT("<md.italic>");
+                    Out += EscapeRichText(Italic);
+                    Out += TEXT("</>");
+                    Index = Close + 1;
+                    continue;
+                }
+            }
+
+            AppendEscapedRichChar(Out, Source[Index]);
+            ++Index;
+        }
+
+        return Out;
+    }
+
+    bool IsMarkdownTableRow(const FString& Line)
+    {
+        const FString Trimmed = Line.TrimStartAndEnd();
+        if (Trimmed.IsEmpty())
+        {
+            return false;
+        }
+
+        int32 PipeCount = 0;
+        for (int32 Index = 0; Index < Trimmed.Len(); ++Index)
+        {
+            if (Trimmed[Index] == TEXT('|'))
+            {
+                ++PipeCount;
+            }
+        }
+        return PipeCount >= 2;
+    }
+
+    bool IsMarkdownTableSeparator(const FString& Line)
+    {
+        FString Compact = Line.TrimStartAndEnd().Replace(TEXT(" "), TEXT(""));
+        if (Compact.IsEmpty() || !Compact.Contains(TEXT("|")))
+        {
+            return false;
+        }
+
+        bool bHasDash = false;
+        for (int32 Index = 0; Index < Compact.Len(); ++Index)
+        {
+            const TCHAR Ch = Compact[Index];
+            if (Ch == TEXT('|'))
+            {
+                continue;
+            }
+            if (Ch == TEXT('-'))
+            {
+                bHasDash = true;
+                continue;
+            }
+            if (Ch == TEXT(':'))
+            {
+                continue;
+            }
+            return false;
+        }
+        return bHasDash;
+    }
+
+    void ParseMarkdownTableCells(const FString& Line, TArray<FString>& OutCells)
+    {
+        OutCells.Empty();
+
+        FString Work = Line.TrimStartAndEnd();
+        if (Work.StartsWith(TEXT("|")))
+        {
+            Work = Work.Mid(1);
+        }
+        if (Work.EndsWith(TEXT("|")))
+        {
+            Work = Work.LeftChop(1);
+        }
+
+        Work.ParseIntoArray(OutCells, TEXT("|"), false);
+        for (FString& Cell : OutCells)
+        {
+            Cell = Cell.TrimStartAndEnd();
+        }
+    }
+
+    FString BuildMarkdownTableRowText(const TArray<FString>& Headers, const TArray<FString>& Cells)
+    {
+        FString RowText;
+        for (int32 CellIndex = 0; CellIndex < Cells.Num(); ++CellIndex)
+        {
+            if (CellIndex > 0)
+            {
+                RowText += TEXT("  ");
+            }
+
+            if (Headers.IsValidIndex(CellIndex))
+            {
+                const FString Header = Headers[CellIndex].TrimStartAndEnd();
+                if (!Header.IsEmpty())
+                {
+                    RowText += TEXT("<md.bold>");
+                    RowText += ParseInlineMarkdown(Header);
+                    RowText += TEXT(":</> ");
+                }
+            }
+
+            RowText += ParseInlineMarkdown(Cells[CellIndex]);
+        }
+
+        return RowText;
+    }
+
+    FString ConvertMarkdownToRichText(const FString& Source)
+    {
+        const FString Normalized = Source.Replace(TEXT("\r\n"), TEXT("\n")).Replace(TEXT("\r"), TEXT("\n"));
+        TArray<FString> Lines;
+        Normalized.ParseIntoArray(Lines, TEXT("\n"), false);
+
+        FString Out;
+        bool bInCodeBlock = false;
+        for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+        {
+            const FString& Line = Lines[LineIndex];
+            const FString Trimmed = Line.TrimStartAndEnd();
+
+            if (Trimmed.StartsWith(TEXT("```")))
+            {
+                bInCodeBlock = !bInCodeBlock;
+                if (LineIndex + 1 < Lines.Num())
+                {
+                    Out += TEXT("\n");
+                }
+                continue;
+            }
+
+            if (bInCodeBlock)
+            {
+                Out += TEXT("<md.code>");
+                Out += EscapeRichText(Line);
+                Out += TEXT("</>");
+            }
+            else if (LineIndex + 1 < Lines.Num() &&
+                IsMarkdownTableRow(Trimmed) &&
+                IsMarkdownTableSeparator(Lines[LineIndex + 1].TrimStartAndEnd()))
+            {
+                TArray<FString> Headers;
+                ParseMarkdownTableCells(Trimmed, Headers);
+
+                int32 RowIndex = LineIndex + 2;
+                bool bHasDataRows = false;
+                while (RowIndex < Lines.Num())
+                {
+                    const FString RowTrimmed = Lines[RowIndex].TrimStartAndEnd();
+                    if (!IsMarkdownTableRow(RowTrimmed))
+                    {
+                        break;
+                    }
+
+                    TArray<FString> Cells;
+                    ParseMarkdownTableCells(RowTrimmed, Cells);
+                    if (Cells.Num() > 0)
+                    {
+                        Out += TEXT("• ");
+                        Out += BuildMarkdownTableRowText(Headers, Cells);
+                        bHasDataRows = true;
+                        if (RowIndex + 1 < Lines.Num())
+                        {
+                            Out += TEXT("\n");
+                        }
+                    }
+
+                    ++RowIndex;
+                }
+
+                if (!bHasDataRows)
+                {
+                    Out += ParseInlineMarkdown(Trimmed);
+                    if (LineIndex + 2 < Lines.Num())
+                    {
+                        Out += TEXT("\n");
+                    }
+                }
+
+                LineIndex = bHasDataRows ? (RowIndex - 1) : (LineIndex + 1);
+                continue;
+            }
+            else if (Trimmed.StartsWith(TEXT("# ")))
+            {
+                Out += TEXT("<md.bold>");
+                Out += ParseInlineMarkdown(Trimmed.Mid(2));
+                Out += TEXT("</>");
+            }
+            else if (Trimmed.StartsWith(TEXT("## ")))
+            {
+                Out += TEXT("<md.bold>");
+                Out += ParseInlineMarkdown(Trimmed.Mid(3));
+                Out += TEXT("</>");
+            }
+            else if (Trimmed.StartsWith(TEXT("### ")))
+            {
+                Out += TEXT("<md.bold>");
+                Out += ParseInlineMarkdown(Trimmed.Mid(4));
+                Out += TEXT("</>");
+            }
+            else if (Trimmed.StartsWith(TEXT("- ")) || Trimmed.StartsWith(TEXT("* ")))
+            {
+                Out += TEXT("• ");
+                Out += ParseInlineMarkdown(Trimmed.Mid(2));
+            }
+            else
+            {
+                Out += ParseInlineMarkdown(Line);
+            }
+
+            if (LineIndex + 1 < Lines.Num())
+            {
+                Out += TEXT("\n");
+            }
+        }
+
+        return Out;
+    }
+}
+
+class FUEAIAgentRichTextCache::FCachingParser : public IRichTextMarkupParser
+{
+public:
+    explicit FCachingParser(const TSharedRef<FUEAIAgentRichTextCache, ESPMode::ThreadSafe>& InCache)
+        : Cache(InCache)
+        , Inner(FDefaultRichTextMarkupParser::Create())
+    {
+    }
+
+    virtual void Process(TArray<FTextLineParseResults>& Results, const FString& Input, FString& Output) override
+    {
+        const TSharedPtr<FUEAIAgentRichTextCache, ESPMode::ThreadSafe> PinnedCache = Cache.Pin();
+        const uint64 Key = HashText(Input);
+        if (PinnedCache.IsValid() && PinnedCache->FindParsed(Key, Input, Results, Output))
+        {
+            return;
+        }
+
+        Inner->Process(Results, Input, Output);
+        if (PinnedCache.IsValid())
+        {
+            PinnedCache->AddParsed(Key, Input, Results, Output);
+        }
+    }
+
+private:
+    TWeakPtr<FUEAIAgentRichTextCache, ESPMode::ThreadSafe> Cache;
+    TSharedRef<IRichTextMarkupParser> Inner;
+};
+
+FString FUEAIAgentRichTextCache::GetMarkup(const FString& Markdown)
+{
+    const uint64 Key = HashText(Markdown);
+    FString Markup;
+    if (FindMarkup(Key, Markdown, Markup))
+    {
+        return Markup;
+    }
+
+    Markup = ConvertMarkdownToRichText(Markdown);
+    AddMarkup(Key, Markdown, Markup);
+    return Markup;
+}
+
+void FUEAIAgentRichTextCache::Prepare(TArray<FString>&& Markdowns)
+{
+    if (Markdowns.Num() == 0)
+    {
+        return;
+    }
+
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [Self = AsShared(), Markdowns = MoveTemp(Markdowns)]()
+        {
+            const TSharedRef<IRichTextMarkupParser> TaskParser = FDefaultRichTextMarkupParser::Create();
+            for (const FString& Markdown : Markdowns)
+            {
+                const FString Markup = Self->GetMarkup(Markdown);
+                const uint64 ParsedKey = HashText(Markup);
+                TArray<FTextLineParseResults> Lines;
+                FString Output;
+                if (!Self->FindParsed(ParsedKey, Markup, Lines, Output))
+                {
+                    TaskParser->Process(Lines, Markup, Output);
+                    Self->AddParsed(ParsedKey, Markup, Lines, Output);
+                }
+            }
+        });
+}
+
+TSharedRef<IRichTextMarkupParser> FUEAIAgentRichTextCache::GetParser()
+{
+    if (!Parser.IsValid())
+    {
+        Parser = MakeShared<FCachingParser>(AsShared());
+    }
+    return Parser.ToSharedRef();
+}
+
+uint64 FUEAIAgentRichTextCache::HashText(const FString& Text)
+{
+    return FXxHash64::HashBuffer(*Text, Text.Len() * sizeof(TCHAR)).Hash;
+}
+
+bool FUEAIAgentRichTextCache::FindMarkup(uint64 Key, const FString& Markdown, FString& OutMarkup) const
+{
+    FScopeLock Lock(&Guard);
+    const FMarkupEntry* Entry = MarkupByHash.Find(Key);
+    if (!Entry || !Entry->Markdown.Equals(Markdown, ESearchCase::CaseSensitive))
+    {
+        return false;
+    }
+    OutMarkup = Entry->Markup;
+    return true;
+}
+
+void FUEAIAgentRichTextCache::AddMarkup(uint64 Key, const FString& Markdown, const FString& Markup)
+{
+    FScopeLock Lock(&Guard);
+    if (MarkupByHash.Num() >= MaxCachedTexts)
+    {
+        MarkupByHash.Reset();
+    }
+    MarkupByHash.Add(Key, FMarkupEntry{ Markdown, Markup });
+}
+
+bool FUEAIAgentRichTextCache::FindParsed(
+    uint64 Key,
+    const FString& Markup,
+    TArray<FTextLineParseResults>& OutLines,
+    FString& OutOutput) const
+{
+    FScopeLock Lock(&Guard);
+    const FParsedEntry* Entry = ParsedByHash.Find(Key);
+    if (!Entry || !Entry->Markup.Equals(Markup, ESearchCase::CaseSensitive))
+    {
+        return false;
+    }
+    OutLines = Entry->Lines;
+    OutOutput = Entry->Output;
+    return true;
+}
+
+void FUEAIAgentRichTextCache::AddParsed(
+    uint64 Key,
+    const FString& Markup,
+    const TArray<FTextLineParseResults>& Lines,
+    const FString& Output)
+{
+    FScopeLock Lock(&Guard);
+    if (ParsedByHash.Num() >= MaxCachedTexts)
+    {
+        ParsedByHash.Reset();
+    }
+    ParsedByHash.Add(Key, FParsedEntry{ Markup, Output, Lines });
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Text/IRichTextMarkupParser.h"
+
+// Assistant messages converted from markdown to Slate rich-text markup, together with the runs the
+// rich-text parser produces for that markup. Entries are keyed by a hash of their text. Prepare fills
+// the cache on a worker thread when history arrives, so generating a row while scrolling is a lookup
+// instead of a reparse. Thread safe.
+class FUEAIAgentRichTextCache : public TSharedFromThis<FUEAIAgentRichTextCache, ESPMode::ThreadSafe>
+{
+public:
+    // Converts on the calling thread on a miss.
+    FString GetMarkup(const FString& Markdown);
+
+    // Converts and parses every message not cached yet on a background thread.
+    void Prepare(TArray<FString>&& Markdowns);
+
+    // For FRichTextLayoutMarshaller; serves cached runs and parses (and caches) anything else.
+    // Game thread only.
+    TSharedRef<IRichTextMarkupParser> GetParser();
+
+private:
+    struct FMarkupEntry
+    {
+        FString Markdown;
+        FString Markup;
+    };
+
+    struct FParsedEntry
+    {
+        FString Markup;
+        FString Output;
+        TArray<FTextLineParseResults> Lines;
+    };
+
+    class FCachingParser;
+
+    static uint64 HashText(const FString& Text);
+    bool FindMarkup(uint64 Key, const FString& Markdown, FString& OutMarkup) const;
+    void AddMarkup(uint64 Key, const FString& Markdown, const FString& Markup);
+    bool FindParsed(uint64 Key, const FString& Markup, TArray<FTextLineParseResults>& OutLines, FString& OutOutput) const;
+    void AddParsed(uint64 Key, const FString& Markup, const TArray<FTextLineParseResults>& Lines, const FString& Output);
+
+    mutable FCriticalSection Guard;
+    TMap<uint64, FMarkupEntry> MarkupByHash;
+    TMap<uint64, FParsedEntry> ParsedByHash;
+    TSharedPtr<IRichTextMarkupParser> Parser;
+};
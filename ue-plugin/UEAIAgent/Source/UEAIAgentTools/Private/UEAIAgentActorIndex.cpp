@@ -0,0 +1,360 @@
+#include "UEAIAgentActorIndex.h"
+
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+FUEAIAgentActorIndex& FUEAIAgentActorIndex::Get()
+{
+    static FUEAIAgentActorIndex Instance;
+    return Instance;
+}
+
+void FUEAIAgentActorIndex::Startup()
+{
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FUEAIAgentActorIndex::HandleActorLabelChanged);
+    ObjectRenamedHandle = FCoreUObjectDelegates::OnObjectRenamed.AddRaw(this, &FUEAIAgentActorIndex::HandleObjectRenamed);
+    LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FUEAIAgentActorIndex::HandleLevelAddedToWorld);
+    LevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FUEAIAgentActorIndex::HandleLevelRemovedFromWorld);
+    PostUndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FUEAIAgentActorIndex::HandlePostUndoRedo);
+    MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FUEAIAgentActorIndex::HandleMapChange);
+
+    if (GEngine)
+    {
+        BindEngineDelegates();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FUEAIAgentActorIndex::BindEngineDelegates);
+    }
+}
+
+void FUEAIAgentActorIndex::Shutdown()
+{
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+    FCoreUObjectDelegates::OnObjectRenamed.Remove(ObjectRenamedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedFromWorldHandle);
+    FEditorDelegates::PostUndoRedo.Remove(PostUndoRedoHandle);
+    FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+    if (GEngine && bEngineDelegatesBound)
+    {
+        GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+    }
+    bEngineDelegatesBound = false;
+
+    IndexedWorld.Reset();
+    ActorsByKey.Reset();
+    KeysByActor.Reset();
+    bNeedsRebuild = true;
+}
+
+void FUEAIAgentActorIndex::BindEngineDelegates()
+{
+    if (!GEngine || bEngineDelegatesBound)
+    {
+        return;
+    }
+
+    LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FUEAIAgentActorIndex::HandleLevelActorAdded);
+    LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FUEAIAgentActorIndex::HandleLevelActorDeleted);
+    bEngineDelegatesBound = true;
+    bNeedsRebuild = true;
+}
+
+void FUEAIAgentActorIndex::FindActorsByName(UWorld* World, const TArray<FString>& ActorNames, TArray<AActor*>& OutActors)
+{
+    if (!World || ActorNames.IsEmpty())
+    {
+        return;
+    }
+
+    PrepareWorld(World);
+
+    const TArray<FString>* NameLists[] = { &ActorNames };
+    FLookupSnapshot Snapshot;
+    SnapshotCandidates(NameLists, Snapshot);
+
+    TArray<int32> Matches;
+    MatchSnapshot(Snapshot, ActorNames, Matches);
+    OutActors.Reserve(OutActors.Num() + Matches.Num());
+    for (const int32 CandidateIndex : Matches)
+    {
+        if (AActor* Actor = Snapshot.Candidates[CandidateIndex].Actor.Get())
+        {
+            OutActors.Add(Actor);
+        }
+    }
+}
+
+void FUEAIAgentActorIndex::PrepareWorld(UWorld* World)
+{
+    if (bNeedsRebuild || IndexedWorld.Get() != World)
+    {
+        Rebuild(World);
+    }
+}
+
+void FUEAIAgentActorIndex::SnapshotCandidates(TArrayView<const TArray<FString>* const> NameLists, FLookupSnapshot& OutSnapshot) const
+{
+    TMap<FObjectKey, int32> CandidateByActor;
+    for (const TArray<FString>* ActorNames : NameLists)
+    {
+        for (const FString& Name : *ActorNames)
+        {
+            FString Key = Name.ToLower();
+            if (OutSnapshot.CandidatesByKey.Contains(Key))
+            {
+                continue;
+            }
+
+            TArray<int32>& KeyCandidates = OutSnapshot.CandidatesByKey.Add(Key);
+            const TArray<TWeakObjectPtr<AActor>>* Entries = ActorsByKey.Find(Key);
+            if (!Entries)
+            {
+                continue;
+            }
+
+            for (const TWeakObjectPtr<AActor>& Entry : *Entries)
+            {
+                AActor* Actor = Entry.Get();
+                if (!Actor || !IsIndexedWorldActor(Actor))
+                {
+                    continue;
+                }
+
+                const FObjectKey ActorKey(Actor);
+                if (const int32* Existing = CandidateByActor.Find(ActorKey))
+                {
+                    KeyCandidates.Add(*Existing);
+                    continue;
+                }
+
+                FLookupSnapshot::FCandidate& Candidate = OutSnapshot.Candidates.AddDefaulted_GetRef();
+                Candidate.Actor = Actor;
+                Candidate.NameKey = Actor->GetName().ToLower();
+                Candidate.LabelKey = Actor->GetActorLabel().ToLower();
+                const int32 CandidateIndex = OutSnapshot.Candidates.Num() - 1;
+                CandidateByActor.Add(ActorKey, CandidateIndex);
+                KeyCandidates.Add(CandidateIndex);
+            }
+        }
+    }
+}
+
+void FUEAIAgentActorIndex::MatchSnapshot(const FLookupSnapshot& Snapshot, const TArray<FString>& ActorNames, TArray<int32>& OutCandidates)
+{
+    TSet<int32> AddedCandidates;
+    for (const FString& Name : ActorNames)
+    {
+        const FString Key = Name.ToLower();
+        const TArray<int32>* KeyCandidates = Snapshot.CandidatesByKey.Find(Key);
+        if (!KeyCandidates)
+        {
+            continue;
+        }
+
+        for (const int32 CandidateIndex : *KeyCandidates)
+        {
+            // A label written without SetActorLabel is not broadcast, so confirm the hit is still current.
+            const FLookupSnapshot::FCandidate& Candidate = Snapshot.Candidates[CandidateIndex];
+            if (Candidate.NameKey != Key && Candidate.LabelKey != Key)
+            {
+                continue;
+            }
+
+            bool bAlreadyAdded = false;
+            AddedCandidates.Add(CandidateIndex, &bAlreadyAdded);
+            if (!bAlreadyAdded)
+            {
+                OutCandidates.Add(CandidateIndex);
+            }
+        }
+    }
+}
+
+void FUEAIAgentActorIndex::Rebuild(UWorld* World)
+{
+    ActorsByKey.Reset();
+    KeysByActor.Reset();
+    IndexedWorld = World;
+    bNeedsRebuild = false;
+
+    if (!World)
+    {
+        return;
+    }
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AddActor(*It);
+    }
+}
+
+void FUEAIAgentActorIndex::AddActor(AActor* Actor)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    const FObjectKey ActorKey(Actor);
+    RemoveActor(ActorKey);
+
+    FIndexedKeys Keys;
+    Keys.NameKey = Actor->GetName().ToLower();
+    Keys.LabelKey = Actor->GetActorLabel().ToLower();
+
+    AddKey(Keys.NameKey, Actor);
+    if (Keys.LabelKey != Keys.NameKey)
+    {
+        AddKey(Keys.LabelKey, Actor);
+    }
+    KeysByActor.Add(ActorKey, MoveTemp(Keys));
+}
+
+void FUEAIAgentActorIndex::RemoveActor(const FObjectKey& ActorKey)
+{
+    FIndexedKeys Keys;
+    if (!KeysByActor.RemoveAndCopyValue(ActorKey, Keys))
+    {
+        return;
+    }
+
+    RemoveKey(Keys.NameKey, ActorKey);
+    if (Keys.LabelKey != Keys.NameKey)
+    {
+        RemoveKey(Keys.LabelKey, ActorKey);
+    }
+}
+
+void FUEAIAgentActorIndex::AddKey(const FString& Key, AActor* Actor)
+{
+    if (Key.IsEmpty())
+    {
+        return;
+    }
+
+    ActorsByKey.FindOrAdd(Key).Add(Actor);
+}
+
+void FUEAIAgentActorIndex::RemoveKey(const FString& Key, const FObjectKey& ActorKey)
+{
+    TArray<TWeakObjectPtr<AActor>>* Entries = ActorsByKey.Find(Key);
+    if (!Entries)
+    {
+        return;
+    }
+
+    Entries->RemoveAllSwap([&ActorKey](const TWeakObjectPtr<AActor>& Entry)
+    {
+        return !Entry.IsValid() || FObjectKey(Entry.Get()) == ActorKey;
+    });
+    if (Entries->IsEmpty())
+    {
+        ActorsByKey.Remove(Key);
+    }
+}
+
+bool FUEAIAgentActorIndex::IsIndexedWorldActor(const AActor* Actor) const
+{
+    return Actor && IndexedWorld.IsValid() && Actor->GetWorld() == IndexedWorld.Get();
+}
+
+void FUEAIAgentActorIndex::HandleLevelActorAdded(AActor* Actor)
+{
+    if (!bNeedsRebuild && IsIndexedWorldActor(Actor))
+    {
+        AddActor(Actor);
+    }
+}
+
+void FUEAIAgentActorIndex::HandleLevelActorDeleted(AActor* Actor)
+{
+    if (Actor && !bNeedsRebuild)
+    {
+        RemoveActor(FObjectKey(Actor));
+    }
+}
+
+void FUEAIAgentActorIndex::HandleActorLabelChanged(AActor* Actor)
+{
+    if (!bNeedsRebuild && IsIndexedWorldActor(Actor))
+    {
+        AddActor(Actor);
+    }
+}
+
+void FUEAIAgentActorIndex::HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName)
+{
+    AActor* Actor = Cast<AActor>(Object);
+    if (!Actor || bNeedsRebuild)
+    {
+        return;
+    }
+
+    // A rename can also move the actor to a level outside the indexed world.
+    if (IsIndexedWorldActor(Actor))
+    {
+        AddActor(Actor);
+    }
+    else
+    {
+        RemoveActor(FObjectKey(Actor));
+    }
+}
+
+void FUEAIAgentActorIndex::HandleLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+    if (!Level || bNeedsRebuild || World != IndexedWorld.Get())
+    {
+        return;
+    }
+
+    for (AActor* Actor : Level->Actors)
+    {
+        AddActor(Actor);
+    }
+}
+
+void FUEAIAgentActorIndex::HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+    if (bNeedsRebuild || World != IndexedWorld.Get())
+    {
+        return;
+    }
+
+    // A null level means every level of the world is going away.
+    if (!Level)
+    {
+        bNeedsRebuild = true;
+        return;
+    }
+
+    for (AActor* Actor : Level->Actors)
+    {
+        if (Actor)
+        {
+            RemoveActor(FObjectKey(Actor));
+        }
+    }
+}
+
+void FUEAIAgentActorIndex::HandlePostUndoRedo()
+{
+    // Undo can resurrect or discard actors without the add/delete broadcasts.
+    bNeedsRebuild = true;
+}
+
+void FUEAIAgentActorIndex::HandleMapChange(uint32 MapChangeFlags)
+{
+    bNeedsRebuild = true;
+}
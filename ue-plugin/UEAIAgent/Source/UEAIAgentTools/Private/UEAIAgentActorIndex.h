@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+// Editor world lookup of actors by case-folded name and label.
+// Kept up to date from spawn, destroy, label and object rename events so scene tools never walk the whole world;
+// undo/redo, which skips those events, marks it for a rebuild.
+class FUEAIAgentActorIndex
+{
+public:
+    static FUEAIAgentActorIndex& Get();
+
+    void Startup();
+    void Shutdown();
+
+    // Indexed actors that may match a set of lookups, with their current case-folded name and label
+    // copied out so the matching itself needs no UObject access.
+    struct FLookupSnapshot
+    {
+        struct FCandidate
+        {
+            TWeakObjectPtr<AActor> Actor;
+            FString NameKey;
+            FString LabelKey;
+        };
+
+        TArray<FCandidate> Candidates;
+        TMap<FString, TArray<int32>> CandidatesByKey;
+    };
+
+    void FindActorsByName(UWorld* World, const TArray<FString>& ActorNames, TArray<AActor*>& OutActors);
+
+    // Brings the index up to date for World. Must run on the game thread before any snapshot is taken.
+    void PrepareWorld(UWorld* World);
+    // Game thread. Copies the candidates for every name in NameLists.
+    void SnapshotCandidates(TArrayView<const TArray<FString>* const> NameLists, FLookupSnapshot& OutSnapshot) const;
+    // Any thread. Appends the snapshot candidates that match ActorNames, each once, in name order.
+    static void MatchSnapshot(const FLookupSnapshot& Snapshot, const TArray<FString>& ActorNames, TArray<int32>& OutCandidates);
+
+private:
+    struct FIndexedKeys
+    {
+        FString NameKey;
+        FString LabelKey;
+    };
+
+    void BindEngineDelegates();
+    void Rebuild(UWorld* World);
+    void AddActor(AActor* Actor);
+    void RemoveActor(const FObjectKey& ActorKey);
+    void AddKey(const FString& Key, AActor* Actor);
+    void RemoveKey(const FString& Key, const FObjectKey& ActorKey);
+    bool IsIndexedWorldActor(const AActor* Actor) const;
+    void HandleLevelActorAdded(AActor* Actor);
+    void HandleLevelActorDeleted(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleObjectRenamed(UObject* Object, UObject* OldOuter, FName OldName);
+    void HandleLevelAddedToWorld(ULevel* Level, UWorld* World);
+    void HandleLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+    void HandlePostUndoRedo();
+    void HandleMapChange(uint32 MapChangeFlags);
+
+    TWeakObjectPtr<UWorld> IndexedWorld;
+    TMap<FString, TArray<TWeakObjectPtr<AActor>>> ActorsByKey;
+    TMap<FObjectKey, FIndexedKeys> KeysByActor;
+    bool bNeedsRebuild = true;
+    bool bEngineDelegatesBound = false;
+
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle LevelActorAddedHandle;
+    FDelegateHandle LevelActorDeletedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle ObjectRenamedHandle;
+    FDelegateHandle LevelAddedToWorldHandle;
+    FDelegateHandle LevelRemovedFromWorldHandle;
+    FDelegateHandle PostUndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+};
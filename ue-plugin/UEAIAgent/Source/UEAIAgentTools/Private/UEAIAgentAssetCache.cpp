@@ -0,0 +1,146 @@
+#include "UEAIAgentAssetCache.h"
+
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/PackageName.h"
+#include "UEAIAgentTransportModule.h"
+
+namespace
+{
+    FSoftObjectPath MakeAssetObjectPath(const FString& AssetPath)
+    {
+        if (!AssetPath.StartsWith(TEXT("/")))
+        {
+            return FSoftObjectPath();
+        }
+
+        // Planner output sometimes drops the object name from package paths.
+        if (!AssetPath.Contains(TEXT(".")))
+        {
+            return FSoftObjectPath(AssetPath + TEXT(".") + FPackageName::GetShortName(AssetPath));
+        }
+        return FSoftObjectPath(AssetPath);
+    }
+}
+
+FUEAIAgentAssetCache& FUEAIAgentAssetCache::Get()
+{
+    static FUEAIAgentAssetCache Instance;
+    return Instance;
+}
+
+void FUEAIAgentAssetCache::Startup()
+{
+    StreamableManager = MakeUnique<FStreamableManager>();
+    PlannedActionsReceivedHandle = FUEAIAgentTransportModule::Get().OnPlannedActionsReceived().AddRaw(
+        this,
+        &FUEAIAgentAssetCache::PreloadPlannedAssets);
+}
+
+void FUEAIAgentAssetCache::Shutdown()
+{
+    if (FUEAIAgentTransportModule::IsAvailable())
+    {
+        FUEAIAgentTransportModule::Get().OnPlannedActionsReceived().Remove(PlannedActionsReceivedHandle);
+    }
+    PlannedActionsReceivedHandle.Reset();
+
+    if (PreloadHandle.IsValid())
+    {
+        PreloadHandle->CancelHandle();
+        PreloadHandle.Reset();
+    }
+    StreamableManager.Reset();
+    ResolvedAssets.Reset();
+}
+
+void FUEAIAgentAssetCache::PreloadPlannedAssets(const TArray<FUEAIAgentPlannedSceneAction>& Actions)
+{
+    TArray<FSoftObjectPath> PendingPaths;
+    auto AddPath = [&PendingPaths](const FString& AssetPath)
+    {
+        const FSoftObjectPath ObjectPath = MakeAssetObjectPath(AssetPath);
+        if (ObjectPath.IsValid() && !ObjectPath.ResolveObject())
+        {
+            PendingPaths.AddUnique(ObjectPath);
+        }
+    };
+
+    for (const FUEAIAgentPlannedSceneAction& Action : Actions)
+    {
+        if (Action.Type == EUEAIAgentPlannedActionType::SetComponentMaterial)
+        {
+            AddPath(Action.MaterialPath);
+        }
+        else if (Action.Type == EUEAIAgentPlannedActionType::SetComponentStaticMesh)
+        {
+            AddPath(Action.MeshPath);
+        }
+        else if (Action.Type == EUEAIAgentPlannedActionType::CreateActor && Action.bSpawnInstanced)
+        {
+            AddPath(Action.SpawnMeshPath);
+        }
+    }
+
+    if (PendingPaths.IsEmpty() || !StreamableManager)
+    {
+        return;
+    }
+
+    // The handle keeps the previous plan's assets resident until the new ones are requested.
+    PreloadHandle = StreamableManager->RequestAsyncLoad(
+        MoveTemp(PendingPaths),
+        FStreamableDelegate(),
+        FStreamableManager::AsyncLoadHighPriority,
+        true);
+}
+
+UMaterialInterface* FUEAIAgentAssetCache::ResolveMaterial(const FString& AssetPath)
+{
+    return Cast<UMaterialInterface>(ResolveAsset(AssetPath, UMaterialInterface::StaticClass()));
+}
+
+UStaticMesh* FUEAIAgentAssetCache::ResolveStaticMesh(const FString& AssetPath)
+{
+    return Cast<UStaticMesh>(ResolveAsset(AssetPath, UStaticMesh::StaticClass()));
+}
+
+UObject* FUEAIAgentAssetCache::ResolveAsset(const FString& AssetPath, UClass* AssetClass)
+{
+    if (AssetPath.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    if (const TSoftObjectPtr<UObject>* Cached = ResolvedAssets.Find(AssetPath))
+    {
+        UObject* CachedAsset = Cached->Get();
+        if (CachedAsset && CachedAsset->IsA(AssetClass))
+        {
+            return CachedAsset;
+        }
+    }
+
+    UObject* Asset = nullptr;
+    if (AssetPath.StartsWith(TEXT("/")))
+    {
+        const FSoftObjectPath ObjectPath = MakeAssetObjectPath(AssetPath);
+        Asset = ObjectPath.ResolveObject();
+        if (!Asset)
+        {
+            // Blocks on an in-flight preload of this package instead of starting a second load.
+            Asset = StaticLoadObject(AssetClass, nullptr, *ObjectPath.ToString());
+        }
+    }
+    if (!Asset || !Asset->IsA(AssetClass))
+    {
+        Asset = StaticFindObject(AssetClass, nullptr, *AssetPath);
+    }
+    if (!Asset)
+    {
+        return nullptr;
+    }
+
+    ResolvedAssets.Add(AssetPath, TSoftObjectPtr<UObject>(Asset));
+    return Asset;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPtr.h"
+
+class UMaterialInterface;
+class UStaticMesh;
+struct FUEAIAgentPlannedSceneAction;
+
+// Material and mesh assets referenced by planned actions.
+// Paths are streamed in as soon as a plan arrives so applying it does not stall on a cold load.
+class FUEAIAgentAssetCache
+{
+public:
+    static FUEAIAgentAssetCache& Get();
+
+    void Startup();
+    void Shutdown();
+
+    void PreloadPlannedAssets(const TArray<FUEAIAgentPlannedSceneAction>& Actions);
+    UMaterialInterface* ResolveMaterial(const FString& AssetPath);
+    UStaticMesh* ResolveStaticMesh(const FString& AssetPath);
+
+private:
+    UObject* ResolveAsset(const FString& AssetPath, UClass* AssetClass);
+
+    TUniquePtr<FStreamableManager> StreamableManager;
+    TSharedPtr<FStreamableHandle> PreloadHandle;
+    TMap<FString, TSoftObjectPtr<UObject>> ResolvedAssets;
+    FDelegateHandle PlannedActionsReceivedHandle;
+};
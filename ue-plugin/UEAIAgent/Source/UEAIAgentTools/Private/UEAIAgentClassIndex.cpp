@@ -0,0 +1,147 @@
+#include "UEAIAgentClassIndex.h"
+
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectIterator.h"
+
+FUEAIAgentClassIndex& FUEAIAgentClassIndex::Get()
+{
+    static FUEAIAgentClassIndex Instance;
+    return Instance;
+}
+
+void FUEAIAgentClassIndex::Startup()
+{
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FUEAIAgentClassIndex::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FUEAIAgentClassIndex::HandleReloadComplete);
+    AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FUEAIAgentClassIndex::HandleAssetLoaded);
+
+    if (GEditor)
+    {
+        BindEditorDelegates();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FUEAIAgentClassIndex::BindEditorDelegates);
+    }
+}
+
+void FUEAIAgentClassIndex::Shutdown()
+{
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+    if (GEditor && BlueprintCompiledHandle.IsValid())
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    BlueprintCompiledHandle.Reset();
+    Invalidate();
+}
+
+UClass* FUEAIAgentClassIndex::FindActorClass(const FString& ClassName)
+{
+    if (ClassName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    if (!bIsBuilt)
+    {
+        Rebuild();
+    }
+
+    const TWeakObjectPtr<UClass>* Found = ClassesByName.Find(ClassName.ToLower());
+    if (!Found)
+    {
+        return nullptr;
+    }
+
+    if (UClass* Class = Found->Get())
+    {
+        return Class;
+    }
+
+    // The class went away without a notification we listen to; rebuild once and retry.
+    Rebuild();
+    Found = ClassesByName.Find(ClassName.ToLower());
+    return Found ? Found->Get() : nullptr;
+}
+
+void FUEAIAgentClassIndex::Invalidate()
+{
+    ClassesByName.Reset();
+    bIsBuilt = false;
+}
+
+void FUEAIAgentClassIndex::Rebuild()
+{
+    ClassesByName.Reset();
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        AddClass(*It);
+    }
+    bIsBuilt = true;
+}
+
+void FUEAIAgentClassIndex::AddClass(UClass* Class)
+{
+    if (!Class || !Class->IsChildOf(AActor::StaticClass()) || Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+    {
+        return;
+    }
+
+    const FString ClassName = Class->GetName();
+    if (ClassName.StartsWith(TEXT("SKEL_")) || ClassName.StartsWith(TEXT("REINST_")))
+    {
+        return;
+    }
+
+    const FString ClassKey = ClassName.ToLower();
+    if (!ClassesByName.Contains(ClassKey))
+    {
+        ClassesByName.Add(ClassKey, Class);
+    }
+
+    // Blueprint generated classes can also be addressed by their asset name.
+    if (Class->IsA<UBlueprintGeneratedClass>() && ClassKey.EndsWith(TEXT("_c")))
+    {
+        const FString AssetKey = ClassKey.LeftChop(2);
+        if (!ClassesByName.Contains(AssetKey))
+        {
+            ClassesByName.Add(AssetKey, Class);
+        }
+    }
+}
+
+void FUEAIAgentClassIndex::BindEditorDelegates()
+{
+    if (!GEditor || BlueprintCompiledHandle.IsValid())
+    {
+        return;
+    }
+
+    BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FUEAIAgentClassIndex::Invalidate);
+}
+
+void FUEAIAgentClassIndex::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    Invalidate();
+}
+
+void FUEAIAgentClassIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    Invalidate();
+}
+
+void FUEAIAgentClassIndex::HandleAssetLoaded(UObject* Asset)
+{
+    if (bIsBuilt && Cast<UBlueprint>(Asset))
+    {
+        Invalidate();
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UClass;
+class UObject;
+
+// Case-folded short name lookup for loaded AActor subclasses, including Blueprint generated classes.
+// Built lazily on first use and dropped whenever the set of loaded classes can change.
+class FUEAIAgentClassIndex
+{
+public:
+    static FUEAIAgentClassIndex& Get();
+
+    void Startup();
+    void Shutdown();
+
+    UClass* FindActorClass(const FString& ClassName);
+    void Invalidate();
+
+private:
+    void Rebuild();
+    void AddClass(UClass* Class);
+    void BindEditorDelegates();
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+    void HandleAssetLoaded(UObject* Asset);
+
+    TMap<FString, TWeakObjectPtr<UClass>> ClassesByName;
+    bool bIsBuilt = false;
+
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle AssetLoadedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
@@ -0,0 +1,58 @@
+#include "UEAIAgentComponentResolver.h"
+
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+
+FUEAIAgentComponentResolver::FUEAIAgentComponentResolver(const FString& ComponentName, FUEAIAgentComponentClassCache* SharedClassCache)
+    : ComponentKey(*ComponentName, FNAME_Find)
+    , ClassCache(SharedClassCache ? SharedClassCache : &LocalClassCache)
+{
+}
+
+void FUEAIAgentComponentResolver::FindAll(AActor* Actor, TArray<UActorComponent*>& OutComponents)
+{
+    OutComponents.Reset();
+
+    // FNAME_Find leaves the key empty when no object anywhere carries that name.
+    if (!Actor || ComponentKey.IsNone())
+    {
+        return;
+    }
+
+    const TPair<const UClass*, FName> ClassKey(Actor->GetClass(), ComponentKey);
+    const bool* bScanClass = ClassCache->Find(ClassKey);
+    if (bScanClass && !*bScanClass)
+    {
+        UActorComponent* Component = Cast<UActorComponent>(
+            StaticFindObjectFast(UActorComponent::StaticClass(), Actor, ComponentKey));
+        if (Component && Component->GetOwner() == Actor)
+        {
+            OutComponents.Add(Component);
+        }
+        return;
+    }
+
+    FindByScan(Actor, OutComponents);
+    if (!bScanClass && !OutComponents.IsEmpty())
+    {
+        const bool bOuteredElsewhere = OutComponents.ContainsByPredicate([Actor](const UActorComponent* Component)
+        {
+            return Component->GetOuter() != Actor;
+        });
+        ClassCache->Add(ClassKey, bOuteredElsewhere);
+    }
+}
+
+void FUEAIAgentComponentResolver::FindByScan(AActor* Actor, TArray<UActorComponent*>& OutComponents)
+{
+    ScratchComponents.Reset();
+    Actor->GetComponents(ScratchComponents);
+    for (UActorComponent* Component : ScratchComponents)
+    {
+        if (Component && Component->GetFName() == ComponentKey)
+        {
+            OutComponents.Add(Component);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UActorComponent;
+class UClass;
+
+// Per class and component name: true when a scan found a match that is not outered to its actor,
+// which the hashed lookup cannot see, so actors of that class are always scanned.
+using FUEAIAgentComponentClassCache = TMap<TPair<const UClass*, FName>, bool>;
+
+// Finds the components of an actor with a given name through the component's FName instead of string
+// compares. Object names are unique per outer, so a component outered to its actor is found with one
+// hashed lookup. The first actor of each class with a match is scanned to learn whether every match sits
+// under the actor; if so, later actors of that class use the lookup. Classes without a match yet are
+// scanned, since another actor of the class can carry an instance component the first one lacked.
+// Holds a pointer into itself, so it is neither copied nor moved.
+class FUEAIAgentComponentResolver
+{
+public:
+    FUEAIAgentComponentResolver(const FString& ComponentName, FUEAIAgentComponentClassCache* SharedClassCache);
+
+    FUEAIAgentComponentResolver(const FUEAIAgentComponentResolver&) = delete;
+    FUEAIAgentComponentResolver(FUEAIAgentComponentResolver&&) = delete;
+    FUEAIAgentComponentResolver& operator=(const FUEAIAgentComponentResolver&) = delete;
+    FUEAIAgentComponentResolver& operator=(FUEAIAgentComponentResolver&&) = delete;
+
+    // Replaces OutComponents with every component of Actor named like the resolver's component.
+    void FindAll(AActor* Actor, TArray<UActorComponent*>& OutComponents);
+
+private:
+    void FindByScan(AActor* Actor, TArray<UActorComponent*>& OutComponents);
+
+    FName ComponentKey;
+    TArray<UActorComponent*> ScratchComponents;
+    FUEAIAgentComponentClassCache LocalClassCache;
+    FUEAIAgentComponentClassCache* ClassCache = nullptr;
+};
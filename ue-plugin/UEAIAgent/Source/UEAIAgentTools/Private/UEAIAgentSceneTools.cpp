@@ -1,19 +1,28 @@
 #include "UEAIAgentSceneTools.h"
 
+#include "UEAIAgentActorIndex.h"
+#include "UEAIAgentAssetCache.h"
+#include "UEAIAgentComponentResolver.h"
+#include "UEAIAgentClassIndex.h"
+#include "UEAIAgentSettings.h"
+#include "UEAIAgentTransportModule.h"
 #include "Editor.h"
 #include "Engine/Selection.h"
-#include "EngineUtils.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "ScopedTransaction.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Materials/MaterialInterface.h"
 #include "Engine/StaticMesh.h"
-#include "UObject/UObjectIterator.h"
+#include "Engine/StaticMeshActor.h"
 #include "UObject/UObjectGlobals.h"
 #include "Subsystems/EditorActorSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
+#include "Misc/PackageName.h"
 
 #define LOCTEXT_NAMESPACE "UEAIAgentSceneTools"
 
@@ -21,6 +30,15 @@ namespace
 {
     TUniquePtr<FScopedTransaction> GUEAIAgentSessionTransaction;
 
+    struct FUEAIAgentBatchScope
+    {
+        TWeakObjectPtr<UWorld> World;
+        TMap<FString, TArray<TWeakObjectPtr<AActor>>> ResolvedTargets;
+        FUEAIAgentComponentClassCache ComponentClassCache;
+    };
+
+    FUEAIAgentBatchScope* GUEAIAgentActiveBatch = nullptr;
+
     void CollectActorsFromSelection(TArray<AActor*>& OutActors)
     {
         if (!GEditor)
@@ -37,40 +55,412 @@ namespace
         }
     }
 
+    FString BuildTargetKey(const TArray<FString>& ActorNames)
+    {
+        return FString::Join(ActorNames, TEXT("\n")).ToLower();
+    }
+
     void CollectActorsByName(UWorld* World, const TArray<FString>& ActorNames, TArray<AActor*>& OutActors)
     {
-        if (!World || ActorNames.IsEmpty())
+        if (!GUEAIAgentActiveBatch || GUEAIAgentActiveBatch->World.Get() != World)
+        {
+            FUEAIAgentActorIndex::Get().FindActorsByName(World, ActorNames, OutActors);
+            return;
+        }
+
+        const FString TargetKey = BuildTargetKey(ActorNames);
+        if (const TArray<TWeakObjectPtr<AActor>>* CachedTargets = GUEAIAgentActiveBatch->ResolvedTargets.Find(TargetKey))
+        {
+            for (const TWeakObjectPtr<AActor>& CachedTarget : *CachedTargets)
+            {
+                if (AActor* Actor = CachedTarget.Get())
+                {
+                    OutActors.Add(Actor);
+                }
+            }
+            return;
+        }
+
+        TArray<AActor*> ResolvedActors;
+        FUEAIAgentActorIndex::Get().FindActorsByName(World, ActorNames, ResolvedActors);
+        TArray<TWeakObjectPtr<AActor>>& CachedTargets = GUEAIAgentActiveBatch->ResolvedTargets.Add(TargetKey);
+        CachedTargets.Reserve(ResolvedActors.Num());
+        for (AActor* Actor : ResolvedActors)
+        {
+            CachedTargets.Add(Actor);
+        }
+        OutActors.Append(ResolvedActors);
+    }
+
+    UStaticMeshComponent* FindInstanceableMeshComponent(AActor* Actor)
+    {
+        const AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor);
+        UStaticMeshComponent* MeshComponent = MeshActor ? MeshActor->GetStaticMeshComponent() : nullptr;
+        return MeshComponent && MeshComponent->GetStaticMesh() ? MeshComponent : nullptr;
+    }
+
+    UHierarchicalInstancedStaticMeshComponent* SpawnInstancedMeshActor(
+        UWorld* World,
+        UStaticMesh* Mesh,
+        const TArray<UMaterialInterface*>& Materials,
+        const FTransform& HostTransform)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        AActor* Host = World->SpawnActor<AActor>(AActor::StaticClass(), HostTransform, SpawnParams);
+        if (!Host)
+        {
+            return nullptr;
+        }
+
+        Host->Modify();
+        UHierarchicalInstancedStaticMeshComponent* Instances =
+            NewObject<UHierarchicalInstancedStaticMeshComponent>(Host, TEXT("InstancedMesh"), RF_Transactional);
+        Instances->SetStaticMesh(Mesh);
+        for (int32 SlotIndex = 0; SlotIndex < Materials.Num(); ++SlotIndex)
+        {
+            if (Materials[SlotIndex])
+            {
+                Instances->SetMaterial(SlotIndex, Materials[SlotIndex]);
+            }
+        }
+        Host->SetRootComponent(Instances);
+        Host->AddInstanceComponent(Instances);
+        Instances->RegisterComponent();
+        Host->SetActorTransform(HostTransform);
+        Host->SetActorLabel(FString::Printf(TEXT("%s_Instanced"), *Mesh->GetName()), true);
+        return Instances;
+    }
+
+    FUEAIAgentComponentClassCache* GetBatchComponentClassCache()
+    {
+        return GUEAIAgentActiveBatch ? &GUEAIAgentActiveBatch->ComponentClassCache : nullptr;
+    }
+
+    bool IsSessionActionType(EUEAIAgentPlannedActionType Type)
+    {
+        return Type == EUEAIAgentPlannedActionType::SessionBeginTransaction ||
+            Type == EUEAIAgentPlannedActionType::SessionCommitTransaction ||
+            Type == EUEAIAgentPlannedActionType::SessionRollbackTransaction;
+    }
+
+    bool ChangesActorNames(EUEAIAgentPlannedActionType Type)
+    {
+        return Type == EUEAIAgentPlannedActionType::CreateActor ||
+            Type == EUEAIAgentPlannedActionType::DeleteActor ||
+            Type == EUEAIAgentPlannedActionType::AddActorLabelPrefix ||
+            Type == EUEAIAgentPlannedActionType::DuplicateActors;
+    }
+
+    EParallelForFlags GetParallelForFlags(int32 Num)
+    {
+        return Num > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+    }
+
+    // Resolves target sets of the actions from StartIndex up to the next one that adds, removes or renames actors.
+    void PrefetchBatchTargets(FUEAIAgentBatchScope& BatchScope, TArrayView<const FUEAIAgentPlannedSceneAction> Actions, int32 StartIndex)
+    {
+        UWorld* World = BatchScope.World.Get();
+        if (!World)
+        {
+            return;
+        }
+
+        TSet<FString> SeenKeys;
+        TArray<FString> PendingKeys;
+        TArray<const TArray<FString>*> PendingNames;
+        for (int32 ActionIndex = StartIndex; ActionIndex < Actions.Num(); ++ActionIndex)
+        {
+            const FUEAIAgentPlannedSceneAction& Action = Actions[ActionIndex];
+            if (!Action.ActorNames.IsEmpty())
+            {
+                FString TargetKey = BuildTargetKey(Action.ActorNames);
+                bool bAlreadySeen = false;
+                SeenKeys.Add(TargetKey, &bAlreadySeen);
+                if (!bAlreadySeen && !BatchScope.ResolvedTargets.Contains(TargetKey))
+                {
+                    PendingKeys.Add(MoveTemp(TargetKey));
+                    PendingNames.Add(&Action.ActorNames);
+                }
+            }
+
+            if (ChangesActorNames(Action.Type))
+            {
+                break;
+            }
+        }
+
+        if (PendingKeys.IsEmpty())
         {
             return;
         }
 
-        TSet<FString> NameSet;
-        for (const FString& Name : ActorNames)
+        FUEAIAgentActorIndex& ActorIndex = FUEAIAgentActorIndex::Get();
+        ActorIndex.PrepareWorld(World);
+
+        // Names and labels are copied out of the actors on the game thread. Matching then runs on plain
+        // strings across worker threads, and the weak pointers are handed back here.
+        FUEAIAgentActorIndex::FLookupSnapshot Snapshot;
+        ActorIndex.SnapshotCandidates(PendingNames, Snapshot);
+
+        TArray<TArray<int32>> Matches;
+        Matches.SetNum(PendingKeys.Num());
+        ParallelFor(
+            PendingKeys.Num(),
+            [&Snapshot, &PendingNames, &Matches](int32 KeyIndex)
+            {
+                FUEAIAgentActorIndex::MatchSnapshot(Snapshot, *PendingNames[KeyIndex], Matches[KeyIndex]);
+            },
+            GetParallelForFlags(PendingKeys.Num()));
+
+        for (int32 KeyIndex = 0; KeyIndex < PendingKeys.Num(); ++KeyIndex)
         {
-            NameSet.Add(Name);
-            NameSet.Add(Name.ToLower());
+            TArray<TWeakObjectPtr<AActor>>& CachedTargets = BatchScope.ResolvedTargets.Add(PendingKeys[KeyIndex]);
+            CachedTargets.Reserve(Matches[KeyIndex].Num());
+            for (const int32 CandidateIndex : Matches[KeyIndex])
+            {
+                CachedTargets.Add(Snapshot.Candidates[CandidateIndex].Actor);
+            }
         }
-        for (TActorIterator<AActor> It(World); It; ++It)
+    }
+
+    bool IsBatchBarrier(EUEAIAgentPlannedActionType Type)
+    {
+        return ChangesActorNames(Type) || IsSessionActionType(Type);
+    }
+
+    // Appends the run order of the actions from StartIndex through the next barrier, an action that adds, removes
+    // or renames actors or a session action, and returns the index after it. Actions before the barrier are grouped
+    // by target list, so edits to the same actors run back to back, as long as the resolved target sets of different
+    // lists do not overlap; otherwise they keep plan order. The barrier always runs last.
+    int32 AppendBatchSegmentOrder(
+        const FUEAIAgentBatchScope& BatchScope,
+        TArrayView<const FUEAIAgentPlannedSceneAction> Actions,
+        int32 StartIndex,
+        TArray<int32>& OutOrder)
+    {
+        int32 EndIndex = StartIndex;
+        while (EndIndex < Actions.Num() && !IsBatchBarrier(Actions[EndIndex].Type))
+        {
+            ++EndIndex;
+        }
+
+        TMap<FString, int32> GroupByKey;
+        TMap<TWeakObjectPtr<AActor>, int32> GroupByActor;
+        TArray<TArray<int32>> Groups;
+        bool bCanGroup = true;
+        for (int32 ActionIndex = StartIndex; bCanGroup && ActionIndex < EndIndex; ++ActionIndex)
         {
-            AActor* Actor = *It;
-            if (!Actor)
+            const FUEAIAgentPlannedSceneAction& Action = Actions[ActionIndex];
+            FString TargetKey = BuildTargetKey(Action.ActorNames);
+            if (const int32* ExistingGroup = GroupByKey.Find(TargetKey))
             {
+                Groups[*ExistingGroup].Add(ActionIndex);
                 continue;
             }
 
-            const FString ActorName = Actor->GetName();
-            const FString ActorLabel = Actor->GetActorLabel();
-            const FString ActorNameLower = ActorName.ToLower();
-            const FString ActorLabelLower = ActorLabel.ToLower();
+            // Without resolved targets a modify falls back to the selection, which may overlap anything.
+            const TArray<TWeakObjectPtr<AActor>>* Targets = BatchScope.ResolvedTargets.Find(TargetKey);
+            if (Action.ActorNames.IsEmpty() || !Targets || Targets->IsEmpty())
+            {
+                bCanGroup = false;
+                break;
+            }
 
-            if (NameSet.Contains(ActorName) ||
-                NameSet.Contains(ActorLabel) ||
-                NameSet.Contains(ActorNameLower) ||
-                NameSet.Contains(ActorLabelLower))
+            const int32 GroupIndex = Groups.Add(TArray<int32>{ ActionIndex });
+            GroupByKey.Add(MoveTemp(TargetKey), GroupIndex);
+            for (const TWeakObjectPtr<AActor>& Target : *Targets)
             {
-                OutActors.Add(Actor);
+                if (const int32* OwnerGroup = GroupByActor.Find(Target))
+                {
+                    if (*OwnerGroup != GroupIndex)
+                    {
+                        bCanGroup = false;
+                        break;
+                    }
+                    continue;
+                }
+                GroupByActor.Add(Target, GroupIndex);
             }
         }
+
+        if (bCanGroup)
+        {
+            for (const TArray<int32>& Group : Groups)
+            {
+                OutOrder.Append(Group);
+            }
+        }
+        else
+        {
+            for (int32 ActionIndex = StartIndex; ActionIndex < EndIndex; ++ActionIndex)
+            {
+                OutOrder.Add(ActionIndex);
+            }
+        }
+
+        if (EndIndex < Actions.Num())
+        {
+            OutOrder.Add(EndIndex);
+            return EndIndex + 1;
+        }
+        return EndIndex;
+    }
+
+    const FString& GetActionAssetPath(const FUEAIAgentPlannedSceneAction& Action)
+    {
+        static const FString NoAssetPath;
+        switch (Action.Type)
+        {
+        case EUEAIAgentPlannedActionType::SetComponentMaterial:
+            return Action.MaterialPath;
+        case EUEAIAgentPlannedActionType::SetComponentStaticMesh:
+            return Action.MeshPath;
+        case EUEAIAgentPlannedActionType::CreateActor:
+            return Action.bSpawnInstanced ? Action.SpawnMeshPath : NoAssetPath;
+        default:
+            return NoAssetPath;
+        }
+    }
+
+    // Checks that every asset package referenced by the batch exists before anything is mutated.
+    void ValidateBatchAssets(TArrayView<const FUEAIAgentPlannedSceneAction> Actions, TArray<bool>& OutMissingAsset)
+    {
+        OutMissingAsset.Init(false, Actions.Num());
+
+        TArray<int32> PendingActionIndices;
+        TArray<FString> PendingPackageNames;
+        for (int32 ActionIndex = 0; ActionIndex < Actions.Num(); ++ActionIndex)
+        {
+            const FString& AssetPath = GetActionAssetPath(Actions[ActionIndex]);
+            if (!AssetPath.StartsWith(TEXT("/")) || FSoftObjectPath(AssetPath).ResolveObject())
+            {
+                continue;
+            }
+
+            PendingActionIndices.Add(ActionIndex);
+            PendingPackageNames.Add(FPackageName::ObjectPathToPackageName(AssetPath));
+        }
+
+        ParallelFor(
+            PendingActionIndices.Num(),
+            [&PendingActionIndices, &PendingPackageNames, &OutMissingAsset](int32 PendingIndex)
+            {
+                if (!FPackageName::DoesPackageExist(PendingPackageNames[PendingIndex]))
+                {
+                    OutMissingAsset[PendingActionIndices[PendingIndex]] = true;
+                }
+            },
+            GetParallelForFlags(PendingActionIndices.Num()));
+    }
+
+    // Per-target steps of modifyActor and deleteActor, shared with the time-sliced batch that runs them a slice at a time.
+    void ModifyTargetActor(AActor* Actor, const FUEAIAgentModifyActorParams& Params, FUEAIAgentToolResult& OutResult)
+    {
+        Actor->Modify();
+        const FVector NewLocation = Actor->GetActorLocation() + Params.DeltaLocation;
+        Actor->SetActorLocation(NewLocation, false, nullptr, ETeleportType::None);
+        const FRotator NewRotation = Actor->GetActorRotation() + Params.DeltaRotation;
+        Actor->SetActorRotation(NewRotation, ETeleportType::None);
+        if (Params.bHasScale)
+        {
+            Actor->SetActorScale3D(Params.Scale);
+        }
+        else
+        {
+            const FVector NewScale = Actor->GetActorScale3D() + Params.DeltaScale;
+            Actor->SetActorScale3D(NewScale);
+        }
+        OutResult.AffectedActors.Add(Actor->GetFName());
+    }
+
+    void DeleteTargetActor(AActor* Actor, FUEAIAgentToolResult& OutResult)
+    {
+        const FName ActorName = Actor->GetFName();
+        Actor->Modify();
+        if (Actor->Destroy())
+        {
+            OutResult.AffectedActors.Add(ActorName);
+        }
+    }
+
+    bool CompleteToolResult(FUEAIAgentToolResult& OutResult, int32 TargetCount)
+    {
+        OutResult.TargetCount = TargetCount;
+        OutResult.bOk = OutResult.ActorCount + OutResult.ComponentCount + OutResult.InstanceCount > 0;
+        OutResult.ErrorCode = OutResult.bOk ? EUEAIAgentToolErrorCode::None : EUEAIAgentToolErrorCode::NothingChanged;
+        return OutResult.bOk;
+    }
+
+    const TCHAR* GetActionToolName(EUEAIAgentPlannedActionType Type)
+    {
+        switch (Type)
+        {
+        case EUEAIAgentPlannedActionType::CreateActor:
+            return TEXT("scene.createActor");
+        case EUEAIAgentPlannedActionType::DeleteActor:
+            return TEXT("scene.deleteActor");
+        case EUEAIAgentPlannedActionType::ModifyComponent:
+            return TEXT("scene.modifyComponent");
+        case EUEAIAgentPlannedActionType::AddActorTag:
+            return TEXT("scene.addActorTag");
+        case EUEAIAgentPlannedActionType::SetComponentMaterial:
+            return TEXT("scene.setComponentMaterial");
+        case EUEAIAgentPlannedActionType::SetComponentStaticMesh:
+            return TEXT("scene.setComponentStaticMesh");
+        case EUEAIAgentPlannedActionType::SetActorFolder:
+            return TEXT("scene.setActorFolder");
+        case EUEAIAgentPlannedActionType::AddActorLabelPrefix:
+            return TEXT("scene.addActorLabelPrefix");
+        case EUEAIAgentPlannedActionType::DuplicateActors:
+            return TEXT("scene.duplicateActors");
+        case EUEAIAgentPlannedActionType::SessionBeginTransaction:
+            return TEXT("session.beginTransaction");
+        case EUEAIAgentPlannedActionType::SessionCommitTransaction:
+            return TEXT("session.commitTransaction");
+        case EUEAIAgentPlannedActionType::SessionRollbackTransaction:
+            return TEXT("session.rollbackTransaction");
+        default:
+            return TEXT("scene.modifyActor");
+        }
+    }
+
+    struct FToolTimingScope
+    {
+        explicit FToolTimingScope(FUEAIAgentToolResult& InResult)
+            : Result(InResult)
+            , StartTime(FPlatformTime::Seconds())
+        {
+        }
+
+        ~FToolTimingScope()
+        {
+            Result.DurationSeconds = FPlatformTime::Seconds() - StartTime;
+        }
+
+        FUEAIAgentToolResult& Result;
+        const double StartTime;
+    };
+
+    FUEAIAgentToolResult MakeMissingAssetResult(const FUEAIAgentPlannedSceneAction& Action)
+    {
+        FUEAIAgentToolResult Result(GetActionToolName(Action.Type));
+        Result.Fail(EUEAIAgentToolErrorCode::AssetNotFound, TEXT("Asset does not exist:"));
+        Result.Detail = GetActionAssetPath(Action);
+        return Result;
+    }
+
+    FUEAIAgentModifyActorParams MakeModifyActorParams(const FUEAIAgentPlannedSceneAction& PlannedAction)
+    {
+        FUEAIAgentModifyActorParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.DeltaLocation = PlannedAction.DeltaLocation;
+        Params.DeltaRotation = PlannedAction.DeltaRotation;
+        Params.DeltaScale = PlannedAction.DeltaScale;
+        Params.Scale = PlannedAction.Scale;
+        Params.bHasScale = PlannedAction.bHasScale;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        return Params;
     }
 
     UClass* ResolveActorClass(const FString& ActorClassNameOrPath)
@@ -97,37 +487,392 @@ namespace
             return ResolvedClass;
         }
 
-        for (TObjectIterator<UClass> It; It; ++It)
+        if (UClass* IndexedClass = FUEAIAgentClassIndex::Get().FindActorClass(ActorClassNameOrPath))
+        {
+            return IndexedClass;
+        }
+
+        return AActor::StaticClass();
+    }
+
+    int32 GetClampedCreateCount(int32 RequestedCount)
+    {
+        return FMath::Clamp(RequestedCount, 1, FMath::Max(1, GetDefault<UUEAIAgentSettings>()->MaxCreateActorCount));
+    }
+
+    // The spawn runs the actor's construction script and registers its components before it returns.
+    void SpawnCreatedActor(UWorld* World, UClass* ActorClass, const FTransform& SpawnTransform, FUEAIAgentToolResult& OutResult)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        if (AActor* Spawned = World->SpawnActor(ActorClass, &SpawnTransform, SpawnParams))
+        {
+            Spawned->Modify();
+            OutResult.AffectedActors.Add(Spawned->GetFName());
+        }
+    }
+
+    constexpr double TimeSliceBudgetSeconds = 0.004;
+    constexpr int32 TimeSliceTargetThreshold = 256;
+    constexpr int32 TimeSliceClockCheckInterval = 32;
+
+    // Runs a plan as one batch: targets are resolved once per segment between barriers, actions are grouped by
+    // target within a segment, and the whole plan lands in one undo entry unless it manages its own session
+    // transaction. Results keep plan order. Driven either a slice per tick or to completion in one call.
+    class FUEAIAgentTimeSlicedBatch
+    {
+    public:
+        FUEAIAgentTimeSlicedBatch(
+            TArray<FUEAIAgentPlannedSceneAction>&& InActions,
+            const FOnUEAIAgentBatchProgress& InOnProgress,
+            const FOnUEAIAgentBatchFinished& InOnFinished)
+            : Actions(MoveTemp(InActions))
+            , OnProgress(InOnProgress)
+            , OnFinished(InOnFinished)
         {
-            UClass* Candidate = *It;
-            if (!Candidate || !Candidate->IsChildOf(AActor::StaticClass()))
+            BatchScope.World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+
+            bool bHasSessionAction = false;
+            for (const FUEAIAgentPlannedSceneAction& Action : Actions)
             {
-                continue;
+                bHasSessionAction |= IsSessionActionType(Action.Type);
             }
 
-            if (Candidate->GetName().Equals(ActorClassNameOrPath, ESearchCase::IgnoreCase))
+            // Held across ticks so chunked edits still land in one undo entry.
+            if (GEditor && !bHasSessionAction)
             {
-                return Candidate;
+                Transaction = MakeUnique<FScopedTransaction>(LOCTEXT("ExecuteBatchTransaction", "UE AI Agent Apply Plan"));
             }
+
+            Results.SetNum(Actions.Num());
+            Order.Reserve(Actions.Num());
+            ValidateBatchAssets(Actions, MissingAsset);
         }
 
-        return AActor::StaticClass();
+        // Runs actions until the slice budget is spent. Returns true once every action has run.
+        bool Tick()
+        {
+            TGuardValue<FUEAIAgentBatchScope*> BatchGuard(GUEAIAgentActiveBatch, &BatchScope);
+            const double SliceEndTime = FPlatformTime::Seconds() + TimeSliceBudgetSeconds;
+            while (StepIndex < Actions.Num() && FPlatformTime::Seconds() < SliceEndTime)
+            {
+                Step(SliceEndTime);
+            }
+
+            OnProgress.ExecuteIfBound(GetProgress());
+            return StepIndex >= Actions.Num();
+        }
+
+        // Runs every action without yielding, closes the transaction and hands back the results.
+        bool RunToCompletion(TArray<FUEAIAgentToolResult>& OutResults)
+        {
+            {
+                TGuardValue<FUEAIAgentBatchScope*> BatchGuard(GUEAIAgentActiveBatch, &BatchScope);
+                while (StepIndex < Actions.Num())
+                {
+                    Step(TNumericLimits<double>::Max());
+                }
+            }
+
+            Transaction.Reset();
+            OutResults = MoveTemp(Results);
+            return bAllOk;
+        }
+
+        // Skips the remaining actions and closes the transaction, keeping what already ran as one undo entry.
+        void Abort()
+        {
+            bChunkActive = false;
+            bAborted = true;
+            ChunkTransaction.Reset();
+            Transaction.Reset();
+            while (StepIndex < Actions.Num())
+            {
+                FUEAIAgentToolResult Result(GetActionToolName(Actions[GetCurrentActionIndex()].Type));
+                Result.Fail(EUEAIAgentToolErrorCode::Stopped, TEXT("Stopped before the action could run."));
+                FinishAction(MoveTemp(Result));
+            }
+        }
+
+        bool EditsWorld(const UWorld* World) const
+        {
+            // A world that is already gone counts too; the batch has nothing left to edit.
+            return !BatchScope.World.IsValid() || BatchScope.World.Get() == World;
+        }
+
+        void Complete()
+        {
+            Transaction.Reset();
+            OnFinished.ExecuteIfBound(bAllOk, Results);
+        }
+
+    private:
+        FUEAIAgentBatchProgress GetProgress() const
+        {
+            FUEAIAgentBatchProgress Progress;
+            Progress.ActionIndex = StepIndex;
+            Progress.ActionCount = Actions.Num();
+            Progress.ProcessedTargets = bChunkActive ? ChunkCursor : 0;
+            Progress.TargetCount = bChunkActive ? ChunkTargetCount : 0;
+            return Progress;
+        }
+
+        // Plan index of the action at StepIndex. The next segment is ordered, and its targets resolved,
+        // only once the previous one has run, since its barrier may have changed which actors exist.
+        int32 GetCurrentActionIndex()
+        {
+            if (StepIndex == Order.Num())
+            {
+                if (bAborted)
+                {
+                    for (int32 ActionIndex = SegmentStart; ActionIndex < Actions.Num(); ++ActionIndex)
+                    {
+                        Order.Add(ActionIndex);
+                    }
+                    SegmentStart = Actions.Num();
+                }
+                else
+                {
+                    PrefetchBatchTargets(BatchScope, Actions, SegmentStart);
+                    SegmentStart = AppendBatchSegmentOrder(BatchScope, Actions, SegmentStart, Order);
+                }
+            }
+            return Order[StepIndex];
+        }
+
+        void Step(double SliceEndTime)
+        {
+            if (bChunkActive)
+            {
+                ContinueChunk(SliceEndTime);
+            }
+            else
+            {
+                StartAction();
+            }
+        }
+
+        void StartAction()
+        {
+            const int32 ActionIndex = GetCurrentActionIndex();
+            const FUEAIAgentPlannedSceneAction& Action = Actions[ActionIndex];
+            if (MissingAsset[ActionIndex])
+            {
+                FinishAction(MakeMissingAssetResult(Action));
+                return;
+            }
+
+            if (BeginChunkedAction(Action))
+            {
+                // Per-tool transactions cannot span ticks, so a chunk that runs under neither the batch nor a
+                // session transaction opens its own to stay undoable.
+                if (GEditor && !Transaction && !GUEAIAgentSessionTransaction)
+                {
+                    ChunkTransaction = MakeUnique<FScopedTransaction>(
+                        FText::Format(LOCTEXT("ChunkedActionTransaction", "UE AI Agent {0}"), FText::FromString(GetActionToolName(Action.Type))));
+                }
+                return;
+            }
+
+            FUEAIAgentToolResult Result;
+            FUEAIAgentSceneTools::ExecutePlannedAction(Action, Result);
+            FinishAction(MoveTemp(Result));
+        }
+
+        // Only large creates and large by-name modify/delete target lists are split across ticks; everything else
+        // runs in one go.
+        bool BeginChunkedAction(const FUEAIAgentPlannedSceneAction& Action)
+        {
+            if (Action.Type == EUEAIAgentPlannedActionType::CreateActor)
+            {
+                return BeginChunkedCreate(Action);
+            }
+
+            const bool bChunkableType = Action.Type == EUEAIAgentPlannedActionType::ModifyActor ||
+                Action.Type == EUEAIAgentPlannedActionType::DeleteActor;
+            UWorld* World = BatchScope.World.Get();
+            if (!bChunkableType || Action.ActorNames.IsEmpty() || !World)
+            {
+                return false;
+            }
+
+            TArray<AActor*> TargetActors;
+            CollectActorsByName(World, Action.ActorNames, TargetActors);
+            if (TargetActors.Num() <= TimeSliceTargetThreshold)
+            {
+                return false;
+            }
+
+            ChunkTargets.Reset(TargetActors.Num());
+            for (AActor* Actor : TargetActors)
+            {
+                ChunkTargets.Add(Actor);
+            }
+            ChunkTargetCount = ChunkTargets.Num();
+            ChunkCursor = 0;
+            ChunkResult = FUEAIAgentToolResult(GetActionToolName(Action.Type));
+            ChunkResult.AffectedActors.Reserve(TargetActors.Num());
+            ChunkModifyParams = MakeModifyActorParams(Action);
+            bChunkActive = true;
+            return true;
+        }
+
+        // Every spawn still pays for its own construction script and component registration; slicing only keeps
+        // that cost from landing in a single frame.
+        bool BeginChunkedCreate(const FUEAIAgentPlannedSceneAction& Action)
+        {
+            const int32 SpawnCount = GetClampedCreateCount(Action.SpawnCount);
+            if (Action.bSpawnInstanced || SpawnCount <= TimeSliceTargetThreshold || !BatchScope.World.IsValid())
+            {
+                return false;
+            }
+
+            ChunkActorClass = ResolveActorClass(Action.ActorClass);
+            ChunkSpawnTransform = FTransform(Action.SpawnRotation, Action.SpawnLocation);
+            ChunkTargets.Reset();
+            ChunkTargetCount = SpawnCount;
+            ChunkCursor = 0;
+            ChunkResult = FUEAIAgentToolResult(GetActionToolName(Action.Type));
+            ChunkResult.AffectedActors.Reserve(SpawnCount);
+            ChunkResult.RequestedCount = SpawnCount;
+            bChunkActive = true;
+            return true;
+        }
+
+        void ContinueChunk(double SliceEndTime)
+        {
+            const double SliceStartTime = FPlatformTime::Seconds();
+            const EUEAIAgentPlannedActionType Type = Actions[GetCurrentActionIndex()].Type;
+            const bool bCreate = Type == EUEAIAgentPlannedActionType::CreateActor;
+            // A spawn costs far more than reading the clock, so creates check the budget after every actor.
+            const int32 ClockCheckInterval = bCreate ? 1 : TimeSliceClockCheckInterval;
+            UWorld* World = BatchScope.World.Get();
+            UClass* ActorClass = ChunkActorClass.Get();
+            while (ChunkCursor < ChunkTargetCount)
+            {
+                if (bCreate)
+                {
+                    if (World && ActorClass)
+                    {
+                        SpawnCreatedActor(World, ActorClass, ChunkSpawnTransform, ChunkResult);
+                    }
+                }
+                else if (AActor* Actor = ChunkTargets[ChunkCursor].Get())
+                {
+                    if (Type == EUEAIAgentPlannedActionType::DeleteActor)
+                    {
+                        DeleteTargetActor(Actor, ChunkResult);
+                    }
+                    else
+                    {
+                        ModifyTargetActor(Actor, ChunkModifyParams, ChunkResult);
+                    }
+                }
+
+                ++ChunkCursor;
+                if (ChunkCursor % ClockCheckInterval == 0 && FPlatformTime::Seconds() >= SliceEndTime)
+                {
+                    ChunkResult.DurationSeconds += FPlatformTime::Seconds() - SliceStartTime;
+                    return;
+                }
+            }
+
+            bChunkActive = false;
+            ChunkTransaction.Reset();
+            ChunkResult.DurationSeconds += FPlatformTime::Seconds() - SliceStartTime;
+            ChunkResult.ActorCount = ChunkResult.AffectedActors.Num();
+            CompleteToolResult(ChunkResult, bCreate ? 0 : ChunkTargetCount);
+            if (bCreate && ChunkResult.ActorCount > 0 && GEditor)
+            {
+                GEditor->RedrawLevelEditingViewports();
+            }
+            FinishAction(MoveTemp(ChunkResult));
+        }
+
+        void FinishAction(FUEAIAgentToolResult&& Result)
+        {
+            const int32 ActionIndex = GetCurrentActionIndex();
+            bAllOk &= Result.bOk;
+            Results[ActionIndex] = MoveTemp(Result);
+
+            // A name-changing action always ends its segment; the next segment resolves its targets afresh.
+            if (!bAborted && ChangesActorNames(Actions[ActionIndex].Type))
+            {
+                BatchScope.ResolvedTargets.Reset();
+            }
+            ++StepIndex;
+        }
+
+        TArray<FUEAIAgentPlannedSceneAction> Actions;
+        FOnUEAIAgentBatchProgress OnProgress;
+        FOnUEAIAgentBatchFinished OnFinished;
+        FUEAIAgentBatchScope BatchScope;
+        TUniquePtr<FScopedTransaction> Transaction;
+        TArray<bool> MissingAsset;
+        TArray<FUEAIAgentToolResult> Results;
+        // Plan indices in run order, filled a segment at a time; StepIndex counts the actions already run.
+        TArray<int32> Order;
+        int32 StepIndex = 0;
+        int32 SegmentStart = 0;
+        bool bAllOk = true;
+        bool bAborted = false;
+
+        bool bChunkActive = false;
+        TUniquePtr<FScopedTransaction> ChunkTransaction;
+        TArray<TWeakObjectPtr<AActor>> ChunkTargets;
+        TWeakObjectPtr<UClass> ChunkActorClass;
+        FTransform ChunkSpawnTransform;
+        int32 ChunkTargetCount = 0;
+        int32 ChunkCursor = 0;
+        FUEAIAgentToolResult ChunkResult;
+        FUEAIAgentModifyActorParams ChunkModifyParams;
+    };
+
+    TSharedPtr<FUEAIAgentTimeSlicedBatch> GUEAIAgentTimeSlicedBatch;
+    FTSTicker::FDelegateHandle GUEAIAgentTimeSlicedTickerHandle;
+    FDelegateHandle GUEAIAgentWorldCleanupHandle;
+
+    // Tool calls from outside a running time-sliced batch would interleave with its open transaction and
+    // half-applied targets. Calls the batch makes itself run inside its scope and pass.
+    bool FailIfTimeSlicedBatchRunning(FUEAIAgentToolResult& OutResult)
+    {
+        if (!GUEAIAgentTimeSlicedBatch.IsValid() || GUEAIAgentActiveBatch)
+        {
+            return false;
+        }
+
+        OutResult.Fail(EUEAIAgentToolErrorCode::TransactionState, TEXT("Another plan is still being applied."));
+        return true;
+    }
+
+    void ReleaseTimeSlicedBatchHooks()
+    {
+        if (GUEAIAgentTimeSlicedTickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(GUEAIAgentTimeSlicedTickerHandle);
+            GUEAIAgentTimeSlicedTickerHandle.Reset();
+        }
+        FWorldDelegates::OnWorldCleanup.Remove(GUEAIAgentWorldCleanupHandle);
+        GUEAIAgentWorldCleanupHandle.Reset();
     }
 }
 
-bool FUEAIAgentSceneTools::SceneModifyActor(const FUEAIAgentModifyActorParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneModifyActor(const FUEAIAgentModifyActorParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.modifyActor"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     TArray<AActor*> TargetActors;
@@ -142,12 +887,11 @@ bool FUEAIAgentSceneTools::SceneModifyActor(const FUEAIAgentModifyActorParams& P
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneModifyActorTransaction", "UE AI Agent Scene Modify Actor"));
-    int32 UpdatedCount = 0;
+    OutResult.AffectedActors.Reserve(TargetActors.Num());
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -155,111 +899,99 @@ bool FUEAIAgentSceneTools::SceneModifyActor(const FUEAIAgentModifyActorParams& P
             continue;
         }
 
-        Actor->Modify();
-        const FVector NewLocation = Actor->GetActorLocation() + Params.DeltaLocation;
-        Actor->SetActorLocation(NewLocation, false, nullptr, ETeleportType::None);
-        const FRotator NewRotation = Actor->GetActorRotation() + Params.DeltaRotation;
-        Actor->SetActorRotation(NewRotation, ETeleportType::None);
-        if (Params.bHasScale)
-        {
-            Actor->SetActorScale3D(Params.Scale);
-        }
-        else
-        {
-            const FVector NewScale = Actor->GetActorScale3D() + Params.DeltaScale;
-            Actor->SetActorScale3D(NewScale);
-        }
-        ++UpdatedCount;
-    }
-
-    OutMessage = FString::Printf(
-        TEXT("scene.modifyActor applied to %d actor(s). DeltaLocation: X=%.2f Y=%.2f Z=%.2f, DeltaRotation: Pitch=%.2f Yaw=%.2f Roll=%.2f, DeltaScale: X=%.2f Y=%.2f Z=%.2f, Scale: X=%.2f Y=%.2f Z=%.2f"),
-        UpdatedCount,
-        Params.DeltaLocation.X,
-        Params.DeltaLocation.Y,
-        Params.DeltaLocation.Z,
-        Params.DeltaRotation.Pitch,
-        Params.DeltaRotation.Yaw,
-        Params.DeltaRotation.Roll,
-        Params.DeltaScale.X,
-        Params.DeltaScale.Y,
-        Params.DeltaScale.Z,
-        Params.Scale.X,
-        Params.Scale.Y,
-        Params.Scale.Z);
-
-    return UpdatedCount > 0;
+        ModifyTargetActor(Actor, Params, OutResult);
+    }
+
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneCreateActor(const FUEAIAgentCreateActorParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneCreateActor(const FUEAIAgentCreateActorParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.createActor"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
-
-    UWorld* World = GEditor->GetEditorWorldContext().World();
-    if (!World)
+    if (!GEditor)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
     }
 
-    const int32 SpawnCount = FMath::Clamp(Params.Count, 1, 200);
-    UClass* ActorClass = ResolveActorClass(Params.ActorClass);
-    if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
     {
-        OutMessage = TEXT("Actor class is invalid.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
-    const FScopedTransaction Transaction(LOCTEXT("SceneCreateActorTransaction", "UE AI Agent Scene Create Actor"));
-    int32 CreatedCount = 0;
-    for (int32 Index = 0; Index < SpawnCount; ++Index)
+    const int32 SpawnCount = GetClampedCreateCount(Params.Count);
+    const FTransform SpawnTransform(Params.Rotation, Params.Location);
+    if (Params.bInstanced)
     {
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.Name = NAME_None;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        UStaticMesh* Mesh = FUEAIAgentAssetCache::Get().ResolveStaticMesh(Params.MeshPath);
+        if (!Mesh)
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::AssetNotFound, TEXT("Instanced create needs a static mesh path that can be loaded."));
+        }
 
-        AActor* Spawned = World->SpawnActor<AActor>(ActorClass, Params.Location, Params.Rotation, SpawnParams);
-        if (!Spawned)
+        const FScopedTransaction Transaction(LOCTEXT("SceneCreateActorTransaction", "UE AI Agent Scene Create Actor"));
+        UHierarchicalInstancedStaticMeshComponent* Instances = SpawnInstancedMeshActor(World, Mesh, {}, SpawnTransform);
+        if (!Instances)
         {
-            continue;
+            return OutResult.Fail(EUEAIAgentToolErrorCode::SpawnFailed, TEXT("Instanced mesh actor could not be spawned."));
         }
 
-        Spawned->Modify();
-        ++CreatedCount;
+        TArray<FTransform> InstanceTransforms;
+        InstanceTransforms.Init(FTransform::Identity, SpawnCount);
+        const TArray<int32> InstanceIndices = Instances->AddInstances(InstanceTransforms, true, false);
+        OutResult.AffectedActors.Add(Instances->GetOwner()->GetFName());
+        OutResult.ActorCount = 1;
+        OutResult.RecordInstances(Instances->GetOwner()->GetFName(), InstanceIndices);
+        OutResult.RequestedCount = SpawnCount;
+        return CompleteToolResult(OutResult, 0);
+    }
+
+    UClass* ActorClass = ResolveActorClass(Params.ActorClass);
+    if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Actor class is invalid."));
+    }
+
+    // Every actor is constructed and registered as it spawns, so a direct call pays for all of them in this
+    // frame; only the viewport redraw is shared. ExecuteBatchTimeSliced spreads large counts over ticks.
+    const FScopedTransaction Transaction(LOCTEXT("SceneCreateActorTransaction", "UE AI Agent Scene Create Actor"));
+    OutResult.AffectedActors.Reserve(SpawnCount);
+    for (int32 Index = 0; Index < SpawnCount; ++Index)
+    {
+        SpawnCreatedActor(World, ActorClass, SpawnTransform, OutResult);
     }
 
-    OutMessage = FString::Printf(
-        TEXT("scene.createActor created %d/%d actor(s). Class: %s, Location: X=%.2f Y=%.2f Z=%.2f, Rotation: Pitch=%.2f Yaw=%.2f Roll=%.2f"),
-        CreatedCount,
-        SpawnCount,
-        *ActorClass->GetName(),
-        Params.Location.X,
-        Params.Location.Y,
-        Params.Location.Z,
-        Params.Rotation.Pitch,
-        Params.Rotation.Yaw,
-        Params.Rotation.Roll);
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    OutResult.RequestedCount = SpawnCount;
+    if (OutResult.ActorCount > 0)
+    {
+        GEditor->RedrawLevelEditingViewports();
+    }
 
-    return CreatedCount > 0;
+    return CompleteToolResult(OutResult, 0);
 }
 
-bool FUEAIAgentSceneTools::SceneDeleteActor(const FUEAIAgentDeleteActorParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneDeleteActor(const FUEAIAgentDeleteActorParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.deleteActor"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     TArray<AActor*> TargetActors;
@@ -274,12 +1006,11 @@ bool FUEAIAgentSceneTools::SceneDeleteActor(const FUEAIAgentDeleteActorParams& P
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneDeleteActorTransaction", "UE AI Agent Scene Delete Actor"));
-    int32 DeletedCount = 0;
+    OutResult.AffectedActors.Reserve(TargetActors.Num());
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -287,36 +1018,34 @@ bool FUEAIAgentSceneTools::SceneDeleteActor(const FUEAIAgentDeleteActorParams& P
             continue;
         }
 
-        Actor->Modify();
-        if (Actor->Destroy())
-        {
-            ++DeletedCount;
-        }
+        DeleteTargetActor(Actor, OutResult);
     }
 
-    OutMessage = FString::Printf(TEXT("scene.deleteActor deleted %d actor(s)."), DeletedCount);
-    return DeletedCount > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.modifyComponent"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     if (Params.ComponentName.IsEmpty())
     {
-        OutMessage = TEXT("Component name is required.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Component name is required."));
     }
 
     const bool bHasDelta =
@@ -325,8 +1054,7 @@ bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentP
         !Params.DeltaScale.IsNearlyZero();
     if (!bHasDelta && !Params.bSetVisibility)
     {
-        OutMessage = TEXT("No component edits specified.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("No component edits specified."));
     }
 
     TArray<AActor*> TargetActors;
@@ -341,13 +1069,12 @@ bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentP
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneModifyComponentTransaction", "UE AI Agent Modify Component"));
-    int32 UpdatedComponents = 0;
-    int32 UpdatedActors = 0;
+    FUEAIAgentComponentResolver ComponentResolver(Params.ComponentName, GetBatchComponentClassCache());
+    TArray<UActorComponent*> Components;
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -356,21 +1083,9 @@ bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentP
         }
 
         bool bActorTouched = false;
-        TArray<UActorComponent*> Components;
-        Actor->GetComponents(Components);
+        ComponentResolver.FindAll(Actor, Components);
         for (UActorComponent* Component : Components)
         {
-            if (!Component)
-            {
-                continue;
-            }
-
-            const FString ComponentName = Component->GetName();
-            if (!ComponentName.Equals(Params.ComponentName, ESearchCase::IgnoreCase))
-            {
-                continue;
-            }
-
             bool bComponentEdited = false;
             Component->Modify();
             if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
@@ -408,7 +1123,7 @@ bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentP
 
             if (bComponentEdited)
             {
-                UpdatedComponents += 1;
+                OutResult.ComponentCount += 1;
                 bActorTouched = true;
             }
         }
@@ -416,51 +1131,35 @@ bool FUEAIAgentSceneTools::SceneModifyComponent(const FUEAIAgentModifyComponentP
         if (bActorTouched)
         {
             Actor->Modify();
-            UpdatedActors += 1;
-        }
-    }
-
-    OutMessage = FString::Printf(
-        TEXT("scene.modifyComponent updated %d component(s) on %d actor(s). Component: %s, DeltaLocation: X=%.2f Y=%.2f Z=%.2f, DeltaRotation: Pitch=%.2f Yaw=%.2f Roll=%.2f, DeltaScale: X=%.2f Y=%.2f Z=%.2f, Scale: X=%.2f Y=%.2f Z=%.2f, VisibilityEdit: %s"),
-        UpdatedComponents,
-        UpdatedActors,
-        *Params.ComponentName,
-        Params.DeltaLocation.X,
-        Params.DeltaLocation.Y,
-        Params.DeltaLocation.Z,
-        Params.DeltaRotation.Pitch,
-        Params.DeltaRotation.Yaw,
-        Params.DeltaRotation.Roll,
-        Params.DeltaScale.X,
-        Params.DeltaScale.Y,
-        Params.DeltaScale.Z,
-        Params.Scale.X,
-        Params.Scale.Y,
-        Params.Scale.Z,
-        Params.bSetVisibility ? (Params.bVisible ? TEXT("show") : TEXT("hide")) : TEXT("none"));
-
-    return UpdatedComponents > 0;
+            OutResult.AffectedActors.Add(Actor->GetFName());
+        }
+    }
+
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneAddActorTag(const FUEAIAgentAddActorTagParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneAddActorTag(const FUEAIAgentAddActorTagParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.addActorTag"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     if (Params.Tag.IsEmpty())
     {
-        OutMessage = TEXT("Tag is required.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Tag is required."));
     }
 
     TArray<AActor*> TargetActors;
@@ -475,12 +1174,10 @@ bool FUEAIAgentSceneTools::SceneAddActorTag(const FUEAIAgentAddActorTagParams& P
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneAddActorTagTransaction", "UE AI Agent Add Actor Tag"));
-    int32 UpdatedCount = 0;
     const FName TagName(*Params.Tag);
     for (AActor* Actor : TargetActors)
     {
@@ -496,47 +1193,40 @@ bool FUEAIAgentSceneTools::SceneAddActorTag(const FUEAIAgentAddActorTagParams& P
 
         Actor->Modify();
         Actor->Tags.Add(TagName);
-        UpdatedCount += 1;
+        OutResult.AffectedActors.Add(Actor->GetFName());
     }
 
-    OutMessage = FString::Printf(TEXT("scene.addActorTag added tag '%s' to %d actor(s)."), *Params.Tag, UpdatedCount);
-    return UpdatedCount > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneSetComponentMaterial(const FUEAIAgentSetComponentMaterialParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneSetComponentMaterial(const FUEAIAgentSetComponentMaterialParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.setComponentMaterial"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     if (Params.ComponentName.IsEmpty() || Params.MaterialPath.IsEmpty())
     {
-        OutMessage = TEXT("Component name and material path are required.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Component name and material path are required."));
     }
 
-    UMaterialInterface* Material = nullptr;
-    if (Params.MaterialPath.StartsWith(TEXT("/")))
-    {
-        Material = LoadObject<UMaterialInterface>(nullptr, *Params.MaterialPath);
-    }
-    if (!Material)
-    {
-        Material = FindObject<UMaterialInterface>(nullptr, *Params.MaterialPath);
-    }
+    UMaterialInterface* Material = FUEAIAgentAssetCache::Get().ResolveMaterial(Params.MaterialPath);
     if (!Material)
     {
-        OutMessage = TEXT("Material asset could not be loaded.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::AssetNotFound, TEXT("Material asset could not be loaded."));
     }
 
     TArray<AActor*> TargetActors;
@@ -551,12 +1241,12 @@ bool FUEAIAgentSceneTools::SceneSetComponentMaterial(const FUEAIAgentSetComponen
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneSetComponentMaterialTransaction", "UE AI Agent Set Component Material"));
-    int32 UpdatedComponents = 0;
+    FUEAIAgentComponentResolver ComponentResolver(Params.ComponentName, GetBatchComponentClassCache());
+    TArray<UActorComponent*> Components;
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -564,73 +1254,56 @@ bool FUEAIAgentSceneTools::SceneSetComponentMaterial(const FUEAIAgentSetComponen
             continue;
         }
 
-        TArray<UActorComponent*> Components;
-        Actor->GetComponents(Components);
+        bool bActorTouched = false;
+        ComponentResolver.FindAll(Actor, Components);
         for (UActorComponent* Component : Components)
         {
-            if (!Component)
-            {
-                continue;
-            }
-
-            const FString ComponentName = Component->GetName();
-            if (!ComponentName.Equals(Params.ComponentName, ESearchCase::IgnoreCase))
-            {
-                continue;
-            }
-
             if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
             {
                 PrimitiveComponent->Modify();
                 PrimitiveComponent->SetMaterial(Params.MaterialSlot, Material);
-                UpdatedComponents += 1;
+                OutResult.ComponentCount += 1;
+                bActorTouched = true;
             }
         }
+
+        if (bActorTouched)
+        {
+            OutResult.AffectedActors.Add(Actor->GetFName());
+        }
     }
 
-    OutMessage = FString::Printf(
-        TEXT("scene.setComponentMaterial updated %d component(s). Component: %s, Material: %s, Slot: %d"),
-        UpdatedComponents,
-        *Params.ComponentName,
-        *Params.MaterialPath,
-        Params.MaterialSlot);
-    return UpdatedComponents > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneSetComponentStaticMesh(const FUEAIAgentSetComponentStaticMeshParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneSetComponentStaticMesh(const FUEAIAgentSetComponentStaticMeshParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.setComponentStaticMesh"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     if (Params.ComponentName.IsEmpty() || Params.MeshPath.IsEmpty())
     {
-        OutMessage = TEXT("Component name and mesh path are required.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Component name and mesh path are required."));
     }
 
-    UStaticMesh* Mesh = nullptr;
-    if (Params.MeshPath.StartsWith(TEXT("/")))
-    {
-        Mesh = LoadObject<UStaticMesh>(nullptr, *Params.MeshPath);
-    }
-    if (!Mesh)
-    {
-        Mesh = FindObject<UStaticMesh>(nullptr, *Params.MeshPath);
-    }
+    UStaticMesh* Mesh = FUEAIAgentAssetCache::Get().ResolveStaticMesh(Params.MeshPath);
     if (!Mesh)
     {
-        OutMessage = TEXT("Static mesh asset could not be loaded.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::AssetNotFound, TEXT("Static mesh asset could not be loaded."));
     }
 
     TArray<AActor*> TargetActors;
@@ -645,12 +1318,12 @@ bool FUEAIAgentSceneTools::SceneSetComponentStaticMesh(const FUEAIAgentSetCompon
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneSetComponentStaticMeshTransaction", "UE AI Agent Set Component Mesh"));
-    int32 UpdatedComponents = 0;
+    FUEAIAgentComponentResolver ComponentResolver(Params.ComponentName, GetBatchComponentClassCache());
+    TArray<UActorComponent*> Components;
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -658,51 +1331,45 @@ bool FUEAIAgentSceneTools::SceneSetComponentStaticMesh(const FUEAIAgentSetCompon
             continue;
         }
 
-        TArray<UActorComponent*> Components;
-        Actor->GetComponents(Components);
+        bool bActorTouched = false;
+        ComponentResolver.FindAll(Actor, Components);
         for (UActorComponent* Component : Components)
         {
-            if (!Component)
-            {
-                continue;
-            }
-
-            const FString ComponentName = Component->GetName();
-            if (!ComponentName.Equals(Params.ComponentName, ESearchCase::IgnoreCase))
-            {
-                continue;
-            }
-
             if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
             {
                 StaticMeshComponent->Modify();
                 StaticMeshComponent->SetStaticMesh(Mesh);
-                UpdatedComponents += 1;
+                OutResult.ComponentCount += 1;
+                bActorTouched = true;
             }
         }
+
+        if (bActorTouched)
+        {
+            OutResult.AffectedActors.Add(Actor->GetFName());
+        }
     }
 
-    OutMessage = FString::Printf(
-        TEXT("scene.setComponentStaticMesh updated %d component(s). Component: %s, Mesh: %s"),
-        UpdatedComponents,
-        *Params.ComponentName,
-        *Params.MeshPath);
-    return UpdatedComponents > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneSetActorFolder(const FUEAIAgentSetActorFolderParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneSetActorFolder(const FUEAIAgentSetActorFolderParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.setActorFolder"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     TArray<AActor*> TargetActors;
@@ -717,12 +1384,10 @@ bool FUEAIAgentSceneTools::SceneSetActorFolder(const FUEAIAgentSetActorFolderPar
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneSetActorFolderTransaction", "UE AI Agent Set Actor Folder"));
-    int32 UpdatedCount = 0;
     const FName FolderName = Params.FolderPath.IsEmpty() ? NAME_None : FName(*Params.FolderPath);
     for (AActor* Actor : TargetActors)
     {
@@ -733,32 +1398,34 @@ bool FUEAIAgentSceneTools::SceneSetActorFolder(const FUEAIAgentSetActorFolderPar
 
         Actor->Modify();
         Actor->SetFolderPath(FolderName);
-        UpdatedCount += 1;
+        OutResult.AffectedActors.Add(Actor->GetFName());
     }
 
-    OutMessage = FString::Printf(TEXT("scene.setActorFolder updated %d actor(s) to folder '%s'."), UpdatedCount, *Params.FolderPath);
-    return UpdatedCount > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneAddActorLabelPrefix(const FUEAIAgentAddActorLabelPrefixParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneAddActorLabelPrefix(const FUEAIAgentAddActorLabelPrefixParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.addActorLabelPrefix"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     if (Params.Prefix.IsEmpty())
     {
-        OutMessage = TEXT("Prefix is required.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Prefix is required."));
     }
 
     TArray<AActor*> TargetActors;
@@ -773,12 +1440,10 @@ bool FUEAIAgentSceneTools::SceneAddActorLabelPrefix(const FUEAIAgentAddActorLabe
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
     const FScopedTransaction Transaction(LOCTEXT("SceneAddActorLabelPrefixTransaction", "UE AI Agent Add Actor Label Prefix"));
-    int32 UpdatedCount = 0;
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -794,33 +1459,35 @@ bool FUEAIAgentSceneTools::SceneAddActorLabelPrefix(const FUEAIAgentAddActorLabe
 
         Actor->Modify();
         Actor->SetActorLabel(Params.Prefix + CurrentLabel, true);
-        UpdatedCount += 1;
+        OutResult.AffectedActors.Add(Actor->GetFName());
     }
 
-    OutMessage = FString::Printf(TEXT("scene.addActorLabelPrefix added prefix '%s' to %d actor(s)."), *Params.Prefix, UpdatedCount);
-    return UpdatedCount > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SceneDuplicateActors(const FUEAIAgentDuplicateActorsParams& Params, FString& OutMessage)
+bool FUEAIAgentSceneTools::SceneDuplicateActors(const FUEAIAgentDuplicateActorsParams& Params, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("scene.duplicateActors"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World)
     {
-        OutMessage = TEXT("Editor world is not available.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::WorldUnavailable, TEXT("Editor world is not available."));
     }
 
     const int32 CopyCount = FMath::Clamp(Params.Count, 1, 20);
     if (CopyCount <= 0)
     {
-        OutMessage = TEXT("Duplicate count must be at least 1.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::InvalidArguments, TEXT("Duplicate count must be at least 1."));
     }
 
     TArray<AActor*> TargetActors;
@@ -835,12 +1502,18 @@ bool FUEAIAgentSceneTools::SceneDuplicateActors(const FUEAIAgentDuplicateActorsP
 
     if (TargetActors.IsEmpty())
     {
-        OutMessage = TEXT("No target actors found.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("No target actors found."));
     }
 
+    struct FInstancedCopyGroup
+    {
+        UStaticMesh* Mesh = nullptr;
+        TArray<UMaterialInterface*> Materials;
+        TArray<FTransform> Transforms;
+    };
+    TMap<FString, FInstancedCopyGroup> InstancedGroups;
+
     const FScopedTransaction Transaction(LOCTEXT("SceneDuplicateActorsTransaction", "UE AI Agent Duplicate Actors"));
-    int32 DuplicateCount = 0;
     for (AActor* Actor : TargetActors)
     {
         if (!Actor)
@@ -848,6 +1521,31 @@ bool FUEAIAgentSceneTools::SceneDuplicateActors(const FUEAIAgentDuplicateActorsP
             continue;
         }
 
+        if (Params.bInstanced)
+        {
+            if (UStaticMeshComponent* MeshComponent = FindInstanceableMeshComponent(Actor))
+            {
+                TArray<UMaterialInterface*> Materials = MeshComponent->GetMaterials();
+                FString GroupKey = MeshComponent->GetStaticMesh()->GetPathName();
+                for (const UMaterialInterface* Material : Materials)
+                {
+                    GroupKey += TEXT("|") + GetPathNameSafe(Material);
+                }
+
+                FInstancedCopyGroup& Group = InstancedGroups.FindOrAdd(GroupKey);
+                Group.Mesh = MeshComponent->GetStaticMesh();
+                Group.Materials = MoveTemp(Materials);
+                const FTransform SourceTransform = MeshComponent->GetComponentTransform();
+                for (int32 CopyIndex = 0; CopyIndex < CopyCount; ++CopyIndex)
+                {
+                    FTransform CopyTransform = SourceTransform;
+                    CopyTransform.AddToTranslation(Params.Offset * static_cast<float>(CopyIndex + 1));
+                    Group.Transforms.Add(CopyTransform);
+                }
+                continue;
+            }
+        }
+
         const FString BaseLabel = Actor->GetActorLabel();
         FString LabelBase = BaseLabel;
         int32 SuffixIndex = LabelBase.Len() - 1;
@@ -883,59 +1581,360 @@ bool FUEAIAgentSceneTools::SceneDuplicateActors(const FUEAIAgentDuplicateActorsP
                 Duplicate->SetActorLocation(NewLocation, false, nullptr, ETeleportType::None);
             }
 
-            DuplicateCount += 1;
+            OutResult.AffectedActors.Add(Duplicate->GetFName());
+        }
+    }
+
+    for (const TPair<FString, FInstancedCopyGroup>& Pair : InstancedGroups)
+    {
+        const FInstancedCopyGroup& Group = Pair.Value;
+        const FTransform HostTransform(Group.Transforms[0].GetLocation());
+        UHierarchicalInstancedStaticMeshComponent* Instances = SpawnInstancedMeshActor(World, Group.Mesh, Group.Materials, HostTransform);
+        if (!Instances)
+        {
+            continue;
         }
+
+        const FName HostName = Instances->GetOwner()->GetFName();
+        OutResult.RecordInstances(HostName, Instances->AddInstances(Group.Transforms, true, true));
+        OutResult.AffectedActors.Add(HostName);
     }
 
-    OutMessage = FString::Printf(TEXT("scene.duplicateActors created %d duplicate(s)."), DuplicateCount);
-    return DuplicateCount > 0;
+    OutResult.ActorCount = OutResult.AffectedActors.Num();
+    return CompleteToolResult(OutResult, TargetActors.Num());
 }
 
-bool FUEAIAgentSceneTools::SessionBeginTransaction(const FString& Description, FString& OutMessage)
+bool FUEAIAgentSceneTools::SessionBeginTransaction(const FString& Description, FUEAIAgentToolResult& OutResult)
 {
-    if (!GEditor)
+    OutResult = FUEAIAgentToolResult(TEXT("session.beginTransaction"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("Editor is not available.");
         return false;
     }
+    if (!GEditor)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::EditorUnavailable, TEXT("Editor is not available."));
+    }
 
     if (GUEAIAgentSessionTransaction)
     {
-        OutMessage = TEXT("Session transaction is already active.");
-        return false;
+        return OutResult.Fail(EUEAIAgentToolErrorCode::TransactionState, TEXT("Session transaction is already active."));
     }
 
     const FString Label = Description.IsEmpty() ? TEXT("UE AI Agent Session") : Description;
     GUEAIAgentSessionTransaction = MakeUnique<FScopedTransaction>(FText::FromString(Label));
-    OutMessage = TEXT("session.beginTransaction started.");
+    OutResult.bOk = true;
     return true;
 }
 
-bool FUEAIAgentSceneTools::SessionCommitTransaction(FString& OutMessage)
+bool FUEAIAgentSceneTools::SessionCommitTransaction(FUEAIAgentToolResult& OutResult)
 {
-    if (!GUEAIAgentSessionTransaction)
+    OutResult = FUEAIAgentToolResult(TEXT("session.commitTransaction"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("No active session transaction to commit.");
         return false;
     }
+    if (!GUEAIAgentSessionTransaction)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::TransactionState, TEXT("No active session transaction to commit."));
+    }
 
     GUEAIAgentSessionTransaction.Reset();
-    OutMessage = TEXT("session.commitTransaction committed.");
+    OutResult.bOk = true;
     return true;
 }
 
-bool FUEAIAgentSceneTools::SessionRollbackTransaction(FString& OutMessage)
+bool FUEAIAgentSceneTools::SessionRollbackTransaction(FUEAIAgentToolResult& OutResult)
 {
-    if (!GUEAIAgentSessionTransaction)
+    OutResult = FUEAIAgentToolResult(TEXT("session.rollbackTransaction"));
+    if (FailIfTimeSlicedBatchRunning(OutResult))
     {
-        OutMessage = TEXT("No active session transaction to rollback.");
         return false;
     }
+    if (!GUEAIAgentSessionTransaction)
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::TransactionState, TEXT("No active session transaction to rollback."));
+    }
 
     GUEAIAgentSessionTransaction->Cancel();
     GUEAIAgentSessionTransaction.Reset();
-    OutMessage = TEXT("session.rollbackTransaction rolled back.");
+    OutResult.bOk = true;
+    return true;
+}
+
+bool FUEAIAgentSceneTools::ExecutePlannedAction(const FUEAIAgentPlannedSceneAction& PlannedAction, FUEAIAgentToolResult& OutResult)
+{
+    OutResult = FUEAIAgentToolResult(GetActionToolName(PlannedAction.Type));
+    const FToolTimingScope TimingScope(OutResult);
+    if (FailIfTimeSlicedBatchRunning(OutResult))
+    {
+        return false;
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SessionBeginTransaction)
+    {
+        return SessionBeginTransaction(PlannedAction.TransactionDescription, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SessionCommitTransaction)
+    {
+        return SessionCommitTransaction(OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SessionRollbackTransaction)
+    {
+        return SessionRollbackTransaction(OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::CreateActor)
+    {
+        FUEAIAgentCreateActorParams Params;
+        Params.ActorClass = PlannedAction.ActorClass;
+        Params.Location = PlannedAction.SpawnLocation;
+        Params.Rotation = PlannedAction.SpawnRotation;
+        Params.Count = PlannedAction.SpawnCount;
+        Params.MeshPath = PlannedAction.SpawnMeshPath;
+        Params.bInstanced = PlannedAction.bSpawnInstanced;
+        return SceneCreateActor(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::DeleteActor)
+    {
+        FUEAIAgentDeleteActorParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped delete action with no target actors."));
+        }
+        return SceneDeleteActor(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::ModifyComponent)
+    {
+        FUEAIAgentModifyComponentParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.ComponentName = PlannedAction.ComponentName;
+        Params.DeltaLocation = PlannedAction.ComponentDeltaLocation;
+        Params.DeltaRotation = PlannedAction.ComponentDeltaRotation;
+        Params.DeltaScale = PlannedAction.ComponentDeltaScale;
+        Params.Scale = PlannedAction.ComponentScale;
+        Params.bHasScale = PlannedAction.bComponentHasScale;
+        Params.bSetVisibility = PlannedAction.bComponentVisibilityEdit;
+        Params.bVisible = PlannedAction.bComponentVisible;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped component action with no target actors."));
+        }
+        return SceneModifyComponent(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::AddActorTag)
+    {
+        FUEAIAgentAddActorTagParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.Tag = PlannedAction.ActorTag;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped tag action with no target actors."));
+        }
+        return SceneAddActorTag(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SetComponentMaterial)
+    {
+        FUEAIAgentSetComponentMaterialParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.ComponentName = PlannedAction.ComponentName;
+        Params.MaterialPath = PlannedAction.MaterialPath;
+        Params.MaterialSlot = PlannedAction.MaterialSlot;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped material action with no target actors."));
+        }
+        return SceneSetComponentMaterial(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SetComponentStaticMesh)
+    {
+        FUEAIAgentSetComponentStaticMeshParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.ComponentName = PlannedAction.ComponentName;
+        Params.MeshPath = PlannedAction.MeshPath;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped mesh action with no target actors."));
+        }
+        return SceneSetComponentStaticMesh(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::SetActorFolder)
+    {
+        FUEAIAgentSetActorFolderParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.FolderPath = PlannedAction.FolderPath;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped folder action with no target actors."));
+        }
+        return SceneSetActorFolder(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::AddActorLabelPrefix)
+    {
+        FUEAIAgentAddActorLabelPrefixParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.Prefix = PlannedAction.LabelPrefix;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped label prefix action with no target actors."));
+        }
+        return SceneAddActorLabelPrefix(Params, OutResult);
+    }
+
+    if (PlannedAction.Type == EUEAIAgentPlannedActionType::DuplicateActors)
+    {
+        FUEAIAgentDuplicateActorsParams Params;
+        Params.ActorNames = PlannedAction.ActorNames;
+        Params.Count = PlannedAction.DuplicateCount;
+        Params.Offset = PlannedAction.DuplicateOffset;
+        Params.bInstanced = PlannedAction.bDuplicateInstanced;
+        Params.bUseSelectionIfActorNamesEmpty = false;
+        if (Params.ActorNames.IsEmpty())
+        {
+            return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped duplicate action with no target actors."));
+        }
+        return SceneDuplicateActors(Params, OutResult);
+    }
+
+    FUEAIAgentModifyActorParams Params = MakeModifyActorParams(PlannedAction);
+    if (Params.ActorNames.IsEmpty())
+    {
+        return OutResult.Fail(EUEAIAgentToolErrorCode::NoTargets, TEXT("Skipped modify action with no target actors."));
+    }
+    const bool bOkModifyByName = SceneModifyActor(Params, OutResult);
+    if (bOkModifyByName)
+    {
+        return true;
+    }
+
+    // Fallback for planner byName misses when the user's active selection is the intended target.
+    if (OutResult.ErrorCode == EUEAIAgentToolErrorCode::NoTargets)
+    {
+        Params.ActorNames.Empty();
+        Params.bUseSelectionIfActorNamesEmpty = true;
+        FUEAIAgentToolResult FallbackResult;
+        const bool bOkSelectionFallback = SceneModifyActor(Params, FallbackResult);
+        if (bOkSelectionFallback)
+        {
+            FallbackResult.bUsedSelectionFallback = true;
+            OutResult = MoveTemp(FallbackResult);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FUEAIAgentSceneTools::ExecuteBatch(TArrayView<const FUEAIAgentPlannedSceneAction> Actions, TArray<FUEAIAgentToolResult>& OutResults)
+{
+    OutResults.Reset(Actions.Num());
+    if (GUEAIAgentTimeSlicedBatch.IsValid())
+    {
+        for (const FUEAIAgentPlannedSceneAction& Action : Actions)
+        {
+            FUEAIAgentToolResult& Result = OutResults.Emplace_GetRef(GetActionToolName(Action.Type));
+            Result.Fail(EUEAIAgentToolErrorCode::TransactionState, TEXT("Another plan is still being applied."));
+        }
+        return Actions.IsEmpty();
+    }
+
+    FUEAIAgentTimeSlicedBatch Batch(
+        TArray<FUEAIAgentPlannedSceneAction>(Actions.GetData(), Actions.Num()),
+        FOnUEAIAgentBatchProgress(),
+        FOnUEAIAgentBatchFinished());
+    return Batch.RunToCompletion(OutResults);
+}
+
+bool FUEAIAgentSceneTools::ExecuteBatchTimeSliced(
+    TArray<FUEAIAgentPlannedSceneAction> Actions,
+    const FOnUEAIAgentBatchProgress& OnProgress,
+    const FOnUEAIAgentBatchFinished& OnFinished,
+    FString& OutMessage)
+{
+    if (GUEAIAgentTimeSlicedBatch.IsValid())
+    {
+        OutMessage = TEXT("Another plan is still being applied.");
+        return false;
+    }
+
+    // The first slice runs inline so small plans finish without waiting for a tick.
+    const TSharedRef<FUEAIAgentTimeSlicedBatch> Batch = MakeShared<FUEAIAgentTimeSlicedBatch>(MoveTemp(Actions), OnProgress, OnFinished);
+    if (Batch->Tick())
+    {
+        Batch->Complete();
+        OutMessage = TEXT("Plan applied.");
+        return true;
+    }
+
+    GUEAIAgentTimeSlicedBatch = Batch;
+    GUEAIAgentTimeSlicedTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+    {
+        const TSharedPtr<FUEAIAgentTimeSlicedBatch> ActiveBatch = GUEAIAgentTimeSlicedBatch;
+        if (!ActiveBatch.IsValid())
+        {
+            return false;
+        }
+
+        if (!ActiveBatch->Tick())
+        {
+            return true;
+        }
+
+        GUEAIAgentTimeSlicedBatch.Reset();
+        GUEAIAgentTimeSlicedTickerHandle.Reset();
+        ReleaseTimeSlicedBatchHooks();
+        ActiveBatch->Complete();
+        return false;
+    }));
+
+    // Stops the batch, closing its transaction, before the world it edits is torn down.
+    GUEAIAgentWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld* World, bool bSessionEnded, bool bCleanupResources)
+    {
+        const TSharedPtr<FUEAIAgentTimeSlicedBatch> ActiveBatch = GUEAIAgentTimeSlicedBatch;
+        if (ActiveBatch.IsValid() && ActiveBatch->EditsWorld(World))
+        {
+            FUEAIAgentSceneTools::StopTimeSlicedBatch();
+        }
+    });
+
+    OutMessage = TEXT("Applying plan.");
     return true;
 }
 
+bool FUEAIAgentSceneTools::IsTimeSlicedBatchRunning()
+{
+    return GUEAIAgentTimeSlicedBatch.IsValid();
+}
+
+void FUEAIAgentSceneTools::StopTimeSlicedBatch()
+{
+    const TSharedPtr<FUEAIAgentTimeSlicedBatch> ActiveBatch = GUEAIAgentTimeSlicedBatch;
+    if (!ActiveBatch.IsValid())
+    {
+        return;
+    }
+
+    ReleaseTimeSlicedBatchHooks();
+    GUEAIAgentTimeSlicedBatch.Reset();
+    ActiveBatch->Abort();
+    ActiveBatch->Complete();
+}
+
 #undef LOCTEXT_NAMESPACE
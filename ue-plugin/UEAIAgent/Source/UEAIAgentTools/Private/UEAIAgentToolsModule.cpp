@@ -1,16 +1,27 @@
 #include "UEAIAgentToolsModule.h"
 
 #include "Modules/ModuleManager.h"
+#include "UEAIAgentActorIndex.h"
+#include "UEAIAgentAssetCache.h"
+#include "UEAIAgentClassIndex.h"
+#include "UEAIAgentSceneTools.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUEAIAgentTools, Log, All);
 
 void FUEAIAgentToolsModule::StartupModule()
 {
+    FUEAIAgentActorIndex::Get().Startup();
+    FUEAIAgentClassIndex::Get().Startup();
+    FUEAIAgentAssetCache::Get().Startup();
     UE_LOG(LogUEAIAgentTools, Log, TEXT("UEAIAgentTools started."));
 }
 
 void FUEAIAgentToolsModule::ShutdownModule()
 {
+    FUEAIAgentSceneTools::StopTimeSlicedBatch();
+    FUEAIAgentAssetCache::Get().Shutdown();
+    FUEAIAgentClassIndex::Get().Shutdown();
+    FUEAIAgentActorIndex::Get().Shutdown();
     UE_LOG(LogUEAIAgentTools, Log, TEXT("UEAIAgentTools stopped."));
 }
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UEAIAgentToolResult.h"
+
+struct FUEAIAgentPlannedSceneAction;
 
 struct FUEAIAgentModifyActorParams
 {
@@ -19,6 +22,9 @@ struct FUEAIAgentCreateActorParams
     FVector Location = FVector::ZeroVector;
     FRotator Rotation = FRotator::ZeroRotator;
     int32 Count = 1;
+    FString MeshPath;
+    // Packs all copies into one actor with an instanced static mesh component.
+    bool bInstanced = false;
 };
 
 struct FUEAIAgentDeleteActorParams
@@ -84,23 +90,50 @@ struct FUEAIAgentDuplicateActorsParams
     TArray<FString> ActorNames;
     int32 Count = 1;
     FVector Offset = FVector::ZeroVector;
+    // StaticMeshActor targets are copied as instances, one instanced actor per mesh and material set.
+    bool bInstanced = false;
     bool bUseSelectionIfActorNamesEmpty = true;
 };
 
+struct FUEAIAgentBatchProgress
+{
+    int32 ActionIndex = 0;
+    int32 ActionCount = 0;
+    int32 ProcessedTargets = 0;
+    int32 TargetCount = 0;
+};
+
+DECLARE_DELEGATE_OneParam(FOnUEAIAgentBatchProgress, const FUEAIAgentBatchProgress&);
+DECLARE_DELEGATE_TwoParams(FOnUEAIAgentBatchFinished, bool, const TArray<FUEAIAgentToolResult>&);
+
 class UEAIAGENTTOOLS_API FUEAIAgentSceneTools
 {
 public:
-    static bool SceneModifyActor(const FUEAIAgentModifyActorParams& Params, FString& OutMessage);
-    static bool SceneCreateActor(const FUEAIAgentCreateActorParams& Params, FString& OutMessage);
-    static bool SceneDeleteActor(const FUEAIAgentDeleteActorParams& Params, FString& OutMessage);
-    static bool SceneModifyComponent(const FUEAIAgentModifyComponentParams& Params, FString& OutMessage);
-    static bool SceneAddActorTag(const FUEAIAgentAddActorTagParams& Params, FString& OutMessage);
-    static bool SceneSetComponentMaterial(const FUEAIAgentSetComponentMaterialParams& Params, FString& OutMessage);
-    static bool SceneSetComponentStaticMesh(const FUEAIAgentSetComponentStaticMeshParams& Params, FString& OutMessage);
-    static bool SceneSetActorFolder(const FUEAIAgentSetActorFolderParams& Params, FString& OutMessage);
-    static bool SceneAddActorLabelPrefix(const FUEAIAgentAddActorLabelPrefixParams& Params, FString& OutMessage);
-    static bool SceneDuplicateActors(const FUEAIAgentDuplicateActorsParams& Params, FString& OutMessage);
-    static bool SessionBeginTransaction(const FString& Description, FString& OutMessage);
-    static bool SessionCommitTransaction(FString& OutMessage);
-    static bool SessionRollbackTransaction(FString& OutMessage);
+    static bool ExecutePlannedAction(const FUEAIAgentPlannedSceneAction& PlannedAction, FUEAIAgentToolResult& OutResult);
+    // Runs actions under one undo entry. Target lists are resolved once, and actions on the same targets run back to
+    // back when that cannot change the outcome. OutResults holds one result per action, in plan order.
+    static bool ExecuteBatch(TArrayView<const FUEAIAgentPlannedSceneAction> Actions, TArray<FUEAIAgentToolResult>& OutResults);
+    // Same as ExecuteBatch, but large modify and delete target lists are worked through in frame-budgeted slices.
+    // The first slice runs before returning; OnFinished may therefore fire synchronously.
+    static bool ExecuteBatchTimeSliced(
+        TArray<FUEAIAgentPlannedSceneAction> Actions,
+        const FOnUEAIAgentBatchProgress& OnProgress,
+        const FOnUEAIAgentBatchFinished& OnFinished,
+        FString& OutMessage);
+    // While a batch runs, tool calls from outside it fail with TransactionState instead of interleaving with it.
+    static bool IsTimeSlicedBatchRunning();
+    static void StopTimeSlicedBatch();
+    static bool SceneModifyActor(const FUEAIAgentModifyActorParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneCreateActor(const FUEAIAgentCreateActorParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneDeleteActor(const FUEAIAgentDeleteActorParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneModifyComponent(const FUEAIAgentModifyComponentParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneAddActorTag(const FUEAIAgentAddActorTagParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneSetComponentMaterial(const FUEAIAgentSetComponentMaterialParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneSetComponentStaticMesh(const FUEAIAgentSetComponentStaticMeshParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneSetActorFolder(const FUEAIAgentSetActorFolderParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneAddActorLabelPrefix(const FUEAIAgentAddActorLabelPrefixParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SceneDuplicateActors(const FUEAIAgentDuplicateActorsParams& Params, FUEAIAgentToolResult& OutResult);
+    static bool SessionBeginTransaction(const FString& Description, FUEAIAgentToolResult& OutResult);
+    static bool SessionCommitTransaction(FUEAIAgentToolResult& OutResult);
+    static bool SessionRollbackTransaction(FUEAIAgentToolResult& OutResult);
 };
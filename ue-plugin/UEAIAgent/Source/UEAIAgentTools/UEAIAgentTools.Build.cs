@@ -9,7 +9,8 @@ public class UEAIAgentTools : ModuleRules
         PublicDependencyModuleNames.AddRange(
             new string[]
             {
-                "Core"
+                "Core",
+                "UEAIAgentTransport"
             }
         );
 
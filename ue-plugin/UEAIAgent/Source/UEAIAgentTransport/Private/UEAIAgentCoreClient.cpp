@@ -0,0 +1,117 @@
+#include "UEAIAgentCoreClient.h"
+
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+
+namespace
+{
+    // Agent Core paths carry chat ids; fold them so stats stay per endpoint.
+    bool IsIdSegmentParent(const FString& Segment)
+    {
+        return Segment.Equals(TEXT("chats"), ESearchCase::IgnoreCase);
+    }
+}
+
+FUEAIAgentCoreClient::FUEAIAgentCoreClient()
+    : Latency(MakeShared<FLatencyStore, ESPMode::ThreadSafe>())
+{
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FUEAIAgentCoreClient::CreateRequest(const TCHAR* Verb, const FString& Url) const
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(Url);
+    Request->SetVerb(Verb);
+    Request->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+    return Request;
+}
+
+void FUEAIAgentCoreClient::Send(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request) const
+{
+    const FHttpRequestCompleteDelegate Completion = Request->OnProcessRequestComplete();
+    const FString Route = MakeRouteKey(Request->GetVerb(), Request->GetURL());
+    const double StartSeconds = FPlatformTime::Seconds();
+    Request->OnProcessRequestComplete().BindLambda(
+        [Store = Latency, Route, StartSeconds, Completion](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+        {
+            const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+            const bool bSucceeded = bConnectedSuccessfully &&
+                HttpResponse.IsValid() &&
+                HttpResponse->GetResponseCode() >= 200 &&
+                HttpResponse->GetResponseCode() < 300;
+            Record(Store.Get(), Route, ElapsedMs, bSucceeded);
+            Completion.ExecuteIfBound(HttpRequest, HttpResponse, bConnectedSuccessfully);
+        });
+
+    Request->ProcessRequest();
+}
+
+void FUEAIAgentCoreClient::RecordLatency(const FString& Route, double ElapsedMs, bool bSucceeded) const
+{
+    Record(Latency.Get(), Route, ElapsedMs, bSucceeded);
+}
+
+TArray<FUEAIAgentRequestLatency> FUEAIAgentCoreClient::GetLatencyStats() const
+{
+    TArray<FUEAIAgentRequestLatency> Result;
+    {
+        FScopeLock Lock(&Latency->Guard);
+        Latency->ByRoute.GenerateValueArray(Result);
+    }
+    Result.Sort([](const FUEAIAgentRequestLatency& Left, const FUEAIAgentRequestLatency& Right)
+    {
+        return Left.Route < Right.Route;
+    });
+    return Result;
+}
+
+void FUEAIAgentCoreClient::ResetLatencyStats() const
+{
+    FScopeLock Lock(&Latency->Guard);
+    Latency->ByRoute.Empty();
+}
+
+FString FUEAIAgentCoreClient::MakeRouteKey(const FString& Verb, const FString& Url)
+{
+    FString Path = Url;
+    int32 QueryIndex = INDEX_NONE;
+    if (Path.FindChar(TEXT('?'), QueryIndex))
+    {
+        Path.LeftInline(QueryIndex);
+    }
+
+    const int32 SchemeIndex = Path.Find(TEXT("://"));
+    if (SchemeIndex != INDEX_NONE)
+    {
+        const int32 PathIndex = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeIndex + 3);
+        Path = PathIndex != INDEX_NONE ? Path.Mid(PathIndex) : TEXT("/");
+    }
+
+    TArray<FString> Segments;
+    Path.ParseIntoArray(Segments, TEXT("/"));
+    for (int32 Index = 1; Index < Segments.Num(); ++Index)
+    {
+        if (IsIdSegmentParent(Segments[Index - 1]))
+        {
+            Segments[Index] = TEXT(":id");
+        }
+    }
+
+    return FString::Printf(TEXT("%s /%s"), *Verb, *FString::Join(Segments, TEXT("/")));
+}
+
+void FUEAIAgentCoreClient::Record(FLatencyStore& Store, const FString& Route, double ElapsedMs, bool bSucceeded)
+{
+    FScopeLock Lock(&Store.Guard);
+    FUEAIAgentRequestLatency& Stats = Store.ByRoute.FindOrAdd(Route);
+    Stats.Route = Route;
+    Stats.Count += 1;
+    if (!bSucceeded)
+    {
+        Stats.FailureCount += 1;
+    }
+    Stats.LastMs = ElapsedMs;
+    Stats.MaxMs = FMath::Max(Stats.MaxMs, ElapsedMs);
+    Stats.MinMs = Stats.Count == 1 ? ElapsedMs : FMath::Min(Stats.MinMs, ElapsedMs);
+    Stats.AverageMs += (ElapsedMs - Stats.AverageMs) / Stats.Count;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "UEAIAgentTransportModule.h"
+
+// Single entry point for HTTP traffic to Agent Core. Every request goes out with the same
+// keep-alive settings so the HTTP backend keeps reusing its pooled connection to the Agent Core
+// host instead of opening a new one per call, and independent requests are sent without waiting
+// on each other. Each completed request is timed and folded into per-route latency stats.
+class FUEAIAgentCoreClient
+{
+public:
+    FUEAIAgentCoreClient();
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(const TCHAR* Verb, const FString& Url) const;
+
+    // Starts the request. The completion delegate bound by the caller still runs as usual,
+    // after the timing for the request is recorded.
+    void Send(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request) const;
+
+    // For requests that bypass HTTP, such as session steps sent over the event channel.
+    void RecordLatency(const FString& Route, double ElapsedMs, bool bSucceeded) const;
+
+    TArray<FUEAIAgentRequestLatency> GetLatencyStats() const;
+    void ResetLatencyStats() const;
+
+private:
+    struct FLatencyStore
+    {
+        FCriticalSection Guard;
+        TMap<FString, FUEAIAgentRequestLatency> ByRoute;
+    };
+
+    static FString MakeRouteKey(const FString& Verb, const FString& Url);
+    static void Record(FLatencyStore& Store, const FString& Route, double ElapsedMs, bool bSucceeded);
+
+    // Shared with in-flight completions so a late response never touches a destroyed client.
+    TSharedRef<FLatencyStore, ESPMode::ThreadSafe> Latency;
+};
@@ -0,0 +1,292 @@
+#include "UEAIAgentEventChannel.h"
+
+#include "UEAIAgentRequestBody.h"
+#include "UEAIAgentResponseParser.h"
+#include "Dom/JsonObject.h"
+#include "IWebSocket.h"
+#include "Modules/ModuleManager.h"
+#include "WebSocketsModule.h"
+
+namespace
+{
+    constexpr float MinReconnectDelaySeconds = 1.0f;
+    constexpr float MaxReconnectDelaySeconds = 30.0f;
+    constexpr double ReplyTimeoutSeconds = 15.0;
+    constexpr float ReplyTimeoutCheckSeconds = 1.0f;
+
+    // Must match EVENT_CHANNEL_PROTOCOL in agent-core/src/events/eventChannel.ts.
+    const TCHAR* EventChannelProtocol = TEXT("ue-ai-agent.events.v1");
+    const TCHAR* AgentCoreRequestType = TEXT("context.query");
+}
+
+FUEAIAgentEventChannel::FUEAIAgentEventChannel(FEventHandler InOnEvent, FConnectionHandler InOnConnectionChanged)
+    : OnEvent(MoveTemp(InOnEvent))
+    , OnConnectionChanged(MoveTemp(InOnConnectionChanged))
+{
+}
+
+FUEAIAgentEventChannel::~FUEAIAgentEventChannel()
+{
+    Shutdown();
+}
+
+void FUEAIAgentEventChannel::Connect(const FString& InUrl)
+{
+    if (Url == InUrl && (Socket.IsValid() || ReconnectHandle.IsValid()))
+    {
+        return;
+    }
+
+    Close();
+    Url = InUrl;
+    ReconnectDelaySeconds = MinReconnectDelaySeconds;
+    OpenSocket();
+}
+
+void FUEAIAgentEventChannel::Close()
+{
+    CloseSocket();
+    FailPendingReplies();
+}
+
+void FUEAIAgentEventChannel::Shutdown()
+{
+    CloseSocket();
+    TakePendingReplies();
+}
+
+void FUEAIAgentEventChannel::CloseSocket()
+{
+    if (ReconnectHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ReconnectHandle);
+        ReconnectHandle.Reset();
+    }
+
+    ReleaseSocket();
+    Url.Reset();
+    bConnected = false;
+    bStateReported = false;
+}
+
+bool FUEAIAgentEventChannel::IsConnected() const
+{
+    return bConnected && Socket.IsValid();
+}
+
+bool FUEAIAgentEventChannel::SendRequest(const TCHAR* Type, FUEAIAgentRequestBody& Body, FReplyHandler&& OnReply)
+{
+    if (!IsConnected())
+    {
+        return false;
+    }
+
+    const int32 RequestId = NextRequestId++;
+    Body->WriteValue(TEXT("type"), Type);
+    Body->WriteValue(TEXT("id"), RequestId);
+
+    FPendingReply& Pending = PendingReplies.Add(RequestId);
+    Pending.OnReply = MoveTemp(OnReply);
+    Pending.Payload = Body.Finish();
+    Pending.DeadlineSeconds = FPlatformTime::Seconds() + ReplyTimeoutSeconds;
+    Socket->Send(Pending.Payload.GetData(), Pending.Payload.Num(), false);
+
+    if (!ReplyTimeoutHandle.IsValid())
+    {
+        ReplyTimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FUEAIAgentEventChannel::ExpirePendingReplies),
+            ReplyTimeoutCheckSeconds);
+    }
+    return true;
+}
+
+bool FUEAIAgentEventChannel::SendReply(const TCHAR* Type, int32 RequestId, FUEAIAgentRequestBody& Body)
+{
+    if (!IsConnected())
+    {
+        return false;
+    }
+
+    Body->WriteValue(TEXT("type"), Type);
+    Body->WriteValue(TEXT("id"), RequestId);
+    const TArray<uint8> Payload = Body.Finish();
+    Socket->Send(Payload.GetData(), Payload.Num(), false);
+    return true;
+}
+
+void FUEAIAgentEventChannel::OpenSocket()
+{
+    ReconnectHandle.Reset();
+    ReleaseSocket();
+
+    FWebSocketsModule& WebSockets = FModuleManager::LoadModuleChecked<FWebSocketsModule>(TEXT("WebSockets"));
+    Socket = WebSockets.CreateWebSocket(Url, EventChannelProtocol);
+    Socket->OnConnected().AddRaw(this, &FUEAIAgentEventChannel::HandleConnected);
+    Socket->OnConnectionError().AddRaw(this, &FUEAIAgentEventChannel::HandleConnectionError);
+    Socket->OnClosed().AddRaw(this, &FUEAIAgentEventChannel::HandleClosed);
+    Socket->OnRawMessage().AddRaw(this, &FUEAIAgentEventChannel::HandleRawMessage);
+    Socket->Connect();
+}
+
+void FUEAIAgentEventChannel::ReleaseSocket()
+{
+    if (!Socket.IsValid())
+    {
+        return;
+    }
+
+    // Unbind first so closing does not call back into a channel that is tearing the socket down.
+    Socket->OnConnected().RemoveAll(this);
+    Socket->OnConnectionError().RemoveAll(this);
+    Socket->OnClosed().RemoveAll(this);
+    Socket->OnRawMessage().RemoveAll(this);
+    if (Socket->IsConnected())
+    {
+        Socket->Close();
+    }
+    Socket.Reset();
+    IncomingMessage.Reset();
+}
+
+void FUEAIAgentEventChannel::ScheduleReconnect()
+{
+    if (ReconnectHandle.IsValid() || Url.IsEmpty())
+    {
+        return;
+    }
+
+    ReconnectHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateLambda([this](float DeltaTime)
+        {
+            OpenSocket();
+            return false;
+        }),
+        ReconnectDelaySeconds);
+    ReconnectDelaySeconds = FMath::Min(ReconnectDelaySeconds * 2.0f, MaxReconnectDelaySeconds);
+}
+
+void FUEAIAgentEventChannel::HandleConnected()
+{
+    ReconnectDelaySeconds = MinReconnectDelaySeconds;
+    SetConnected(true);
+}
+
+void FUEAIAgentEventChannel::HandleConnectionError(const FString& Error)
+{
+    HandleDisconnected();
+}
+
+void FUEAIAgentEventChannel::HandleClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+{
+    HandleDisconnected();
+}
+
+void FUEAIAgentEventChannel::HandleDisconnected()
+{
+    // The socket is still inside its own callback here; it is released when the reconnect opens a new one.
+    IncomingMessage.Reset();
+    FailPendingReplies();
+    SetConnected(false);
+    ScheduleReconnect();
+}
+
+void FUEAIAgentEventChannel::SetConnected(bool bInConnected)
+{
+    // The first failed attempt is reported too, so listeners learn the initial state.
+    const bool bChanged = !bStateReported || bConnected != bInConnected;
+    bConnected = bInConnected;
+    bStateReported = true;
+    if (bChanged)
+    {
+        OnConnectionChanged(bInConnected);
+    }
+}
+
+void FUEAIAgentEventChannel::HandleRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
+{
+    IncomingMessage.Append(static_cast<const uint8*>(Data), static_cast<int32>(Size));
+    if (BytesRemaining > 0)
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Message;
+    const bool bParsed = FUEAIAgentResponseParser::ParseObject(IncomingMessage, Message);
+    IncomingMessage.Reset();
+    if (bParsed)
+    {
+        DispatchMessage(Message);
+    }
+}
+
+void FUEAIAgentEventChannel::DispatchMessage(const TSharedPtr<FJsonObject>& Message)
+{
+    FString Type;
+    Message->TryGetStringField(TEXT("type"), Type);
+
+    // Agent Core numbers its own requests, so their ids can equal one of ours.
+    int32 RequestId = 0;
+    if (Type != AgentCoreRequestType && Message->TryGetNumberField(TEXT("id"), RequestId))
+    {
+        if (FPendingReply* Found = PendingReplies.Find(RequestId))
+        {
+            FReplyHandler OnReply = MoveTemp(Found->OnReply);
+            PendingReplies.Remove(RequestId);
+            TSharedPtr<FJsonObject> Reply = Message;
+            OnReply(MoveTemp(Reply), TArray<uint8>());
+            return;
+        }
+    }
+
+    OnEvent(Type, Message);
+}
+
+TMap<int32, FUEAIAgentEventChannel::FPendingReply> FUEAIAgentEventChannel::TakePendingReplies()
+{
+    if (ReplyTimeoutHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ReplyTimeoutHandle);
+        ReplyTimeoutHandle.Reset();
+    }
+
+    TMap<int32, FPendingReply> Taken = MoveTemp(PendingReplies);
+    PendingReplies.Reset();
+    return Taken;
+}
+
+void FUEAIAgentEventChannel::FailPendingReplies()
+{
+    TMap<int32, FPendingReply> Failed = TakePendingReplies();
+    for (TPair<int32, FPendingReply>& Pending : Failed)
+    {
+        Pending.Value.OnReply(nullptr, MoveTemp(Pending.Value.Payload));
+    }
+}
+
+bool FUEAIAgentEventChannel::ExpirePendingReplies(float DeltaTime)
+{
+    // A reply can be lost while the socket stays up, e.g. when Agent Core restarts between send and reply.
+    const double NowSeconds = FPlatformTime::Seconds();
+    TArray<FPendingReply> Expired;
+    for (auto It = PendingReplies.CreateIterator(); It; ++It)
+    {
+        if (It.Value().DeadlineSeconds <= NowSeconds)
+        {
+            Expired.Add(MoveTemp(It.Value()));
+            It.RemoveCurrent();
+        }
+    }
+
+    const bool bKeepTicking = PendingReplies.Num() > 0;
+    if (!bKeepTicking)
+    {
+        ReplyTimeoutHandle.Reset();
+    }
+
+    // Handlers may send new requests, so they run after the ticker state is settled.
+    for (FPendingReply& Pending : Expired)
+    {
+        Pending.OnReply(nullptr, MoveTemp(Pending.Payload));
+    }
+    return bKeepTicking;
+}
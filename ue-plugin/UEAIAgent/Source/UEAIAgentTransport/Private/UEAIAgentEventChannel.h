@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FJsonObject;
+class FUEAIAgentRequestBody;
+class IWebSocket;
+
+// Long-lived WebSocket to Agent Core's /v1/events. Agent Core pushes health and chat changes over it,
+// and session steps travel over it as request/reply messages matched by id. Agent Core's own
+// context.query requests arrive as events and are answered with SendReply. While the channel is
+// down it reconnects with backoff and callers fall back to HTTP. All callbacks run on the game thread.
+class FUEAIAgentEventChannel
+{
+public:
+    // Reply is null when no answer arrived; Payload then holds the bytes that were sent so the caller can retry elsewhere.
+    using FReplyHandler = TUniqueFunction<void(TSharedPtr<FJsonObject>&& Reply, TArray<uint8>&& Payload)>;
+    using FEventHandler = TFunction<void(const FString& Type, const TSharedPtr<FJsonObject>& Event)>;
+    using FConnectionHandler = TFunction<void(bool bConnected)>;
+
+    FUEAIAgentEventChannel(FEventHandler InOnEvent, FConnectionHandler InOnConnectionChanged);
+    ~FUEAIAgentEventChannel();
+
+    // Connects, or reconnects when the URL changed. Safe to call repeatedly.
+    void Connect(const FString& InUrl);
+    void Close();
+    // Like Close, but pending replies are dropped without running their handlers. Used when their owner is going away.
+    void Shutdown();
+    bool IsConnected() const;
+
+    // Adds { type, id } to Body and sends it. Returns false without touching Body when the channel is
+    // down. Otherwise OnReply runs once: with the reply, or without one if the connection drops or no
+    // reply arrives within the deadline.
+    bool SendRequest(const TCHAR* Type, FUEAIAgentRequestBody& Body, FReplyHandler&& OnReply);
+    // Adds { type, id } to Body and sends it as the answer to one of Agent Core's requests.
+    bool SendReply(const TCHAR* Type, int32 RequestId, FUEAIAgentRequestBody& Body);
+
+private:
+    void OpenSocket();
+    void CloseSocket();
+    void ReleaseSocket();
+    void ScheduleReconnect();
+    void HandleConnected();
+    void HandleConnectionError(const FString& Error);
+    void HandleClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
+    void HandleDisconnected();
+    void SetConnected(bool bInConnected);
+    void HandleRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+    void DispatchMessage(const TSharedPtr<FJsonObject>& Message);
+    bool ExpirePendingReplies(float DeltaTime);
+
+    struct FPendingReply
+    {
+        FReplyHandler OnReply;
+        TArray<uint8> Payload;
+        double DeadlineSeconds = 0.0;
+    };
+
+    TMap<int32, FPendingReply> TakePendingReplies();
+    void FailPendingReplies();
+
+    FEventHandler OnEvent;
+    FConnectionHandler OnConnectionChanged;
+    FString Url;
+    TSharedPtr<IWebSocket> Socket;
+    TArray<uint8> IncomingMessage;
+    TMap<int32, FPendingReply> PendingReplies;
+    int32 NextRequestId = 1;
+    float ReconnectDelaySeconds = 1.0f;
+    FTSTicker::FDelegateHandle ReconnectHandle;
+    FTSTicker::FDelegateHandle ReplyTimeoutHandle;
+    bool bConnected = false;
+    bool bStateReported = false;
+};
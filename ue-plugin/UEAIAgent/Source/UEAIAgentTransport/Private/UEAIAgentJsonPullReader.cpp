@@ -0,0 +1,634 @@
+#include "UEAIAgentJsonPullReader.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    constexpr int32 MaxNestingDepth = 256;
+    constexpr int32 MaxNumberLength = 63;
+
+    bool IsWhitespace(uint8 Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+    }
+
+    bool IsNumberChar(uint8 Char)
+    {
+        return (Char >= '0' && Char <= '9') || Char == '-' || Char == '+' || Char == '.' || Char == 'e' || Char == 'E';
+    }
+
+    int32 HexDigitValue(uint8 Char)
+    {
+        if (Char >= '0' && Char <= '9')
+        {
+            return Char - '0';
+        }
+        if (Char >= 'a' && Char <= 'f')
+        {
+            return Char - 'a' + 10;
+        }
+        if (Char >= 'A' && Char <= 'F')
+        {
+            return Char - 'A' + 10;
+        }
+        return INDEX_NONE;
+    }
+
+    void AppendCodePointAsUtf8(uint32 CodePoint, TArray<UTF8CHAR>& OutUtf8)
+    {
+        if (CodePoint < 0x80)
+        {
+            OutUtf8.Add(static_cast<UTF8CHAR>(CodePoint));
+        }
+        else if (CodePoint < 0x800)
+        {
+            OutUtf8.Add(static_cast<UTF8CHAR>(0xC0 | (CodePoint >> 6)));
+            OutUtf8.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+        }
+        else if (CodePoint < 0x10000)
+        {
+            OutUtf8.Add(static_cast<UTF8CHAR>(0xE0 | (CodePoint >> 12)));
+            OutUtf8.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            OutUtf8.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+        }
+        else
+        {
+            OutUtf8.Add(static_cast<UTF8CHAR>(0xF0 | (CodePoint >> 18)));
+            OutUtf8.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+            OutUtf8.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            OutUtf8.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+
+    FString Utf8ToString(const UTF8CHAR* Data, int32 Length)
+    {
+        if (Length <= 0)
+        {
+            return FString();
+        }
+        const auto Converted = StringCast<TCHAR>(Data, Length);
+        return FString(Converted.Length(), Converted.Get());
+    }
+}
+
+FUEAIAgentJsonPullReader::FUEAIAgentJsonPullReader(TConstArrayView<uint8> InPayload)
+    : Payload(InPayload)
+{
+    if (Payload.Num() >= 3 && Payload[0] == 0xEF && Payload[1] == 0xBB && Payload[2] == 0xBF)
+    {
+        Position = 3;
+    }
+}
+
+EUEAIAgentJsonValueType FUEAIAgentJsonPullReader::PeekType()
+{
+    SkipWhitespace();
+    if (bError || Position >= Payload.Num())
+    {
+        return EUEAIAgentJsonValueType::None;
+    }
+
+    const uint8 Char = Payload[Position];
+    switch (Char)
+    {
+    case '{':
+        return EUEAIAgentJsonValueType::Object;
+    case '[':
+        return EUEAIAgentJsonValueType::Array;
+    case '"':
+        return EUEAIAgentJsonValueType::String;
+    case 't':
+    case 'f':
+        return EUEAIAgentJsonValueType::Boolean;
+    case 'n':
+        return EUEAIAgentJsonValueType::Null;
+    default:
+        return Char == '-' || (Char >= '0' && Char <= '9') ? EUEAIAgentJsonValueType::Number : EUEAIAgentJsonValueType::None;
+    }
+}
+
+bool FUEAIAgentJsonPullReader::EnterObject()
+{
+    if (PeekType() != EUEAIAgentJsonValueType::Object)
+    {
+        SkipValue();
+        return false;
+    }
+
+    ++Position;
+    Scopes.Add({EScope::Object});
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::NextField()
+{
+    if (bError || Scopes.IsEmpty() || Scopes.Last().Kind != EScope::Object)
+    {
+        return Fail();
+    }
+
+    SkipWhitespace();
+    if (Position >= Payload.Num())
+    {
+        return Fail();
+    }
+    if (Payload[Position] == '}')
+    {
+        ++Position;
+        Scopes.Pop(EAllowShrinking::No);
+        return false;
+    }
+    if (!Scopes.Last().bFirst && !Expect(','))
+    {
+        return false;
+    }
+    Scopes.Last().bFirst = false;
+
+    SkipWhitespace();
+    int32 Start = 0;
+    int32 End = 0;
+    bool bHasEscapes = false;
+    if (!ScanString(Start, End, bHasEscapes))
+    {
+        return false;
+    }
+
+    if (bHasEscapes)
+    {
+        FieldNameScratch.Reset();
+        if (!DecodeEscapes(Start, End, FieldNameScratch))
+        {
+            return Fail();
+        }
+        FieldName = FUtf8StringView(FieldNameScratch.GetData(), FieldNameScratch.Num());
+    }
+    else
+    {
+        FieldName = FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Payload.GetData() + Start), End - Start);
+    }
+
+    return Expect(':');
+}
+
+bool FUEAIAgentJsonPullReader::FieldIs(const ANSICHAR* Name) const
+{
+    const int32 Length = FCStringAnsi::Strlen(Name);
+    return FieldName.Len() == Length && FMemory::Memcmp(FieldName.GetData(), Name, Length) == 0;
+}
+
+bool FUEAIAgentJsonPullReader::EnterArray()
+{
+    if (PeekType() != EUEAIAgentJsonValueType::Array)
+    {
+        SkipValue();
+        return false;
+    }
+
+    ++Position;
+    Scopes.Add({EScope::Array});
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::NextElement()
+{
+    if (bError || Scopes.IsEmpty() || Scopes.Last().Kind != EScope::Array)
+    {
+        return Fail();
+    }
+
+    SkipWhitespace();
+    if (Position >= Payload.Num())
+    {
+        return Fail();
+    }
+    if (Payload[Position] == ']')
+    {
+        ++Position;
+        Scopes.Pop(EAllowShrinking::No);
+        return false;
+    }
+    if (!Scopes.Last().bFirst && !Expect(','))
+    {
+        return false;
+    }
+    Scopes.Last().bFirst = false;
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::ReadString(FString& OutValue)
+{
+    if (PeekType() != EUEAIAgentJsonValueType::String)
+    {
+        SkipValue();
+        return false;
+    }
+
+    int32 Start = 0;
+    int32 End = 0;
+    bool bHasEscapes = false;
+    if (!ScanString(Start, End, bHasEscapes))
+    {
+        return false;
+    }
+
+    if (!bHasEscapes)
+    {
+        OutValue = Utf8ToString(reinterpret_cast<const UTF8CHAR*>(Payload.GetData() + Start), End - Start);
+        return true;
+    }
+
+    StringScratch.Reset();
+    if (!DecodeEscapes(Start, End, StringScratch))
+    {
+        return Fail();
+    }
+    OutValue = Utf8ToString(StringScratch.GetData(), StringScratch.Num());
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::ReadNumber(double& OutValue)
+{
+    if (PeekType() != EUEAIAgentJsonValueType::Number)
+    {
+        SkipValue();
+        return false;
+    }
+    return ScanNumber(OutValue);
+}
+
+bool FUEAIAgentJsonPullReader::ReadBool(bool& OutValue)
+{
+    if (PeekType() != EUEAIAgentJsonValueType::Boolean)
+    {
+        SkipValue();
+        return false;
+    }
+
+    OutValue = Payload[Position] == 't';
+    return ReadLiteral(OutValue ? "true" : "false");
+}
+
+bool FUEAIAgentJsonPullReader::ReadValue(TSharedPtr<FJsonValue>& OutValue)
+{
+    return ReadValueInternal(OutValue, 0);
+}
+
+bool FUEAIAgentJsonPullReader::ReadObject(TSharedPtr<FJsonObject>& OutObject)
+{
+    if (PeekType() != EUEAIAgentJsonValueType::Object)
+    {
+        SkipValue();
+        return false;
+    }
+
+    TSharedPtr<FJsonValue> Value;
+    if (!ReadValueInternal(Value, 0))
+    {
+        return false;
+    }
+    OutObject = Value->AsObject();
+    return OutObject.IsValid();
+}
+
+bool FUEAIAgentJsonPullReader::SkipValue()
+{
+    return SkipValueInternal(0);
+}
+
+bool FUEAIAgentJsonPullReader::IsComplete()
+{
+    SkipWhitespace();
+    return !bError && Scopes.IsEmpty() && Position == Payload.Num();
+}
+
+bool FUEAIAgentJsonPullReader::HasError() const
+{
+    return bError;
+}
+
+void FUEAIAgentJsonPullReader::SkipWhitespace()
+{
+    while (Position < Payload.Num() && IsWhitespace(Payload[Position]))
+    {
+        ++Position;
+    }
+}
+
+bool FUEAIAgentJsonPullReader::Expect(uint8 Char)
+{
+    SkipWhitespace();
+    if (bError || Position >= Payload.Num() || Payload[Position] != Char)
+    {
+        return Fail();
+    }
+    ++Position;
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::Fail()
+{
+    bError = true;
+    return false;
+}
+
+bool FUEAIAgentJsonPullReader::ScanString(int32& OutStart, int32& OutEnd, bool& bOutHasEscapes)
+{
+    if (bError || Position >= Payload.Num() || Payload[Position] != '"')
+    {
+        return Fail();
+    }
+
+    bOutHasEscapes = false;
+    OutStart = ++Position;
+    while (Position < Payload.Num())
+    {
+        const uint8 Char = Payload[Position];
+        if (Char == '"')
+        {
+            OutEnd = Position++;
+            return true;
+        }
+        if (Char == '\\')
+        {
+            bOutHasEscapes = true;
+            Position += 2;
+            continue;
+        }
+        if (Char < 0x20)
+        {
+            return Fail();
+        }
+        ++Position;
+    }
+    return Fail();
+}
+
+bool FUEAIAgentJsonPullReader::DecodeEscapes(int32 Start, int32 End, TArray<UTF8CHAR>& OutUtf8) const
+{
+    OutUtf8.Reserve(End - Start);
+    auto ReadHex4 = [this, End](int32 At, uint32& OutCode)
+    {
+        if (At + 4 > End)
+        {
+            return false;
+        }
+        OutCode = 0;
+        for (int32 Index = At; Index < At + 4; ++Index)
+        {
+            const int32 Digit = HexDigitValue(Payload[Index]);
+            if (Digit == INDEX_NONE)
+            {
+                return false;
+            }
+            OutCode = (OutCode << 4) | static_cast<uint32>(Digit);
+        }
+        return true;
+    };
+
+    int32 Index = Start;
+    while (Index < End)
+    {
+        const uint8 Char = Payload[Index];
+        if (Char != '\\')
+        {
+            OutUtf8.Add(static_cast<UTF8CHAR>(Char));
+            ++Index;
+            continue;
+        }
+
+        if (Index + 1 >= End)
+        {
+            return false;
+        }
+        const uint8 Escape = Payload[Index + 1];
+        Index += 2;
+        switch (Escape)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            OutUtf8.Add(static_cast<UTF8CHAR>(Escape));
+            break;
+        case 'b':
+            OutUtf8.Add(static_cast<UTF8CHAR>('\b'));
+            break;
+        case 'f':
+            OutUtf8.Add(static_cast<UTF8CHAR>('\f'));
+            break;
+        case 'n':
+            OutUtf8.Add(static_cast<UTF8CHAR>('\n'));
+            break;
+        case 'r':
+            OutUtf8.Add(static_cast<UTF8CHAR>('\r'));
+            break;
+        case 't':
+            OutUtf8.Add(static_cast<UTF8CHAR>('\t'));
+            break;
+        case 'u':
+        {
+            uint32 CodePoint = 0;
+            if (!ReadHex4(Index, CodePoint))
+            {
+                return false;
+            }
+            Index += 4;
+
+            // Surrogate pairs arrive as two consecutive escapes; a lone surrogate becomes U+FFFD.
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+            {
+                uint32 LowSurrogate = 0;
+                if (Index + 1 < End && Payload[Index] == '\\' && Payload[Index + 1] == 'u' &&
+                    ReadHex4(Index + 2, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+                {
+                    CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+                    Index += 6;
+                }
+                else
+                {
+                    CodePoint = 0xFFFD;
+                }
+            }
+            else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+            {
+                CodePoint = 0xFFFD;
+            }
+            AppendCodePointAsUtf8(CodePoint, OutUtf8);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::ReadLiteral(const ANSICHAR* Literal)
+{
+    const int32 Length = FCStringAnsi::Strlen(Literal);
+    if (bError || Position + Length > Payload.Num() || FMemory::Memcmp(Payload.GetData() + Position, Literal, Length) != 0)
+    {
+        return Fail();
+    }
+    Position += Length;
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::ScanNumber(double& OutValue)
+{
+    ANSICHAR Buffer[MaxNumberLength + 1];
+    int32 Length = 0;
+    while (Position < Payload.Num() && IsNumberChar(Payload[Position]))
+    {
+        if (Length == MaxNumberLength)
+        {
+            return Fail();
+        }
+        Buffer[Length++] = static_cast<ANSICHAR>(Payload[Position++]);
+    }
+    if (Length == 0)
+    {
+        return Fail();
+    }
+
+    Buffer[Length] = '\0';
+    OutValue = FCStringAnsi::Atod(Buffer);
+    return true;
+}
+
+bool FUEAIAgentJsonPullReader::ReadValueInternal(TSharedPtr<FJsonValue>& OutValue, int32 Depth)
+{
+    if (Depth > MaxNestingDepth)
+    {
+        return Fail();
+    }
+
+    switch (PeekType())
+    {
+    case EUEAIAgentJsonValueType::Object:
+    {
+        EnterObject();
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        while (NextField())
+        {
+            // The name view may point into scratch space that a nested value overwrites.
+            FString Name = Utf8ToString(FieldName.GetData(), FieldName.Len());
+            TSharedPtr<FJsonValue> FieldValue;
+            if (!ReadValueInternal(FieldValue, Depth + 1))
+            {
+                return false;
+            }
+            Object->SetField(MoveTemp(Name), FieldValue);
+        }
+        OutValue = MakeShared<FJsonValueObject>(Object);
+        return !bError;
+    }
+    case EUEAIAgentJsonValueType::Array:
+    {
+        EnterArray();
+        TArray<TSharedPtr<FJsonValue>> Items;
+        while (NextElement())
+        {
+            TSharedPtr<FJsonValue> Item;
+            if (!ReadValueInternal(Item, Depth + 1))
+            {
+                return false;
+            }
+            Items.Add(MoveTemp(Item));
+        }
+        OutValue = MakeShared<FJsonValueArray>(Items);
+        return !bError;
+    }
+    case EUEAIAgentJsonValueType::String:
+    {
+        FString Value;
+        if (!ReadString(Value))
+        {
+            return false;
+        }
+        OutValue = MakeShared<FJsonValueString>(MoveTemp(Value));
+        return true;
+    }
+    case EUEAIAgentJsonValueType::Number:
+    {
+        double Value = 0.0;
+        if (!ScanNumber(Value))
+        {
+            return false;
+        }
+        OutValue = MakeShared<FJsonValueNumber>(Value);
+        return true;
+    }
+    case EUEAIAgentJsonValueType::Boolean:
+    {
+        bool bValue = false;
+        if (!ReadBool(bValue))
+        {
+            return false;
+        }
+        OutValue = MakeShared<FJsonValueBoolean>(bValue);
+        return true;
+    }
+    case EUEAIAgentJsonValueType::Null:
+        if (!ReadLiteral("null"))
+        {
+            return false;
+        }
+        OutValue = MakeShared<FJsonValueNull>();
+        return true;
+    default:
+        return Fail();
+    }
+}
+
+bool FUEAIAgentJsonPullReader::SkipValueInternal(int32 Depth)
+{
+    if (Depth > MaxNestingDepth)
+    {
+        return Fail();
+    }
+
+    switch (PeekType())
+    {
+    case EUEAIAgentJsonValueType::Object:
+        ++Position;
+        Scopes.Add({EScope::Object});
+        while (NextField())
+        {
+            if (!SkipValueInternal(Depth + 1))
+            {
+                return false;
+            }
+        }
+        return !bError;
+    case EUEAIAgentJsonValueType::Array:
+        ++Position;
+        Scopes.Add({EScope::Array});
+        while (NextElement())
+        {
+            if (!SkipValueInternal(Depth + 1))
+            {
+                return false;
+            }
+        }
+        return !bError;
+    case EUEAIAgentJsonValueType::String:
+    {
+        int32 Start = 0;
+        int32 End = 0;
+        bool bHasEscapes = false;
+        return ScanString(Start, End, bHasEscapes);
+    }
+    case EUEAIAgentJsonValueType::Number:
+    {
+        double Value = 0.0;
+        return ScanNumber(Value);
+    }
+    case EUEAIAgentJsonValueType::Boolean:
+        return ReadLiteral(Payload[Position] == 't' ? "true" : "false");
+    case EUEAIAgentJsonValueType::Null:
+        return ReadLiteral("null");
+    default:
+        return Fail();
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class FJsonValue;
+
+enum class EUEAIAgentJsonValueType : uint8
+{
+    None,
+    Object,
+    Array,
+    String,
+    Number,
+    Boolean,
+    Null
+};
+
+// Forward-only reader over a UTF-8 JSON payload, used to parse HTTP responses without first
+// widening them into an FString or building a full FJsonObject DOM. Field names are compared in
+// place; only string values the caller asks for are decoded. The payload must outlive the reader.
+//
+//     if (Reader.EnterObject())
+//     {
+//         while (Reader.NextField())
+//         {
+//             if (Reader.FieldIs("title")) { Reader.ReadString(Title); }
+//             else { Reader.SkipValue(); }
+//         }
+//     }
+//
+// Any malformed input puts the reader in an error state; every call after that returns false.
+class FUEAIAgentJsonPullReader
+{
+public:
+    explicit FUEAIAgentJsonPullReader(TConstArrayView<uint8> InPayload);
+
+    // Type of the next value without consuming it.
+    EUEAIAgentJsonValueType PeekType();
+
+    bool EnterObject();
+    // Advances to the next field of the current object and positions the reader on its value.
+    // Returns false after the closing brace.
+    bool NextField();
+    bool FieldIs(const ANSICHAR* Name) const;
+
+    bool EnterArray();
+    // Returns false after the closing bracket; otherwise the reader is positioned on the next element.
+    bool NextElement();
+
+    // Each Read* consumes the next value. On a type mismatch the value is skipped and false is returned,
+    // so optional fields of an unexpected type do not abort the whole parse.
+    bool ReadString(FString& OutValue);
+    bool ReadNumber(double& OutValue);
+    bool ReadBool(bool& OutValue);
+    // Materializes the next value as a DOM subtree, for small payloads consumed through FJsonObject helpers.
+    bool ReadValue(TSharedPtr<FJsonValue>& OutValue);
+    bool ReadObject(TSharedPtr<FJsonObject>& OutObject);
+    bool SkipValue();
+
+    // True when the whole payload was consumed without errors.
+    bool IsComplete();
+    bool HasError() const;
+
+private:
+    enum class EScope : uint8
+    {
+        Object,
+        Array
+    };
+
+    struct FScope
+    {
+        EScope Kind;
+        bool bFirst = true;
+    };
+
+    void SkipWhitespace();
+    bool Expect(uint8 Char);
+    bool Fail();
+    bool ScanString(int32& OutStart, int32& OutEnd, bool& bOutHasEscapes);
+    bool DecodeEscapes(int32 Start, int32 End, TArray<UTF8CHAR>& OutUtf8) const;
+    bool ReadLiteral(const ANSICHAR* Literal);
+    bool ScanNumber(double& OutValue);
+    bool ReadValueInternal(TSharedPtr<FJsonValue>& OutValue, int32 Depth);
+    bool SkipValueInternal(int32 Depth);
+
+    TConstArrayView<uint8> Payload;
+    int32 Position = 0;
+    TArray<FScope, TInlineAllocator<16>> Scopes;
+    FUtf8StringView FieldName;
+    TArray<UTF8CHAR> FieldNameScratch;
+    TArray<UTF8CHAR> StringScratch;
+    bool bError = false;
+};
@@ -0,0 +1,73 @@
+#include "UEAIAgentRequestBody.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+
+FUEAIAgentRequestBody::FUEAIAgentRequestBody(int32 ReserveBytes)
+    : Archive(Bytes)
+    , Writer(TJsonWriterFactory<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>::Create(&Archive))
+{
+    Bytes.Reserve(ReserveBytes);
+    Writer->WriteObjectStart();
+}
+
+void FUEAIAgentRequestBody::WriteStringIfNotEmpty(const TCHAR* Identifier, const FString& Value)
+{
+    if (!Value.IsEmpty())
+    {
+        Writer->WriteValue(Identifier, Value);
+    }
+}
+
+void FUEAIAgentRequestBody::WriteStringArray(const TCHAR* Identifier, const TArray<FString>& Values)
+{
+    Writer->WriteArrayStart(Identifier);
+    for (const FString& Value : Values)
+    {
+        Writer->WriteValue(Value);
+    }
+    Writer->WriteArrayEnd();
+}
+
+void FUEAIAgentRequestBody::WriteVector(const TCHAR* Identifier, const FVector& Value)
+{
+    Writer->WriteObjectStart(Identifier);
+    Writer->WriteValue(TEXT("x"), Value.X);
+    Writer->WriteValue(TEXT("y"), Value.Y);
+    Writer->WriteValue(TEXT("z"), Value.Z);
+    Writer->WriteObjectEnd();
+}
+
+void FUEAIAgentRequestBody::WriteRotator(const TCHAR* Identifier, const FRotator& Value)
+{
+    Writer->WriteObjectStart(Identifier);
+    Writer->WriteValue(TEXT("pitch"), Value.Pitch);
+    Writer->WriteValue(TEXT("yaw"), Value.Yaw);
+    Writer->WriteValue(TEXT("roll"), Value.Roll);
+    Writer->WriteObjectEnd();
+}
+
+void FUEAIAgentRequestBody::WriteJsonObject(const TCHAR* Identifier, const TSharedRef<FJsonObject>& Object)
+{
+    const TSharedPtr<FJsonValue> Value = MakeShared<FJsonValueObject>(Object);
+    FJsonSerializer::Serialize(Value, Identifier, Writer, false);
+}
+
+void FUEAIAgentRequestBody::WriteJsonArray(const TCHAR* Identifier, const TArray<TSharedPtr<FJsonValue>>& Values)
+{
+    const TSharedPtr<FJsonValue> Value = MakeShared<FJsonValueArray>(Values);
+    FJsonSerializer::Serialize(Value, Identifier, Writer, false);
+}
+
+void FUEAIAgentRequestBody::MoveToRequest(IHttpRequest& Request)
+{
+    Request.SetContent(Finish());
+}
+
+TArray<uint8> FUEAIAgentRequestBody::Finish()
+{
+    Writer->WriteObjectEnd();
+    Writer->Close();
+    return MoveTemp(Bytes);
+}
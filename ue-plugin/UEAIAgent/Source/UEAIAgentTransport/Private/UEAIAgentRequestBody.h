@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryWriter.h"
+
+class FJsonObject;
+class FJsonValue;
+
+// Streams a JSON request body straight into a UTF-8 byte buffer. Callers write fields in order
+// instead of building an FJsonObject tree, and the bytes are handed to the request without a
+// TCHAR string or a second UTF-8 conversion in between. The root object is opened on construction.
+class FUEAIAgentRequestBody
+{
+public:
+    using FWriter = TJsonWriter<UTF8CHAR, TCondensedJsonPrintPolicy<UTF8CHAR>>;
+
+    explicit FUEAIAgentRequestBody(int32 ReserveBytes = 256);
+
+    FWriter* operator->() const
+    {
+        return &Writer.Get();
+    }
+
+    FWriter& GetWriter() const
+    {
+        return Writer.Get();
+    }
+
+    // For serializers that take the writer by shared reference.
+    const TSharedRef<FWriter>& GetSharedWriter() const
+    {
+        return Writer;
+    }
+
+    void WriteStringIfNotEmpty(const TCHAR* Identifier, const FString& Value);
+    void WriteStringArray(const TCHAR* Identifier, const TArray<FString>& Values);
+    void WriteVector(const TCHAR* Identifier, const FVector& Value);
+    void WriteRotator(const TCHAR* Identifier, const FRotator& Value);
+
+    // For payloads that already exist as JSON objects, such as scene deltas and tool results.
+    void WriteJsonObject(const TCHAR* Identifier, const TSharedRef<FJsonObject>& Object);
+    void WriteJsonArray(const TCHAR* Identifier, const TArray<TSharedPtr<FJsonValue>>& Values);
+
+    // Closes the root object and moves the bytes into the request. The body cannot be written afterwards.
+    void MoveToRequest(IHttpRequest& Request);
+    // Same as MoveToRequest, for bodies sent over the event channel instead of HTTP.
+    TArray<uint8> Finish();
+
+private:
+    TArray<uint8> Bytes;
+    FMemoryWriter Archive;
+    TSharedRef<FWriter> Writer;
+};
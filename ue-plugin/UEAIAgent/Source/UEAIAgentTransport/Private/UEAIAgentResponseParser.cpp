@@ -0,0 +1,426 @@
+#include "UEAIAgentResponseParser.h"
+
+#include "UEAIAgentJsonPullReader.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+    // Consumes the value when the current field is part of the { ok, error } envelope.
+    bool ReadStatusField(FUEAIAgentJsonPullReader& Reader, FUEAIAgentResponseStatus& OutStatus)
+    {
+        if (Reader.FieldIs("ok"))
+        {
+            Reader.ReadBool(OutStatus.bOk);
+            return true;
+        }
+        if (Reader.FieldIs("error"))
+        {
+            Reader.ReadString(OutStatus.Error);
+            return true;
+        }
+        return false;
+    }
+
+    uint64 ToAckVersion(double Version)
+    {
+        return Version > 0.0 ? static_cast<uint64>(Version) : 0;
+    }
+
+    bool ReadSceneAckObject(FUEAIAgentJsonPullReader& Reader, FUEAIAgentSceneAck& OutAck)
+    {
+        if (!Reader.EnterObject())
+        {
+            return false;
+        }
+
+        bool bHasId = false;
+        bool bHasVersion = false;
+        while (Reader.NextField())
+        {
+            if (Reader.FieldIs("snapshotId"))
+            {
+                FString SnapshotIdText;
+                bHasId = Reader.ReadString(SnapshotIdText) && FGuid::Parse(SnapshotIdText, OutAck.SnapshotId);
+            }
+            else if (Reader.FieldIs("version"))
+            {
+                double Version = 0.0;
+                bHasVersion = Reader.ReadNumber(Version);
+                OutAck.Version = ToAckVersion(Version);
+            }
+            else
+            {
+                Reader.SkipValue();
+            }
+        }
+        return bHasId && bHasVersion && !Reader.HasError();
+    }
+
+    bool ReadChatSummary(FUEAIAgentJsonPullReader& Reader, FUEAIAgentChatSummary& OutChat)
+    {
+        if (!Reader.EnterObject())
+        {
+            return false;
+        }
+
+        while (Reader.NextField())
+        {
+            if (Reader.FieldIs("id"))
+            {
+                Reader.ReadString(OutChat.Id);
+            }
+            else if (Reader.FieldIs("title"))
+            {
+                Reader.ReadString(OutChat.Title);
+            }
+            else if (Reader.FieldIs("archived"))
+            {
+                Reader.ReadBool(OutChat.bArchived);
+            }
+            else if (Reader.FieldIs("lastActivityAt"))
+            {
+                Reader.ReadString(OutChat.LastActivityAt);
+            }
+            else
+            {
+                Reader.SkipValue();
+            }
+        }
+        return !Reader.HasError() && !OutChat.Id.IsEmpty();
+    }
+
+    bool ReadChatHistoryEntry(FUEAIAgentJsonPullReader& Reader, FUEAIAgentChatHistoryEntry& OutEntry)
+    {
+        if (!Reader.EnterObject())
+        {
+            return false;
+        }
+
+        bool bHasPayload = false;
+        bool bHasPayloadChatType = false;
+        FString PayloadProvider;
+        FString PayloadModel;
+        FString PayloadChatType;
+        FString PayloadMode;
+        while (Reader.NextField())
+        {
+            if (Reader.FieldIs("id"))
+            {
+                Reader.ReadString(OutEntry.Id);
+            }
+            else if (Reader.FieldIs("kind"))
+            {
+                Reader.ReadString(OutEntry.Kind);
+            }
+            else if (Reader.FieldIs("route"))
+            {
+                Reader.ReadString(OutEntry.Route);
+            }
+            else if (Reader.FieldIs("summary"))
+            {
+                Reader.ReadString(OutEntry.Summary);
+            }
+            else if (Reader.FieldIs("provider"))
+            {
+                Reader.ReadString(OutEntry.Provider);
+            }
+            else if (Reader.FieldIs("model"))
+            {
+                Reader.ReadString(OutEntry.Model);
+            }
+            else if (Reader.FieldIs("chatType"))
+            {
+                Reader.ReadString(OutEntry.ChatType);
+            }
+            else if (Reader.FieldIs("createdAt"))
+            {
+                Reader.ReadString(OutEntry.CreatedAt);
+            }
+            else if (Reader.FieldIs("payload"))
+            {
+                if (!Reader.EnterObject())
+                {
+                    continue;
+                }
+                bHasPayload = true;
+                while (Reader.NextField())
+                {
+                    if (Reader.FieldIs("displayRole"))
+                    {
+                        Reader.ReadString(OutEntry.DisplayRole);
+                    }
+                    else if (Reader.FieldIs("displayText"))
+                    {
+                        Reader.ReadString(OutEntry.DisplayText);
+                    }
+                    else if (Reader.FieldIs("provider"))
+                    {
+                        Reader.ReadString(PayloadProvider);
+                    }
+                    else if (Reader.FieldIs("model"))
+                    {
+                        Reader.ReadString(PayloadModel);
+                    }
+                    else if (Reader.FieldIs("chatType"))
+                    {
+                        bHasPayloadChatType = Reader.ReadString(PayloadChatType);
+                    }
+                    else if (Reader.FieldIs("mode"))
+                    {
+                        Reader.ReadString(PayloadMode);
+                    }
+                    else
+                    {
+                        Reader.SkipValue();
+                    }
+                }
+            }
+            else
+            {
+                Reader.SkipValue();
+            }
+        }
+        if (Reader.HasError())
+        {
+            return false;
+        }
+
+        // Fields on the entry win; the payload fills what the entry left out.
+        if (bHasPayload)
+        {
+            if (OutEntry.Provider.IsEmpty())
+            {
+                OutEntry.Provider = PayloadProvider;
+            }
+            if (OutEntry.Model.IsEmpty())
+            {
+                OutEntry.Model = PayloadModel;
+            }
+            if (OutEntry.ChatType.IsEmpty())
+            {
+                OutEntry.ChatType = bHasPayloadChatType ? PayloadChatType : PayloadMode;
+            }
+        }
+        OutEntry.ChatType = FUEAIAgentResponseParser::NormalizeChatType(OutEntry.ChatType);
+        if (OutEntry.DisplayRole.IsEmpty())
+        {
+            OutEntry.DisplayRole = OutEntry.Kind.Equals(TEXT("asked"), ESearchCase::IgnoreCase)
+                ? TEXT("user")
+                : TEXT("assistant");
+        }
+        if (OutEntry.DisplayText.IsEmpty())
+        {
+            OutEntry.DisplayText = OutEntry.Summary;
+        }
+        return true;
+    }
+
+    void ReadPlanObject(FUEAIAgentJsonPullReader& Reader, FUEAIAgentPlanResponse& OutResponse)
+    {
+        if (!Reader.EnterObject())
+        {
+            return;
+        }
+
+        OutResponse.bHasPlan = true;
+        while (Reader.NextField())
+        {
+            if (Reader.FieldIs("summary"))
+            {
+                Reader.ReadString(OutResponse.Summary);
+            }
+            else if (Reader.FieldIs("steps"))
+            {
+                if (!Reader.EnterArray())
+                {
+                    continue;
+                }
+                while (Reader.NextElement())
+                {
+                    FString StepText;
+                    if (Reader.ReadString(StepText))
+                    {
+                        StepText.TrimStartAndEndInline();
+                        if (!StepText.IsEmpty())
+                        {
+                            OutResponse.Steps.Add(MoveTemp(StepText));
+                        }
+                    }
+                }
+            }
+            else if (Reader.FieldIs("actions"))
+            {
+                if (!Reader.EnterArray())
+                {
+                    continue;
+                }
+                while (Reader.NextElement())
+                {
+                    TSharedPtr<FJsonObject> ActionObj;
+                    if (Reader.ReadObject(ActionObj))
+                    {
+                        OutResponse.Actions.Add(MoveTemp(ActionObj));
+                    }
+                }
+            }
+            else
+            {
+                Reader.SkipValue();
+            }
+        }
+    }
+}
+
+bool FUEAIAgentResponseParser::ParseObject(TConstArrayView<uint8> Payload, TSharedPtr<FJsonObject>& OutObject)
+{
+    FUEAIAgentJsonPullReader Reader(Payload);
+    return Reader.ReadObject(OutObject) && Reader.IsComplete();
+}
+
+bool FUEAIAgentResponseParser::ParseChatList(TConstArrayView<uint8> Payload, FUEAIAgentChatListResponse& OutResponse)
+{
+    FUEAIAgentJsonPullReader Reader(Payload);
+    if (!Reader.EnterObject())
+    {
+        return false;
+    }
+
+    while (Reader.NextField())
+    {
+        if (ReadStatusField(Reader, OutResponse))
+        {
+            continue;
+        }
+        if (!Reader.FieldIs("chats"))
+        {
+            Reader.SkipValue();
+            continue;
+        }
+        if (!Reader.EnterArray())
+        {
+            continue;
+        }
+        while (Reader.NextElement())
+        {
+            FUEAIAgentChatSummary Chat;
+            if (ReadChatSummary(Reader, Chat))
+            {
+                OutResponse.Chats.Add(MoveTemp(Chat));
+            }
+        }
+    }
+    return Reader.IsComplete();
+}
+
+bool FUEAIAgentResponseParser::ParseChatHistory(TConstArrayView<uint8> Payload, FUEAIAgentChatHistoryResponse& OutResponse)
+{
+    FUEAIAgentJsonPullReader Reader(Payload);
+    if (!Reader.EnterObject())
+    {
+        return false;
+    }
+
+    while (Reader.NextField())
+    {
+        if (ReadStatusField(Reader, OutResponse))
+        {
+            continue;
+        }
+        if (Reader.FieldIs("hasMore"))
+        {
+            Reader.ReadBool(OutResponse.bHasMore);
+            continue;
+        }
+        if (Reader.FieldIs("reset"))
+        {
+            Reader.ReadBool(OutResponse.bReset);
+            continue;
+        }
+        if (!Reader.FieldIs("details"))
+        {
+            Reader.SkipValue();
+            continue;
+        }
+        if (!Reader.EnterArray())
+        {
+            continue;
+        }
+        while (Reader.NextElement())
+        {
+            FUEAIAgentChatHistoryEntry Entry;
+            if (ReadChatHistoryEntry(Reader, Entry))
+            {
+                OutResponse.Entries.Add(MoveTemp(Entry));
+            }
+        }
+    }
+    return Reader.IsComplete();
+}
+
+bool FUEAIAgentResponseParser::ParsePlan(TConstArrayView<uint8> Payload, FUEAIAgentPlanResponse& OutResponse)
+{
+    FUEAIAgentJsonPullReader Reader(Payload);
+    if (!Reader.EnterObject())
+    {
+        return false;
+    }
+
+    while (Reader.NextField())
+    {
+        if (ReadStatusField(Reader, OutResponse))
+        {
+            continue;
+        }
+        if (Reader.FieldIs("plan"))
+        {
+            ReadPlanObject(Reader, OutResponse);
+        }
+        else if (Reader.FieldIs("assistantText"))
+        {
+            Reader.ReadString(OutResponse.AssistantText);
+        }
+        else if (Reader.FieldIs("sceneAck"))
+        {
+            OutResponse.bHasSceneAck = ReadSceneAckObject(Reader, OutResponse.SceneAck);
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+    return Reader.IsComplete();
+}
+
+bool FUEAIAgentResponseParser::ReadSceneAck(const TSharedPtr<FJsonObject>& ResponseJson, FUEAIAgentSceneAck& OutAck)
+{
+    const TSharedPtr<FJsonObject>* AckObj = nullptr;
+    if (!ResponseJson.IsValid() || !ResponseJson->TryGetObjectField(TEXT("sceneAck"), AckObj) || !AckObj || !AckObj->IsValid())
+    {
+        return false;
+    }
+
+    FString SnapshotIdText;
+    double Version = 0.0;
+    if (!(*AckObj)->TryGetStringField(TEXT("snapshotId"), SnapshotIdText) ||
+        !FGuid::Parse(SnapshotIdText, OutAck.SnapshotId) ||
+        !(*AckObj)->TryGetNumberField(TEXT("version"), Version))
+    {
+        return false;
+    }
+
+    OutAck.Version = ToAckVersion(Version);
+    return true;
+}
+
+FString FUEAIAgentResponseParser::NormalizeChatType(const FString& Value)
+{
+    if (Value.Equals(TEXT("chat"), ESearchCase::IgnoreCase))
+    {
+        return TEXT("chat");
+    }
+    if (Value.Equals(TEXT("agent"), ESearchCase::IgnoreCase))
+    {
+        return TEXT("agent");
+    }
+    return TEXT("");
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UEAIAgentTransportModule.h"
+
+class FJsonObject;
+
+struct FUEAIAgentSceneAck
+{
+    FGuid SnapshotId;
+    uint64 Version = 0;
+};
+
+// Shared envelope of Agent Core responses: { ok, error, ... }.
+struct FUEAIAgentResponseStatus
+{
+    bool bOk = false;
+    FString Error;
+};
+
+struct FUEAIAgentChatListResponse : FUEAIAgentResponseStatus
+{
+    TArray<FUEAIAgentChatSummary> Chats;
+};
+
+struct FUEAIAgentChatHistoryResponse : FUEAIAgentResponseStatus
+{
+    TArray<FUEAIAgentChatHistoryEntry> Entries;
+    bool bHasMore = false;
+    bool bReset = false;
+};
+
+struct FUEAIAgentPlanResponse : FUEAIAgentResponseStatus
+{
+    bool bHasPlan = false;
+    FString Summary;
+    TArray<FString> Steps;
+    // Actions stay small JSON objects so the command mapping in the transport reads them unchanged.
+    TArray<TSharedPtr<FJsonObject>> Actions;
+    FString AssistantText;
+    bool bHasSceneAck = false;
+    FUEAIAgentSceneAck SceneAck;
+};
+
+// Parses Agent Core responses straight from the UTF-8 body with FUEAIAgentJsonPullReader.
+// Each Parse* returns false only when the payload is not valid JSON of the expected shape;
+// an { ok: false } response parses successfully with bOk unset.
+class FUEAIAgentResponseParser
+{
+public:
+    static bool ParseObject(TConstArrayView<uint8> Payload, TSharedPtr<FJsonObject>& OutObject);
+    static bool ParseChatList(TConstArrayView<uint8> Payload, FUEAIAgentChatListResponse& OutResponse);
+    static bool ParseChatHistory(TConstArrayView<uint8> Payload, FUEAIAgentChatHistoryResponse& OutResponse);
+    static bool ParsePlan(TConstArrayView<uint8> Payload, FUEAIAgentPlanResponse& OutResponse);
+
+    // For responses already held as a JSON object.
+    static bool ReadSceneAck(const TSharedPtr<FJsonObject>& ResponseJson, FUEAIAgentSceneAck& OutAck);
+
+    static FString NormalizeChatType(const FString& Value);
+};
@@ -6,6 +6,7 @@ UUEAIAgentSettings::UUEAIAgentSettings()
     , DefaultProvider(EUEAIAgentProvider::Local)
     , bShowChatsOnOpen(true)
     , ChatListMaxRows(10)
+    , MaxCreateActorCount(10000)
 {
 }
 
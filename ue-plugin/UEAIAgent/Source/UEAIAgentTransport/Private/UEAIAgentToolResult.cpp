@@ -0,0 +1,161 @@
+#include "UEAIAgentToolResult.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    constexpr int32 MaxReportedActorIds = 200;
+}
+
+const TCHAR* LexToString(EUEAIAgentToolErrorCode ErrorCode)
+{
+    switch (ErrorCode)
+    {
+    case EUEAIAgentToolErrorCode::EditorUnavailable:
+        return TEXT("editor_unavailable");
+    case EUEAIAgentToolErrorCode::WorldUnavailable:
+        return TEXT("world_unavailable");
+    case EUEAIAgentToolErrorCode::InvalidArguments:
+        return TEXT("invalid_arguments");
+    case EUEAIAgentToolErrorCode::NoTargets:
+        return TEXT("no_targets");
+    case EUEAIAgentToolErrorCode::AssetNotFound:
+        return TEXT("asset_not_found");
+    case EUEAIAgentToolErrorCode::SpawnFailed:
+        return TEXT("spawn_failed");
+    case EUEAIAgentToolErrorCode::TransactionState:
+        return TEXT("transaction_state");
+    case EUEAIAgentToolErrorCode::NothingChanged:
+        return TEXT("nothing_changed");
+    case EUEAIAgentToolErrorCode::Stopped:
+        return TEXT("stopped");
+    default:
+        return TEXT("none");
+    }
+}
+
+bool FUEAIAgentToolResult::Fail(EUEAIAgentToolErrorCode InErrorCode, const TCHAR* InErrorText)
+{
+    bOk = false;
+    ErrorCode = InErrorCode;
+    ErrorText = InErrorText;
+    return false;
+}
+
+void FUEAIAgentToolResult::RecordInstances(FName Actor, const TArray<int32>& Indices)
+{
+    InstanceCount += Indices.Num();
+    for (int32 Index : Indices)
+    {
+        FUEAIAgentInstanceRange* Last = InstanceRanges.IsEmpty() ? nullptr : &InstanceRanges.Last();
+        if (Last && Last->Actor == Actor && Last->Start + Last->Count == Index)
+        {
+            ++Last->Count;
+            continue;
+        }
+
+        FUEAIAgentInstanceRange& Range = InstanceRanges.AddDefaulted_GetRef();
+        Range.Actor = Actor;
+        Range.Start = Index;
+        Range.Count = 1;
+    }
+}
+
+FString FUEAIAgentToolResult::ToMessage() const
+{
+    if (ErrorText)
+    {
+        return Detail.IsEmpty() ? FString(ErrorText) : FString::Printf(TEXT("%s %s"), ErrorText, *Detail);
+    }
+
+    if (ErrorCode == EUEAIAgentToolErrorCode::NothingChanged)
+    {
+        return FString::Printf(TEXT("%s: nothing changed on %d target(s)."), Tool, TargetCount);
+    }
+
+    TArray<FString> Parts;
+    if (ActorCount > 0 || (ComponentCount == 0 && InstanceCount == 0 && TargetCount > 0))
+    {
+        Parts.Add(FString::Printf(TEXT("%d actor(s)"), ActorCount));
+    }
+    if (ComponentCount > 0)
+    {
+        Parts.Add(FString::Printf(TEXT("%d component(s)"), ComponentCount));
+    }
+    if (InstanceCount > 0)
+    {
+        Parts.Add(FString::Printf(TEXT("%d instance(s)"), InstanceCount));
+    }
+
+    FString Message = FString::Printf(TEXT("%s: %s"), Tool, Parts.IsEmpty() ? TEXT("done") : *FString::Join(Parts, TEXT(", ")));
+    if (RequestedCount > 0)
+    {
+        Message += FString::Printf(TEXT(" of %d requested"), RequestedCount);
+    }
+    Message += TEXT(".");
+    if (!InstanceRanges.IsEmpty())
+    {
+        TArray<FString> Ranges;
+        for (const FUEAIAgentInstanceRange& Range : InstanceRanges)
+        {
+            Ranges.Add(FString::Printf(TEXT("%s %d-%d"), *Range.Actor.ToString(), Range.Start, Range.Start + Range.Count - 1));
+        }
+        Message += FString::Printf(TEXT(" Instances: %s."), *FString::Join(Ranges, TEXT(", ")));
+    }
+    if (bUsedSelectionFallback)
+    {
+        Message += TEXT(" (fallback: used current selection)");
+    }
+    return Message;
+}
+
+TSharedRef<FJsonObject> FUEAIAgentToolResult::ToJson() const
+{
+    TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+    Object->SetBoolField(TEXT("ok"), bOk);
+    Object->SetStringField(TEXT("message"), ToMessage());
+    Object->SetStringField(TEXT("tool"), Tool);
+    if (ErrorCode != EUEAIAgentToolErrorCode::None)
+    {
+        Object->SetStringField(TEXT("errorCode"), LexToString(ErrorCode));
+    }
+
+    TSharedRef<FJsonObject> Counts = MakeShared<FJsonObject>();
+    Counts->SetNumberField(TEXT("targets"), TargetCount);
+    Counts->SetNumberField(TEXT("actors"), ActorCount);
+    Counts->SetNumberField(TEXT("components"), ComponentCount);
+    Counts->SetNumberField(TEXT("instances"), InstanceCount);
+    Counts->SetNumberField(TEXT("requested"), RequestedCount);
+    Object->SetObjectField(TEXT("counts"), Counts);
+
+    TArray<TSharedPtr<FJsonValue>> ActorIds;
+    const int32 ReportedCount = FMath::Min(AffectedActors.Num(), MaxReportedActorIds);
+    ActorIds.Reserve(ReportedCount);
+    for (int32 Index = 0; Index < ReportedCount; ++Index)
+    {
+        ActorIds.Add(MakeShared<FJsonValueString>(AffectedActors[Index].ToString()));
+    }
+    Object->SetArrayField(TEXT("affectedActors"), ActorIds);
+
+    if (!InstanceRanges.IsEmpty())
+    {
+        TArray<TSharedPtr<FJsonValue>> Ranges;
+        Ranges.Reserve(InstanceRanges.Num());
+        for (const FUEAIAgentInstanceRange& Range : InstanceRanges)
+        {
+            TSharedRef<FJsonObject> RangeObject = MakeShared<FJsonObject>();
+            RangeObject->SetStringField(TEXT("actor"), Range.Actor.ToString());
+            RangeObject->SetNumberField(TEXT("start"), Range.Start);
+            RangeObject->SetNumberField(TEXT("count"), Range.Count);
+            Ranges.Add(MakeShared<FJsonValueObject>(RangeObject));
+        }
+        Object->SetArrayField(TEXT("instanceRanges"), Ranges);
+    }
+    Object->SetNumberField(TEXT("durationMs"), DurationSeconds * 1000.0);
+    if (bUsedSelectionFallback)
+    {
+        Object->SetBoolField(TEXT("usedSelectionFallback"), true);
+    }
+    return Object;
+}
@@ -1,5 +1,11 @@
 #include "UEAIAgentTransportModule.h"
 
+#include "UEAIAgentContextCommands.h"
+#include "UEAIAgentCoreClient.h"
+#include "UEAIAgentEventChannel.h"
+#include "UEAIAgentRequestBody.h"
+#include "UEAIAgentResponseParser.h"
+#include "UEAIAgentSceneSnapshot.h"
 #include "UEAIAgentSettings.h"
 #include "Async/Async.h"
 #include "Components/ActorComponent.h"
@@ -11,12 +17,10 @@
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
-#include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
-#include "Serialization/JsonWriter.h"
-#include "Serialization/JsonSerializer.h"
 #include "Modules/ModuleManager.h"
+#include "Selection.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUEAIAgentTransport, Log, All);
 
@@ -66,19 +70,6 @@ namespace
         return EUEAIAgentRiskLevel::Low;
     }
 
-    FString NormalizeChatType(const FString& Value)
-    {
-        if (Value.Equals(TEXT("chat"), ESearchCase::IgnoreCase))
-        {
-            return TEXT("chat");
-        }
-        if (Value.Equals(TEXT("agent"), ESearchCase::IgnoreCase))
-        {
-            return TEXT("agent");
-        }
-        return TEXT("");
-    }
-
     bool IsNearlyZeroValue(float Value)
     {
         return FMath::Abs(Value) <= KINDA_SMALL_NUMBER;
@@ -330,8 +321,10 @@ namespace
             double Count = 1.0;
             if ((*ParamsObj)->TryGetNumberField(TEXT("count"), Count))
             {
-                ParsedAction.SpawnCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(Count)), 1, 200);
+                ParsedAction.SpawnCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(Count)), 1, GetDefault<UUEAIAgentSettings>()->MaxCreateActorCount);
             }
+            (*ParamsObj)->TryGetStringField(TEXT("meshPath"), ParsedAction.SpawnMeshPath);
+            (*ParamsObj)->TryGetBoolField(TEXT("instanced"), ParsedAction.bSpawnInstanced);
 
             const TSharedPtr<FJsonObject>* LocationObj = nullptr;
             if ((*ParamsObj)->TryGetObjectField(TEXT("location"), LocationObj) &&
@@ -760,6 +753,7 @@ namespace
             {
                 ParsedAction.DuplicateCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(CountValue)), 1, 20);
             }
+            (*ParamsObj)->TryGetBoolField(TEXT("instanced"), ParsedAction.bDuplicateInstanced);
 
             const TSharedPtr<FJsonObject>* OffsetObj = nullptr;
             if ((*ParamsObj)->TryGetObjectField(TEXT("offset"), OffsetObj) && OffsetObj && OffsetObj->IsValid())
@@ -814,114 +808,215 @@ namespace
         return false;
     }
 
-    TSharedRef<FJsonObject> BuildContextObject(const TArray<FString>& SelectedActors)
+    constexpr int32 ContextSummaryMaxClasses = 12;
+    constexpr int32 ContextNearbyActorCount = 24;
+
+    constexpr int32 ContextBodyReserveBytes = 4096;
+    constexpr int32 ContextReplyReserveBytes = 16 * 1024;
+
+    void WriteSelectedActor(FUEAIAgentRequestBody& Body, const AActor* Actor)
     {
-        TSharedRef<FJsonObject> Context = MakeShared<FJsonObject>();
+        Body->WriteObjectStart();
+        Body->WriteValue(TEXT("name"), Actor->GetName());
+        Body->WriteValue(TEXT("label"), Actor->GetActorLabel());
+        Body->WriteValue(TEXT("class"), Actor->GetClass() ? Actor->GetClass()->GetName() : TEXT("Unknown"));
+        Body.WriteVector(TEXT("location"), Actor->GetActorLocation());
+        Body.WriteRotator(TEXT("rotation"), Actor->GetActorRotation());
+        Body.WriteVector(TEXT("scale"), Actor->GetActorScale3D());
 
-        TArray<TSharedPtr<FJsonValue>> SelectionNames;
-        for (const FString& ActorName : SelectedActors)
+        Body->WriteArrayStart(TEXT("components"));
+        TInlineComponentArray<UActorComponent*> Components;
+        Actor->GetComponents(Components);
+        for (const UActorComponent* Component : Components)
         {
-            SelectionNames.Add(MakeShared<FJsonValueString>(ActorName));
+            if (!Component)
+            {
+                continue;
+            }
+
+            Body->WriteObjectStart();
+            Body->WriteValue(TEXT("name"), Component->GetName());
+            Body->WriteValue(TEXT("class"), Component->GetClass() ? Component->GetClass()->GetName() : TEXT("Unknown"));
+            Body->WriteObjectEnd();
         }
-        Context->SetArrayField(TEXT("selectionNames"), SelectionNames);
+        Body->WriteArrayEnd();
+        Body->WriteObjectEnd();
+    }
+
+    void WriteContextObject(FUEAIAgentRequestBody& Body, const TArray<FString>& SelectedActors)
+    {
+        Body->WriteObjectStart(TEXT("context"));
+        Body.WriteStringArray(TEXT("selectionNames"), SelectedActors);
 
-        TArray<TSharedPtr<FJsonValue>> SelectionDetails;
-        if (GEditor)
+        UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+        FBox SelectionBounds(ForceInit);
+        Body->WriteArrayStart(TEXT("selection"));
+        if (World && SelectedActors.Num() > 0)
         {
-            UWorld* World = GEditor->GetEditorWorldContext().World();
-            if (World)
+            TSet<FString> PendingNames(SelectedActors);
+
+            // The names nearly always come from the live selection, so serialize straight from it.
+            if (USelection* Selection = GEditor->GetSelectedActors())
             {
-                for (TActorIterator<AActor> It(World); It; ++It)
+                for (FSelectionIterator It(*Selection); It && PendingNames.Num() > 0; ++It)
                 {
-                    AActor* Actor = *It;
-                    if (!Actor)
+                    const AActor* Actor = Cast<AActor>(*It);
+                    if (Actor && Actor->GetWorld() == World && PendingNames.Remove(Actor->GetName()) > 0)
                     {
-                        continue;
+                        WriteSelectedActor(Body, Actor);
+                        SelectionBounds += Actor->GetActorLocation();
                     }
+                }
+            }
 
-                    const FString ActorName = Actor->GetName();
-                    if (!SelectedActors.Contains(ActorName))
+            // Names kept from an earlier selection are resolved by object name inside each level.
+            for (const FString& ActorName : PendingNames)
+            {
+                const FName ActorFName(*ActorName);
+                for (ULevel* Level : World->GetLevels())
+                {
+                    const AActor* Actor = Level ? FindObjectFast<AActor>(Level, ActorFName) : nullptr;
+                    if (IsValid(Actor))
                     {
-                        continue;
+                        WriteSelectedActor(Body, Actor);
+                        SelectionBounds += Actor->GetActorLocation();
+                        break;
                     }
+                }
+            }
+        }
+        Body->WriteArrayEnd();
 
-                    TSharedRef<FJsonObject> ActorObj = MakeShared<FJsonObject>();
-                    ActorObj->SetStringField(TEXT("name"), ActorName);
-                    ActorObj->SetStringField(TEXT("label"), Actor->GetActorLabel());
-                    ActorObj->SetStringField(TEXT("class"), Actor->GetClass() ? Actor->GetClass()->GetName() : TEXT("Unknown"));
+        if (World)
+        {
+            Body->WriteObjectStart(TEXT("level"));
+            Body->WriteValue(TEXT("mapName"), World->GetMapName());
+            if (World->GetCurrentLevel())
+            {
+                Body->WriteValue(TEXT("levelName"), World->GetCurrentLevel()->GetOuter()->GetName());
+            }
+            Body->WriteObjectEnd();
 
-                    const FVector Location = Actor->GetActorLocation();
-                    const FRotator Rotation = Actor->GetActorRotation();
-                    const FVector Scale = Actor->GetActorScale3D();
+            FUEAIAgentSceneSnapshot& Snapshot = FUEAIAgentSceneSnapshot::Get();
+            Snapshot.Refresh();
+            Body.WriteJsonObject(TEXT("sceneSummary"), Snapshot.BuildSummary(ContextSummaryMaxClasses));
 
-                    TSharedRef<FJsonObject> Transform = MakeShared<FJsonObject>();
-                    Transform->SetNumberField(TEXT("x"), Location.X);
-                    Transform->SetNumberField(TEXT("y"), Location.Y);
-                    Transform->SetNumberField(TEXT("z"), Location.Z);
-                    ActorObj->SetObjectField(TEXT("location"), Transform);
+            // Only the neighbourhood of the selection is sent; the rest of the level stays in the snapshot.
+            if (SelectionBounds.IsValid)
+            {
+                TArray<TSharedPtr<FJsonValue>> NearbyActors;
+                Snapshot.FindNearestActors(
+                    SelectionBounds.GetCenter(),
+                    ContextNearbyActorCount,
+                    FString(),
+                    TSet<FString>(SelectedActors),
+                    NearbyActors);
+                Body.WriteJsonArray(TEXT("nearbyActors"), NearbyActors);
+            }
+        }
 
-                    TSharedRef<FJsonObject> RotObj = MakeShared<FJsonObject>();
-                    RotObj->SetNumberField(TEXT("pitch"), Rotation.Pitch);
-                    RotObj->SetNumberField(TEXT("yaw"), Rotation.Yaw);
-                    RotObj->SetNumberField(TEXT("roll"), Rotation.Roll);
-                    ActorObj->SetObjectField(TEXT("rotation"), RotObj);
+        Body->WriteObjectEnd();
+    }
 
-                    TSharedRef<FJsonObject> ScaleObj = MakeShared<FJsonObject>();
-                    ScaleObj->SetNumberField(TEXT("x"), Scale.X);
-                    ScaleObj->SetNumberField(TEXT("y"), Scale.Y);
-                    ScaleObj->SetNumberField(TEXT("z"), Scale.Z);
-                    ActorObj->SetObjectField(TEXT("scale"), ScaleObj);
+    constexpr int32 ChatHistoryPageSize = 100;
+    constexpr int32 ChatHistoryCacheCapacity = 1000;
+    constexpr int32 MaxCachedChatHistories = 8;
 
-                    TArray<TSharedPtr<FJsonValue>> ComponentsArray;
-                    TArray<UActorComponent*> Components;
-                    Actor->GetComponents(Components);
-                    for (UActorComponent* Component : Components)
-                    {
-                        if (!Component)
-                        {
-                            continue;
-                        }
+    bool ReadHealthStatus(const TSharedPtr<FJsonObject>& HealthJson, FString& OutMessage)
+    {
+        bool bOk = false;
+        if (!HealthJson->TryGetBoolField(TEXT("ok"), bOk))
+        {
+            OutMessage = TEXT("Health response misses 'ok' field.");
+            return false;
+        }
 
-                        TSharedRef<FJsonObject> CompObj = MakeShared<FJsonObject>();
-                        CompObj->SetStringField(TEXT("name"), Component->GetName());
-                        CompObj->SetStringField(TEXT("class"), Component->GetClass() ? Component->GetClass()->GetName() : TEXT("Unknown"));
-                        ComponentsArray.Add(MakeShared<FJsonValueObject>(CompObj));
-                    }
-                    ActorObj->SetArrayField(TEXT("components"), ComponentsArray);
+        FString Provider;
+        HealthJson->TryGetStringField(TEXT("provider"), Provider);
+        if (!bOk)
+        {
+            OutMessage = TEXT("Agent Core reports unhealthy state.");
+            return false;
+        }
 
-                    SelectionDetails.Add(MakeShared<FJsonValueObject>(ActorObj));
-                }
-            }
+        OutMessage = Provider.IsEmpty()
+            ? TEXT("Connected.")
+            : FString::Printf(TEXT("Connected. Provider: %s"), *Provider);
+        return true;
+    }
+
+    bool ReadChatSummaryObject(const TSharedPtr<FJsonObject>& ChatObj, FUEAIAgentChatSummary& OutChat)
+    {
+        if (!ChatObj.IsValid() || !ChatObj->TryGetStringField(TEXT("id"), OutChat.Id) || OutChat.Id.IsEmpty())
+        {
+            return false;
         }
 
-        Context->SetArrayField(TEXT("selection"), SelectionDetails);
+        ChatObj->TryGetStringField(TEXT("title"), OutChat.Title);
+        ChatObj->TryGetBoolField(TEXT("archived"), OutChat.bArchived);
+        ChatObj->TryGetStringField(TEXT("lastActivityAt"), OutChat.LastActivityAt);
+        return true;
+    }
 
-        if (GEditor)
+    // Parses the response body on a worker thread, then hands the result over to OnGameThread on the
+    // game thread. The worker owns the result until then and never touches module state, so handlers
+    // only swap parsed data in and run callbacks. Requests that never connected skip the parse.
+    template <typename ResultType, typename FuncType>
+    void ParseResponseOnWorker(
+        const FHttpResponsePtr& HttpResponse,
+        bool bConnectedSuccessfully,
+        bool (*Parse)(TConstArrayView<uint8>, ResultType&),
+        FuncType&& OnGameThread)
+    {
+        if (!bConnectedSuccessfully || !HttpResponse.IsValid())
         {
-            UWorld* World = GEditor->GetEditorWorldContext().World();
-            if (World)
+            AsyncTask(ENamedThreads::GameThread, [OnGameThread = Forward<FuncType>(OnGameThread)]() mutable
             {
-                TSharedRef<FJsonObject> LevelObj = MakeShared<FJsonObject>();
-                LevelObj->SetStringField(TEXT("mapName"), World->GetMapName());
-                if (World->GetCurrentLevel())
-                {
-                    LevelObj->SetStringField(TEXT("levelName"), World->GetCurrentLevel()->GetOuter()->GetName());
-                }
-                Context->SetObjectField(TEXT("level"), LevelObj);
-            }
+                OnGameThread(false, ResultType());
+            });
+            return;
         }
 
-        return Context;
+        AsyncTask(
+            ENamedThreads::AnyBackgroundThreadNormalTask,
+            [HttpResponse, Parse, OnGameThread = Forward<FuncType>(OnGameThread)]() mutable
+            {
+                ResultType Parsed;
+                const bool bParsed = Parse(HttpResponse->GetContent(), Parsed);
+                AsyncTask(
+                    ENamedThreads::GameThread,
+                    [bParsed, Parsed = MoveTemp(Parsed), OnGameThread = MoveTemp(OnGameThread)]() mutable
+                    {
+                        OnGameThread(bParsed, MoveTemp(Parsed));
+                    });
+            });
     }
 }
 
 void FUEAIAgentTransportModule::StartupModule()
 {
+    CoreClient = MakeShared<FUEAIAgentCoreClient>();
+    EventChannel = MakeShared<FUEAIAgentEventChannel>(
+        [this](const FString& Type, const TSharedPtr<FJsonObject>& Event)
+        {
+            HandleChannelEvent(Type, Event);
+        },
+        [this](bool bConnected)
+        {
+            HandleChannelConnectionChanged(bConnected);
+        });
     UE_LOG(LogUEAIAgentTransport, Log, TEXT("UEAIAgentTransport started."));
 }
 
 void FUEAIAgentTransportModule::ShutdownModule()
 {
+    // Pending session replies would fall back to HTTP through this module; drop them instead of failing them.
+    if (EventChannel.IsValid())
+    {
+        EventChannel->Shutdown();
+    }
+    EventChannel.Reset();
+    CoreClient.Reset();
     UE_LOG(LogUEAIAgentTransport, Log, TEXT("UEAIAgentTransport stopped."));
 }
 
@@ -933,6 +1028,11 @@ FString FUEAIAgentTransportModule::BuildBaseUrl() const
     return FString::Printf(TEXT("http://%s:%d"), *Host, Port);
 }
 
+FString FUEAIAgentTransportModule::BuildEventsUrl() const
+{
+    return BuildBaseUrl().Replace(TEXT("http://"), TEXT("ws://")) + TEXT("/v1/events");
+}
+
 FString FUEAIAgentTransportModule::BuildHealthUrl() const
 {
     return BuildBaseUrl() + TEXT("/health");
@@ -1026,71 +1126,73 @@ FString FUEAIAgentTransportModule::BuildChatDetailsUrl(const FString& ChatId) co
     return BuildBaseUrl() + TEXT("/v1/chats/") + FGenericPlatformHttp::UrlEncode(ChatId) + TEXT("/details");
 }
 
-FString FUEAIAgentTransportModule::BuildChatHistoryUrl(const FString& ChatId, int32 Limit) const
+FString FUEAIAgentTransportModule::BuildChatHistoryUrl(
+    const FString& ChatId,
+    int32 Limit,
+    const FString& SinceId,
+    const FString& BeforeId) const
 {
-    FString Url = BuildBaseUrl() + TEXT("/v1/chats/") + FGenericPlatformHttp::UrlEncode(ChatId) + TEXT("/details");
+    TArray<FString> Query;
     if (Limit > 0)
     {
-        Url += FString::Printf(TEXT("?limit=%d"), FMath::Max(1, Limit));
+        Query.Add(FString::Printf(TEXT("limit=%d"), FMath::Max(1, Limit)));
+    }
+    if (!SinceId.IsEmpty())
+    {
+        Query.Add(TEXT("since=") + FGenericPlatformHttp::UrlEncode(SinceId));
+    }
+    if (!BeforeId.IsEmpty())
+    {
+        Query.Add(TEXT("before=") + FGenericPlatformHttp::UrlEncode(BeforeId));
+    }
+
+    FString Url = BuildBaseUrl() + TEXT("/v1/chats/") + FGenericPlatformHttp::UrlEncode(ChatId) + TEXT("/details");
+    if (Query.Num() > 0)
+    {
+        Url += TEXT("?") + FString::Join(Query, TEXT("&"));
     }
     return Url;
 }
 
 void FUEAIAgentTransportModule::CheckHealth(const FOnUEAIAgentHealthChecked& Callback) const
 {
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildHealthUrl());
-    Request->SetVerb(TEXT("GET"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("GET"), BuildHealthUrl());
 
     Request->OnProcessRequestComplete().BindLambda(
         [Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Agent Core is not reachable."));
-                    return;
-                }
-
-                const int32 StatusCode = HttpResponse->GetResponseCode();
-                if (StatusCode < 200 || StatusCode >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Health check failed (%d)."), StatusCode));
-                    return;
-                }
-
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Health response is not valid JSON."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Agent Core is not reachable."));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk))
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Health response misses 'ok' field."));
-                    return;
-                }
+                    const int32 StatusCode = HttpResponse->GetResponseCode();
+                    if (StatusCode < 200 || StatusCode >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Health check failed (%d)."), StatusCode));
+                        return;
+                    }
 
-                FString Provider;
-                ResponseJson->TryGetStringField(TEXT("provider"), Provider);
-                if (!bOk)
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Agent Core reports unhealthy state."));
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Health response is not valid JSON."));
+                        return;
+                    }
 
-                const FString Message = Provider.IsEmpty()
-                    ? TEXT("Connected.")
-                    : FString::Printf(TEXT("Connected. Provider: %s"), *Provider);
-                Callback.ExecuteIfBound(true, Message);
-            });
+                    FString Message;
+                    const bool bHealthy = ReadHealthStatus(ResponseJson, Message);
+                    Callback.ExecuteIfBound(bHealthy, Message);
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::PlanTask(
@@ -1101,793 +1203,762 @@ void FUEAIAgentTransportModule::PlanTask(
     const FString& Model,
     const FOnUEAIAgentTaskPlanned& Callback) const
 {
-    PlannedActions.Empty();
+    PlannedActions.Reset();
     LastPlanSummary.Empty();
     ActiveSessionId.Empty();
     ActiveSessionActionIndex = INDEX_NONE;
+    ActiveSessionStopCondition.Empty();
     ActiveSessionSelectedActors.Empty();
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("prompt"), Prompt);
-    Root->SetStringField(TEXT("mode"), Mode.IsEmpty() ? TEXT("chat") : Mode);
-    Root->SetObjectField(TEXT("context"), BuildContextObject(SelectedActors));
-    if (!Provider.IsEmpty())
-    {
-        Root->SetStringField(TEXT("provider"), Provider);
-    }
-    if (!Model.IsEmpty())
-    {
-        Root->SetStringField(TEXT("model"), Model);
-    }
-    if (!ActiveChatId.IsEmpty())
-    {
-        Root->SetStringField(TEXT("chatId"), ActiveChatId);
-    }
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+    FUEAIAgentRequestBody Body(ContextBodyReserveBytes);
+    Body->WriteValue(TEXT("prompt"), Prompt);
+    Body->WriteValue(TEXT("mode"), Mode.IsEmpty() ? TEXT("chat") : Mode);
+    WriteContextObject(Body, SelectedActors);
+    Body.WriteJsonObject(TEXT("sceneDelta"), BuildSceneDelta());
+    Body.WriteStringIfNotEmpty(TEXT("provider"), Provider);
+    Body.WriteStringIfNotEmpty(TEXT("model"), Model);
+    Body.WriteStringIfNotEmpty(TEXT("chatId"), ActiveChatId);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildPlanUrl());
-    Request->SetVerb(TEXT("POST"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildPlanUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
 
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback, SelectedActors](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, SelectedActors, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParsePlan,
+                [this, Callback, SelectedActors, HttpResponse, bConnectedSuccessfully](bool bValidJson, FUEAIAgentPlanResponse&& Parsed)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(
-                        false,
-                        FString::Printf(TEXT("Plan request failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Plan response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(
+                            false,
+                            FString::Printf(TEXT("Plan request failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned an error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Plan response is not valid JSON."));
+                        return;
+                    }
 
-                const TSharedPtr<FJsonObject>* PlanObj = nullptr;
-                if (!ResponseJson->TryGetObjectField(TEXT("plan"), PlanObj) || !PlanObj || !PlanObj->IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Plan response misses 'plan' object."));
-                    return;
-                }
+                    if (!Parsed.bOk)
+                    {
+                        Callback.ExecuteIfBound(false, Parsed.Error.IsEmpty() ? TEXT("Agent Core returned an error.") : Parsed.Error);
+                        return;
+                    }
 
-                FString Summary;
-                (*PlanObj)->TryGetStringField(TEXT("summary"), Summary);
-                LastPlanSummary = Summary.TrimStartAndEnd();
-                TArray<FString> Steps;
-                const TArray<TSharedPtr<FJsonValue>>* StepValues = nullptr;
-                if ((*PlanObj)->TryGetArrayField(TEXT("steps"), StepValues) && StepValues)
-                {
-                    for (const TSharedPtr<FJsonValue>& StepValue : *StepValues)
+                    if (Parsed.bHasSceneAck)
                     {
-                        if (!StepValue.IsValid())
-                        {
-                            continue;
-                        }
-                        FString StepText;
-                        if (StepValue->TryGetString(StepText))
-                        {
-                            StepText = StepText.TrimStartAndEnd();
-                            if (!StepText.IsEmpty())
-                            {
-                                Steps.Add(StepText);
-                            }
-                        }
+                        ApplySceneAck(Parsed.SceneAck);
                     }
-                }
 
-                const TArray<TSharedPtr<FJsonValue>>* Actions = nullptr;
-                if ((*PlanObj)->TryGetArrayField(TEXT("actions"), Actions) && Actions)
-                {
-                    for (const TSharedPtr<FJsonValue>& ActionValue : *Actions)
+                    if (!Parsed.bHasPlan)
                     {
-                        if (!ActionValue.IsValid())
-                        {
-                            continue;
-                        }
+                        Callback.ExecuteIfBound(false, TEXT("Plan response misses 'plan' object."));
+                        return;
+                    }
 
-                        const TSharedPtr<FJsonObject> ActionObj = ActionValue->AsObject();
-                        if (!ActionObj.IsValid())
-                        {
-                            continue;
-                        }
+                    const FString& Summary = Parsed.Summary;
+                    LastPlanSummary = Summary.TrimStartAndEnd();
+                    const TArray<FString>& Steps = Parsed.Steps;
 
-                        const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
-                        if (!ActionObj->TryGetObjectField(TEXT("params"), ParamsObj) || !ParamsObj || !ParamsObj->IsValid())
-                        {
-                            continue;
-                        }
+                    TArray<FUEAIAgentPlannedSceneAction> ReceivedActions;
 
-                        FString Command;
-                        if (!ActionObj->TryGetStringField(TEXT("command"), Command))
+                    if (Parsed.Actions.Num() > 0)
+                    {
+                        for (const TSharedPtr<FJsonObject>& ActionObj : Parsed.Actions)
                         {
-                            continue;
-                        }
 
-                        if (Command == TEXT("scene.modifyActor"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
+                            const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+                            if (!ActionObj->TryGetObjectField(TEXT("params"), ParamsObj) || !ParamsObj || !ParamsObj->IsValid())
                             {
                                 continue;
                             }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::ModifyActor;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                            FString Command;
+                            if (!ActionObj->TryGetStringField(TEXT("command"), Command))
                             {
-                                ParsedAction.ActorNames = SelectedActors;
+                                continue;
                             }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+
+                            if (Command == TEXT("scene.modifyActor"))
                             {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            bool bHasAnyDelta = false;
-                            const TSharedPtr<FJsonObject>* DeltaLocationObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("deltaLocation"), DeltaLocationObj) &&
-                                DeltaLocationObj && DeltaLocationObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*DeltaLocationObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*DeltaLocationObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*DeltaLocationObj)->TryGetNumberField(TEXT("z"), Z))
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::ModifyActor;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
                                 {
-                                    ParsedAction.DeltaLocation = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
-                                    bHasAnyDelta = true;
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
                                 }
-                            }
 
-                            const TSharedPtr<FJsonObject>* DeltaRotationObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("deltaRotation"), DeltaRotationObj) &&
-                                DeltaRotationObj && DeltaRotationObj->IsValid())
-                            {
-                                double Pitch = 0.0;
-                                double Yaw = 0.0;
-                                double Roll = 0.0;
-                                if ((*DeltaRotationObj)->TryGetNumberField(TEXT("pitch"), Pitch) &&
-                                    (*DeltaRotationObj)->TryGetNumberField(TEXT("yaw"), Yaw) &&
-                                    (*DeltaRotationObj)->TryGetNumberField(TEXT("roll"), Roll))
-                                {
-                                    ParsedAction.DeltaRotation = FRotator(
-                                        static_cast<float>(Pitch),
-                                        static_cast<float>(Yaw),
-                                        static_cast<float>(Roll));
-                                    bHasAnyDelta = true;
+                                bool bHasAnyDelta = false;
+                                const TSharedPtr<FJsonObject>* DeltaLocationObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("deltaLocation"), DeltaLocationObj) &&
+                                    DeltaLocationObj && DeltaLocationObj->IsValid())
+                                {
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*DeltaLocationObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*DeltaLocationObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*DeltaLocationObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.DeltaLocation = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                        bHasAnyDelta = true;
+                                    }
                                 }
-                            }
 
-                            const TSharedPtr<FJsonObject>* DeltaScaleObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("deltaScale"), DeltaScaleObj) &&
-                                DeltaScaleObj && DeltaScaleObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*DeltaScaleObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*DeltaScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*DeltaScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                const TSharedPtr<FJsonObject>* DeltaRotationObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("deltaRotation"), DeltaRotationObj) &&
+                                    DeltaRotationObj && DeltaRotationObj->IsValid())
                                 {
-                                    ParsedAction.DeltaScale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
-                                    bHasAnyDelta = true;
+                                    double Pitch = 0.0;
+                                    double Yaw = 0.0;
+                                    double Roll = 0.0;
+                                    if ((*DeltaRotationObj)->TryGetNumberField(TEXT("pitch"), Pitch) &&
+                                        (*DeltaRotationObj)->TryGetNumberField(TEXT("yaw"), Yaw) &&
+                                        (*DeltaRotationObj)->TryGetNumberField(TEXT("roll"), Roll))
+                                    {
+                                        ParsedAction.DeltaRotation = FRotator(
+                                            static_cast<float>(Pitch),
+                                            static_cast<float>(Yaw),
+                                            static_cast<float>(Roll));
+                                        bHasAnyDelta = true;
+                                    }
                                 }
-                            }
 
-                            const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("scale"), ScaleObj) &&
-                                ScaleObj && ScaleObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*ScaleObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*ScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*ScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                const TSharedPtr<FJsonObject>* DeltaScaleObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("deltaScale"), DeltaScaleObj) &&
+                                    DeltaScaleObj && DeltaScaleObj->IsValid())
                                 {
-                                    ParsedAction.Scale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
-                                    ParsedAction.bHasScale = true;
-                                    bHasAnyDelta = true;
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*DeltaScaleObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*DeltaScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*DeltaScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.DeltaScale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                        bHasAnyDelta = true;
+                                    }
                                 }
-                            }
 
-                            if (bHasAnyDelta)
-                            {
-                                PlannedActions.Add(ParsedAction);
-                            }
-                            continue;
-                        }
+                                const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("scale"), ScaleObj) &&
+                                    ScaleObj && ScaleObj->IsValid())
+                                {
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*ScaleObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*ScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*ScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.Scale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                        ParsedAction.bHasScale = true;
+                                        bHasAnyDelta = true;
+                                    }
+                                }
 
-                        if (Command == TEXT("scene.createActor"))
-                        {
-                            FString ActorClass;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("actorClass"), ActorClass) || ActorClass.IsEmpty())
-                            {
+                                if (bHasAnyDelta)
+                                {
+                                    ReceivedActions.Add(ParsedAction);
+                                }
                                 continue;
                             }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::CreateActor;
-                            ParsedAction.ActorClass = ActorClass;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-
-                            double Count = 1.0;
-                            if ((*ParamsObj)->TryGetNumberField(TEXT("count"), Count))
+                            if (Command == TEXT("scene.createActor"))
                             {
-                                ParsedAction.SpawnCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(Count)), 1, 200);
-                            }
+                                FString ActorClass;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("actorClass"), ActorClass) || ActorClass.IsEmpty())
+                                {
+                                    continue;
+                                }
 
-                            const TSharedPtr<FJsonObject>* LocationObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("location"), LocationObj) &&
-                                LocationObj && LocationObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*LocationObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*LocationObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*LocationObj)->TryGetNumberField(TEXT("z"), Z))
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::CreateActor;
+                                ParsedAction.ActorClass = ActorClass;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+
+                                double Count = 1.0;
+                                if ((*ParamsObj)->TryGetNumberField(TEXT("count"), Count))
                                 {
-                                    ParsedAction.SpawnLocation = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                    ParsedAction.SpawnCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(Count)), 1, GetDefault<UUEAIAgentSettings>()->MaxCreateActorCount);
                                 }
-                            }
+                                (*ParamsObj)->TryGetStringField(TEXT("meshPath"), ParsedAction.SpawnMeshPath);
+                                (*ParamsObj)->TryGetBoolField(TEXT("instanced"), ParsedAction.bSpawnInstanced);
 
-                            const TSharedPtr<FJsonObject>* RotationObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("rotation"), RotationObj) &&
-                                RotationObj && RotationObj->IsValid())
-                            {
-                                double Pitch = 0.0;
-                                double Yaw = 0.0;
-                                double Roll = 0.0;
-                                if ((*RotationObj)->TryGetNumberField(TEXT("pitch"), Pitch) &&
-                                    (*RotationObj)->TryGetNumberField(TEXT("yaw"), Yaw) &&
-                                    (*RotationObj)->TryGetNumberField(TEXT("roll"), Roll))
-                                {
-                                    ParsedAction.SpawnRotation = FRotator(
-                                        static_cast<float>(Pitch),
-                                        static_cast<float>(Yaw),
-                                        static_cast<float>(Roll));
+                                const TSharedPtr<FJsonObject>* LocationObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("location"), LocationObj) &&
+                                    LocationObj && LocationObj->IsValid())
+                                {
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*LocationObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*LocationObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*LocationObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.SpawnLocation = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                    }
                                 }
-                            }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                const TSharedPtr<FJsonObject>* RotationObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("rotation"), RotationObj) &&
+                                    RotationObj && RotationObj->IsValid())
+                                {
+                                    double Pitch = 0.0;
+                                    double Yaw = 0.0;
+                                    double Roll = 0.0;
+                                    if ((*RotationObj)->TryGetNumberField(TEXT("pitch"), Pitch) &&
+                                        (*RotationObj)->TryGetNumberField(TEXT("yaw"), Yaw) &&
+                                        (*RotationObj)->TryGetNumberField(TEXT("roll"), Roll))
+                                    {
+                                        ParsedAction.SpawnRotation = FRotator(
+                                            static_cast<float>(Pitch),
+                                            static_cast<float>(Yaw),
+                                            static_cast<float>(Roll));
+                                    }
+                                }
 
-                        if (Command == TEXT("scene.deleteActor"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::DeleteActor;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = false;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                            if (Command == TEXT("scene.deleteActor"))
                             {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
 
-                        if (Command == TEXT("scene.modifyComponent"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::DeleteActor;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = false;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FString ComponentName;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("componentName"), ComponentName) || ComponentName.IsEmpty())
+                            if (Command == TEXT("scene.modifyComponent"))
                             {
-                                continue;
-                            }
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
+                                {
+                                    continue;
+                                }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::ModifyComponent;
-                            ParsedAction.ComponentName = ComponentName;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
-                            {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString ComponentName;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("componentName"), ComponentName) || ComponentName.IsEmpty())
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            bool bHasAnyDelta = false;
-                            const TSharedPtr<FJsonObject>* DeltaLocationObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("deltaLocation"), DeltaLocationObj) &&
-                                DeltaLocationObj && DeltaLocationObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*DeltaLocationObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*DeltaLocationObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*DeltaLocationObj)->TryGetNumberField(TEXT("z"), Z))
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::ModifyComponent;
+                                ParsedAction.ComponentName = ComponentName;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
                                 {
-                                    ParsedAction.ComponentDeltaLocation = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
-                                    bHasAnyDelta = true;
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
                                 }
-                            }
 
-                            const TSharedPtr<FJsonObject>* DeltaRotationObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("deltaRotation"), DeltaRotationObj) &&
-                                DeltaRotationObj && DeltaRotationObj->IsValid())
-                            {
-                                double Pitch = 0.0;
-                                double Yaw = 0.0;
-                                double Roll = 0.0;
-                                if ((*DeltaRotationObj)->TryGetNumberField(TEXT("pitch"), Pitch) &&
-                                    (*DeltaRotationObj)->TryGetNumberField(TEXT("yaw"), Yaw) &&
-                                    (*DeltaRotationObj)->TryGetNumberField(TEXT("roll"), Roll))
-                                {
-                                    ParsedAction.ComponentDeltaRotation = FRotator(
-                                        static_cast<float>(Pitch),
-                                        static_cast<float>(Yaw),
-                                        static_cast<float>(Roll));
-                                    bHasAnyDelta = true;
+                                bool bHasAnyDelta = false;
+                                const TSharedPtr<FJsonObject>* DeltaLocationObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("deltaLocation"), DeltaLocationObj) &&
+                                    DeltaLocationObj && DeltaLocationObj->IsValid())
+                                {
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*DeltaLocationObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*DeltaLocationObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*DeltaLocationObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.ComponentDeltaLocation = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                        bHasAnyDelta = true;
+                                    }
                                 }
-                            }
 
-                            const TSharedPtr<FJsonObject>* DeltaScaleObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("deltaScale"), DeltaScaleObj) &&
-                                DeltaScaleObj && DeltaScaleObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*DeltaScaleObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*DeltaScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*DeltaScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                const TSharedPtr<FJsonObject>* DeltaRotationObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("deltaRotation"), DeltaRotationObj) &&
+                                    DeltaRotationObj && DeltaRotationObj->IsValid())
                                 {
-                                    ParsedAction.ComponentDeltaScale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
-                                    bHasAnyDelta = true;
+                                    double Pitch = 0.0;
+                                    double Yaw = 0.0;
+                                    double Roll = 0.0;
+                                    if ((*DeltaRotationObj)->TryGetNumberField(TEXT("pitch"), Pitch) &&
+                                        (*DeltaRotationObj)->TryGetNumberField(TEXT("yaw"), Yaw) &&
+                                        (*DeltaRotationObj)->TryGetNumberField(TEXT("roll"), Roll))
+                                    {
+                                        ParsedAction.ComponentDeltaRotation = FRotator(
+                                            static_cast<float>(Pitch),
+                                            static_cast<float>(Yaw),
+                                            static_cast<float>(Roll));
+                                        bHasAnyDelta = true;
+                                    }
                                 }
-                            }
 
-                            const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("scale"), ScaleObj) &&
-                                ScaleObj && ScaleObj->IsValid())
-                            {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*ScaleObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*ScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*ScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                const TSharedPtr<FJsonObject>* DeltaScaleObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("deltaScale"), DeltaScaleObj) &&
+                                    DeltaScaleObj && DeltaScaleObj->IsValid())
                                 {
-                                    ParsedAction.ComponentScale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
-                                    ParsedAction.bComponentHasScale = true;
-                                    bHasAnyDelta = true;
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*DeltaScaleObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*DeltaScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*DeltaScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.ComponentDeltaScale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                        bHasAnyDelta = true;
+                                    }
                                 }
-                            }
 
-                            bool bVisibility = false;
-                            if ((*ParamsObj)->TryGetBoolField(TEXT("visibility"), bVisibility))
-                            {
-                                ParsedAction.bComponentVisibilityEdit = true;
-                                ParsedAction.bComponentVisible = bVisibility;
-                            }
+                                const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("scale"), ScaleObj) &&
+                                    ScaleObj && ScaleObj->IsValid())
+                                {
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*ScaleObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*ScaleObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*ScaleObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.ComponentScale = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                        ParsedAction.bComponentHasScale = true;
+                                        bHasAnyDelta = true;
+                                    }
+                                }
 
-                            if (!bHasAnyDelta && !ParsedAction.bComponentVisibilityEdit)
-                            {
-                                continue;
-                            }
+                                bool bVisibility = false;
+                                if ((*ParamsObj)->TryGetBoolField(TEXT("visibility"), bVisibility))
+                                {
+                                    ParsedAction.bComponentVisibilityEdit = true;
+                                    ParsedAction.bComponentVisible = bVisibility;
+                                }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                if (!bHasAnyDelta && !ParsedAction.bComponentVisibilityEdit)
+                                {
+                                    continue;
+                                }
 
-                        if (Command == TEXT("scene.addActorTag"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FString Tag;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("tag"), Tag) || Tag.IsEmpty())
+                            if (Command == TEXT("scene.addActorTag"))
                             {
-                                continue;
-                            }
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
+                                {
+                                    continue;
+                                }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::AddActorTag;
-                            ParsedAction.ActorTag = Tag;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
-                            {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString Tag;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("tag"), Tag) || Tag.IsEmpty())
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::AddActorTag;
+                                ParsedAction.ActorTag = Tag;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
 
-                        if (Command == TEXT("scene.setComponentMaterial"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FString ComponentName;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("componentName"), ComponentName) || ComponentName.IsEmpty())
+                            if (Command == TEXT("scene.setComponentMaterial"))
                             {
-                                continue;
-                            }
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
+                                {
+                                    continue;
+                                }
 
-                            FString MaterialPath;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("materialPath"), MaterialPath) || MaterialPath.IsEmpty())
-                            {
-                                continue;
-                            }
+                                FString ComponentName;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("componentName"), ComponentName) || ComponentName.IsEmpty())
+                                {
+                                    continue;
+                                }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::SetComponentMaterial;
-                            ParsedAction.ComponentName = ComponentName;
-                            ParsedAction.MaterialPath = MaterialPath;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
-                            {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString MaterialPath;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("materialPath"), MaterialPath) || MaterialPath.IsEmpty())
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            double SlotValue = 0.0;
-                            if ((*ParamsObj)->TryGetNumberField(TEXT("materialSlot"), SlotValue))
-                            {
-                                ParsedAction.MaterialSlot = FMath::Max(0, FMath::RoundToInt(static_cast<float>(SlotValue)));
-                            }
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::SetComponentMaterial;
+                                ParsedAction.ComponentName = ComponentName;
+                                ParsedAction.MaterialPath = MaterialPath;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                double SlotValue = 0.0;
+                                if ((*ParamsObj)->TryGetNumberField(TEXT("materialSlot"), SlotValue))
+                                {
+                                    ParsedAction.MaterialSlot = FMath::Max(0, FMath::RoundToInt(static_cast<float>(SlotValue)));
+                                }
 
-                        if (Command == TEXT("scene.setComponentStaticMesh"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FString ComponentName;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("componentName"), ComponentName) || ComponentName.IsEmpty())
+                            if (Command == TEXT("scene.setComponentStaticMesh"))
                             {
-                                continue;
-                            }
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
+                                {
+                                    continue;
+                                }
 
-                            FString MeshPath;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("meshPath"), MeshPath) || MeshPath.IsEmpty())
-                            {
-                                continue;
-                            }
+                                FString ComponentName;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("componentName"), ComponentName) || ComponentName.IsEmpty())
+                                {
+                                    continue;
+                                }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::SetComponentStaticMesh;
-                            ParsedAction.ComponentName = ComponentName;
-                            ParsedAction.MeshPath = MeshPath;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
-                            {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString MeshPath;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("meshPath"), MeshPath) || MeshPath.IsEmpty())
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::SetComponentStaticMesh;
+                                ParsedAction.ComponentName = ComponentName;
+                                ParsedAction.MeshPath = MeshPath;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
 
-                        if (Command == TEXT("scene.setActorFolder"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FString FolderPath;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("folderPath"), FolderPath))
-                            {
-                                FolderPath = TEXT("");
-                            }
-
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::SetActorFolder;
-                            ParsedAction.FolderPath = FolderPath;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                            if (Command == TEXT("scene.setActorFolder"))
                             {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                FString FolderPath;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("folderPath"), FolderPath))
+                                {
+                                    FolderPath = TEXT("");
+                                }
 
-                        if (Command == TEXT("scene.addActorLabelPrefix"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
-                                continue;
-                            }
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::SetActorFolder;
+                                ParsedAction.FolderPath = FolderPath;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
 
-                            FString Prefix;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("prefix"), Prefix) || Prefix.IsEmpty())
-                            {
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::AddActorLabelPrefix;
-                            ParsedAction.LabelPrefix = Prefix;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
-                            {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                            if (Command == TEXT("scene.addActorLabelPrefix"))
                             {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                                FString Prefix;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("prefix"), Prefix) || Prefix.IsEmpty())
+                                {
+                                    continue;
+                                }
 
-                        if (Command == TEXT("scene.duplicateActors"))
-                        {
-                            FString Target;
-                            if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
-                            {
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::AddActorLabelPrefix;
+                                ParsedAction.LabelPrefix = Prefix;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
+
+                                ReceivedActions.Add(ParsedAction);
                                 continue;
                             }
 
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::DuplicateActors;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                            if (Command == TEXT("scene.duplicateActors"))
                             {
-                                ParsedAction.ActorNames = SelectedActors;
-                            }
-                            else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
-                            {
-                                if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                FString Target;
+                                if (!(*ParamsObj)->TryGetStringField(TEXT("target"), Target))
                                 {
                                     continue;
                                 }
-                            }
-                            else
-                            {
-                                continue;
-                            }
 
-                            double CountValue = 1.0;
-                            if ((*ParamsObj)->TryGetNumberField(TEXT("count"), CountValue))
-                            {
-                                ParsedAction.DuplicateCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(CountValue)), 1, 20);
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::DuplicateActors;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                if (Target.Equals(TEXT("selection"), ESearchCase::IgnoreCase))
+                                {
+                                    ParsedAction.ActorNames = SelectedActors;
+                                }
+                                else if (Target.Equals(TEXT("byName"), ESearchCase::IgnoreCase))
+                                {
+                                    if (!ParseActorNamesField(*ParamsObj, ParsedAction.ActorNames))
+                                    {
+                                        continue;
+                                    }
+                                }
+                                else
+                                {
+                                    continue;
+                                }
+
+                                double CountValue = 1.0;
+                                if ((*ParamsObj)->TryGetNumberField(TEXT("count"), CountValue))
+                                {
+                                    ParsedAction.DuplicateCount = FMath::Clamp(FMath::RoundToInt(static_cast<float>(CountValue)), 1, 20);
+                                }
+                                (*ParamsObj)->TryGetBoolField(TEXT("instanced"), ParsedAction.bDuplicateInstanced);
+
+                                const TSharedPtr<FJsonObject>* OffsetObj = nullptr;
+                                if ((*ParamsObj)->TryGetObjectField(TEXT("offset"), OffsetObj) && OffsetObj && OffsetObj->IsValid())
+                                {
+                                    double X = 0.0;
+                                    double Y = 0.0;
+                                    double Z = 0.0;
+                                    if ((*OffsetObj)->TryGetNumberField(TEXT("x"), X) &&
+                                        (*OffsetObj)->TryGetNumberField(TEXT("y"), Y) &&
+                                        (*OffsetObj)->TryGetNumberField(TEXT("z"), Z))
+                                    {
+                                        ParsedAction.DuplicateOffset = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                    }
+                                }
+
+                                ReceivedActions.Add(ParsedAction);
+                                continue;
                             }
 
-                            const TSharedPtr<FJsonObject>* OffsetObj = nullptr;
-                            if ((*ParamsObj)->TryGetObjectField(TEXT("offset"), OffsetObj) && OffsetObj && OffsetObj->IsValid())
+                            if (Command == TEXT("session.beginTransaction"))
                             {
-                                double X = 0.0;
-                                double Y = 0.0;
-                                double Z = 0.0;
-                                if ((*OffsetObj)->TryGetNumberField(TEXT("x"), X) &&
-                                    (*OffsetObj)->TryGetNumberField(TEXT("y"), Y) &&
-                                    (*OffsetObj)->TryGetNumberField(TEXT("z"), Z))
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::SessionBeginTransaction;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                FString Description;
+                                if ((*ParamsObj)->TryGetStringField(TEXT("description"), Description))
                                 {
-                                    ParsedAction.DuplicateOffset = FVector(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z));
+                                    ParsedAction.TransactionDescription = Description;
                                 }
+                                ReceivedActions.Add(ParsedAction);
+                                continue;
                             }
 
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
-
-                        if (Command == TEXT("session.beginTransaction"))
-                        {
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::SessionBeginTransaction;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            FString Description;
-                            if ((*ParamsObj)->TryGetStringField(TEXT("description"), Description))
+                            if (Command == TEXT("session.commitTransaction"))
                             {
-                                ParsedAction.TransactionDescription = Description;
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::SessionCommitTransaction;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                ReceivedActions.Add(ParsedAction);
+                                continue;
                             }
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
 
-                        if (Command == TEXT("session.commitTransaction"))
-                        {
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::SessionCommitTransaction;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            PlannedActions.Add(ParsedAction);
-                            continue;
+                            if (Command == TEXT("session.rollbackTransaction"))
+                            {
+                                FUEAIAgentPlannedSceneAction ParsedAction;
+                                ParsedAction.Type = EUEAIAgentPlannedActionType::SessionRollbackTransaction;
+                                ParsedAction.Risk = ParseRiskLevel(ActionObj);
+                                ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
+                                ReceivedActions.Add(ParsedAction);
+                                continue;
+                            }
                         }
+                    }
 
-                        if (Command == TEXT("session.rollbackTransaction"))
-                        {
-                            FUEAIAgentPlannedSceneAction ParsedAction;
-                            ParsedAction.Type = EUEAIAgentPlannedActionType::SessionRollbackTransaction;
-                            ParsedAction.Risk = ParseRiskLevel(ActionObj);
-                            ParsedAction.bApproved = ParsedAction.Risk == EUEAIAgentRiskLevel::Low;
-                            PlannedActions.Add(ParsedAction);
-                            continue;
-                        }
+                    PlannedActions.Set(MoveTemp(ReceivedActions));
+                    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+                    if (Actions->Num() > 0)
+                    {
+                        PlannedActionsReceived.Broadcast(*Actions);
                     }
-                }
 
-                FString AssistantText;
-                ResponseJson->TryGetStringField(TEXT("assistantText"), AssistantText);
+                    const FString& AssistantText = Parsed.AssistantText;
 
-                FString FinalMessage;
-                if (!AssistantText.IsEmpty())
-                {
-                    FinalMessage = AssistantText;
-                }
-                else if (PlannedActions.Num() > 0)
-                {
-                    FinalMessage = LastPlanSummary;
-                    if (FinalMessage.IsEmpty())
+                    FString FinalMessage;
+                    if (!AssistantText.IsEmpty())
                     {
-                        FinalMessage = FString::Printf(TEXT("Needs approval: %d action(s)"), PlannedActions.Num());
+                        FinalMessage = AssistantText;
                     }
-                }
-                else
-                {
-                    FinalMessage = Summary;
-                    const int32 MaxSteps = FMath::Min(3, Steps.Num());
-                    for (int32 StepIndex = 0; StepIndex < MaxSteps; ++StepIndex)
+                    else if (Actions->Num() > 0)
                     {
+                        FinalMessage = LastPlanSummary;
                         if (FinalMessage.IsEmpty())
                         {
-                            FinalMessage = Steps[StepIndex];
-                        }
-                        else
-                        {
-                            FinalMessage += TEXT("\n");
-                            FinalMessage += Steps[StepIndex];
+                            FinalMessage = FString::Printf(TEXT("Needs approval: %d action(s)"), Actions->Num());
                         }
                     }
-                    if (FinalMessage.IsEmpty())
+                    else
                     {
-                        FinalMessage = TEXT("No action needed.");
+                        FinalMessage = Summary;
+                        const int32 MaxSteps = FMath::Min(3, Steps.Num());
+                        for (int32 StepIndex = 0; StepIndex < MaxSteps; ++StepIndex)
+                        {
+                            if (FinalMessage.IsEmpty())
+                            {
+                                FinalMessage = Steps[StepIndex];
+                            }
+                            else
+                            {
+                                FinalMessage += TEXT("\n");
+                                FinalMessage += Steps[StepIndex];
+                            }
+                        }
+                        if (FinalMessage.IsEmpty())
+                        {
+                            FinalMessage = TEXT("No action needed.");
+                        }
                     }
-                }
-                Callback.ExecuteIfBound(true, FinalMessage);
-            });
+                    Callback.ExecuteIfBound(true, FinalMessage);
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 bool FUEAIAgentTransportModule::ParseSessionDecision(
@@ -1926,7 +1997,7 @@ bool FUEAIAgentTransportModule::ParseSessionDecision(
 
     ActiveSessionId = SessionId;
     ActiveSessionActionIndex = INDEX_NONE;
-    PlannedActions.Empty();
+    TArray<FUEAIAgentPlannedSceneAction> ReceivedActions;
 
     FString Status;
     (*DecisionObj)->TryGetStringField(TEXT("status"), Status);
@@ -1935,6 +2006,13 @@ bool FUEAIAgentTransportModule::ParseSessionDecision(
     FString Message;
     (*DecisionObj)->TryGetStringField(TEXT("message"), Message);
 
+    ActiveSessionStopCondition.Empty();
+    const TSharedPtr<FJsonObject>* StopConditionObj = nullptr;
+    if ((*DecisionObj)->TryGetObjectField(TEXT("matchedStopCondition"), StopConditionObj) && StopConditionObj && StopConditionObj->IsValid())
+    {
+        (*StopConditionObj)->TryGetStringField(TEXT("type"), ActiveSessionStopCondition);
+    }
+
     double ActionIndex = -1.0;
     (*DecisionObj)->TryGetNumberField(TEXT("nextActionIndex"), ActionIndex);
     ActiveSessionActionIndex = ActionIndex >= 0.0 ? FMath::TruncToInt(ActionIndex) : INDEX_NONE;
@@ -1980,11 +2058,18 @@ bool FUEAIAgentTransportModule::ParseSessionDecision(
                 {
                     ParsedAction.AttemptCount = FMath::Max(0, FMath::RoundToInt(static_cast<float>(Attempts)));
                 }
-                PlannedActions.Add(ParsedAction);
+                ReceivedActions.Add(ParsedAction);
             }
         }
     }
 
+    PlannedActions.Set(MoveTemp(ReceivedActions));
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    if (Actions->Num() > 0)
+    {
+        PlannedActionsReceived.Broadcast(*Actions);
+    }
+
     OutMessage = FString::Printf(
         TEXT("Session: %s\n%s\n%s"),
         *Status,
@@ -2000,6 +2085,33 @@ bool FUEAIAgentTransportModule::ParseSessionDecision(
     return true;
 }
 
+TSharedRef<FJsonObject> FUEAIAgentTransportModule::BuildSceneDelta() const
+{
+    FUEAIAgentSceneSnapshot& Snapshot = FUEAIAgentSceneSnapshot::Get();
+    Snapshot.Refresh();
+    return Snapshot.BuildDelta(AcknowledgedSnapshotId, AcknowledgedSnapshotVersion);
+}
+
+void FUEAIAgentTransportModule::ApplySceneAck(const FUEAIAgentSceneAck& Ack) const
+{
+    // Version 0 means Agent Core lost its copy and wants the next request to carry a full snapshot.
+    if (Ack.Version == 0)
+    {
+        AcknowledgedSnapshotVersion = 0;
+        return;
+    }
+
+    // Responses can arrive out of order; never move the base backwards within one snapshot.
+    if (Ack.SnapshotId == AcknowledgedSnapshotId && Ack.Version <= AcknowledgedSnapshotVersion)
+    {
+        return;
+    }
+
+    AcknowledgedSnapshotId = Ack.SnapshotId;
+    AcknowledgedSnapshotVersion = Ack.Version;
+    FUEAIAgentSceneSnapshot::Get().Acknowledge(Ack.SnapshotId, Ack.Version);
+}
+
 void FUEAIAgentTransportModule::StartSession(
     const FString& Prompt,
     const FString& Mode,
@@ -2008,71 +2120,64 @@ void FUEAIAgentTransportModule::StartSession(
     const FString& Model,
     const FOnUEAIAgentSessionUpdated& Callback) const
 {
-    PlannedActions.Empty();
+    PlannedActions.Reset();
     LastPlanSummary.Empty();
     ActiveSessionId.Empty();
     ActiveSessionActionIndex = INDEX_NONE;
+    ActiveSessionStopCondition.Empty();
     ActiveSessionSelectedActors = SelectedActors;
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("prompt"), Prompt);
-    Root->SetStringField(TEXT("mode"), Mode.IsEmpty() ? TEXT("agent") : Mode);
-    Root->SetNumberField(TEXT("maxRetries"), 2);
-    Root->SetObjectField(TEXT("context"), BuildContextObject(SelectedActors));
-    if (!Provider.IsEmpty())
-    {
-        Root->SetStringField(TEXT("provider"), Provider);
-    }
-    if (!Model.IsEmpty())
-    {
-        Root->SetStringField(TEXT("model"), Model);
-    }
-    if (!ActiveChatId.IsEmpty())
-    {
-        Root->SetStringField(TEXT("chatId"), ActiveChatId);
-    }
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildSessionStartUrl());
-    Request->SetVerb(TEXT("POST"));
+    FUEAIAgentRequestBody Body(ContextBodyReserveBytes);
+    Body->WriteValue(TEXT("prompt"), Prompt);
+    Body->WriteValue(TEXT("mode"), Mode.IsEmpty() ? TEXT("agent") : Mode);
+    Body->WriteValue(TEXT("maxRetries"), 2);
+    WriteContextObject(Body, SelectedActors);
+    Body.WriteJsonObject(TEXT("sceneDelta"), BuildSceneDelta());
+    Body.WriteStringIfNotEmpty(TEXT("provider"), Provider);
+    Body.WriteStringIfNotEmpty(TEXT("model"), Model);
+    Body.WriteStringIfNotEmpty(TEXT("chatId"), ActiveChatId);
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildSessionStartUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback, SelectedActors](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, SelectedActors, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, SelectedActors, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Session start response is not valid JSON."));
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Session start response is not valid JSON."));
+                        return;
+                    }
 
-                FString ParsedMessage;
-                const bool bParsed = ParseSessionDecision(ResponseJson, SelectedActors, ParsedMessage);
-                Callback.ExecuteIfBound(bParsed, ParsedMessage);
-            });
+                    FUEAIAgentSceneAck SceneAck;
+                    if (FUEAIAgentResponseParser::ReadSceneAck(ResponseJson, SceneAck))
+                    {
+                        ApplySceneAck(SceneAck);
+                    }
+
+                    FString ParsedMessage;
+                    const bool bParsed = ParseSessionDecision(ResponseJson, SelectedActors, ParsedMessage);
+                    Callback.ExecuteIfBound(bParsed, ParsedMessage);
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::NextSession(
-    bool bHasResult,
-    bool bResultOk,
-    const FString& ResultMessage,
+    const FUEAIAgentToolResult* Result,
     const FOnUEAIAgentSessionUpdated& Callback) const
 {
     if (ActiveSessionId.IsEmpty())
@@ -2081,14 +2186,11 @@ void FUEAIAgentTransportModule::NextSession(
         return;
     }
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("sessionId"), ActiveSessionId);
-    if (!ActiveChatId.IsEmpty())
-    {
-        Root->SetStringField(TEXT("chatId"), ActiveChatId);
-    }
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("sessionId"), ActiveSessionId);
+    Body.WriteStringIfNotEmpty(TEXT("chatId"), ActiveChatId);
 
-    if (bHasResult)
+    if (Result)
     {
         if (ActiveSessionActionIndex == INDEX_NONE)
         {
@@ -2097,51 +2199,20 @@ void FUEAIAgentTransportModule::NextSession(
         }
 
         const int32 CurrentAttempts = GetPlannedActionAttemptCount(ActiveSessionActionIndex);
-        UpdateActionResult(ActiveSessionActionIndex, bResultOk, CurrentAttempts + 1);
+        UpdateActionResult(ActiveSessionActionIndex, Result->bOk, CurrentAttempts + 1);
 
-        TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
-        Result->SetNumberField(TEXT("actionIndex"), ActiveSessionActionIndex);
-        Result->SetBoolField(TEXT("ok"), bResultOk);
-        Result->SetStringField(TEXT("message"), ResultMessage);
-        Root->SetObjectField(TEXT("result"), Result);
+        TSharedRef<FJsonObject> ResultObj = Result->ToJson();
+        ResultObj->SetNumberField(TEXT("actionIndex"), ActiveSessionActionIndex);
+        Body.WriteJsonObject(TEXT("result"), ResultObj);
     }
 
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildSessionNextUrl());
-    Request->SetVerb(TEXT("POST"));
-    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
-    Request->OnProcessRequestComplete().BindLambda(
-        [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
-        {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Session next response is not valid JSON."));
-                    return;
-                }
-
-                FString ParsedMessage;
-                const bool bParsed = ParseSessionDecision(ResponseJson, ActiveSessionSelectedActors, ParsedMessage);
-                Callback.ExecuteIfBound(bParsed, ParsedMessage);
-            });
-        });
-
-    Request->ProcessRequest();
-}
+    SendSessionStep(
+        TEXT("session.next"),
+        BuildSessionNextUrl(),
+        Body,
+        TEXT("Session next response is not valid JSON."),
+        Callback);
+}
 
 void FUEAIAgentTransportModule::ApproveCurrentSessionAction(
     bool bApproved,
@@ -2153,102 +2224,253 @@ void FUEAIAgentTransportModule::ApproveCurrentSessionAction(
         return;
     }
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("sessionId"), ActiveSessionId);
-    Root->SetNumberField(TEXT("actionIndex"), ActiveSessionActionIndex);
-    Root->SetBoolField(TEXT("approved"), bApproved);
-    if (!ActiveChatId.IsEmpty())
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("sessionId"), ActiveSessionId);
+    Body->WriteValue(TEXT("actionIndex"), ActiveSessionActionIndex);
+    Body->WriteValue(TEXT("approved"), bApproved);
+    Body.WriteStringIfNotEmpty(TEXT("chatId"), ActiveChatId);
+
+    SendSessionStep(
+        TEXT("session.approve"),
+        BuildSessionApproveUrl(),
+        Body,
+        TEXT("Session approve response is not valid JSON."),
+        Callback);
+}
+
+void FUEAIAgentTransportModule::ResumeSession(const FOnUEAIAgentSessionUpdated& Callback) const
+{
+    if (ActiveSessionId.IsEmpty())
     {
-        Root->SetStringField(TEXT("chatId"), ActiveChatId);
+        Callback.ExecuteIfBound(false, TEXT("No active session."));
+        return;
     }
 
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("sessionId"), ActiveSessionId);
+    Body.WriteStringIfNotEmpty(TEXT("chatId"), ActiveChatId);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildSessionApproveUrl());
-    Request->SetVerb(TEXT("POST"));
+    SendSessionStep(
+        TEXT("session.resume"),
+        BuildSessionResumeUrl(),
+        Body,
+        TEXT("Session resume response is not valid JSON."),
+        Callback);
+}
+
+void FUEAIAgentTransportModule::SendSessionStep(
+    const TCHAR* ChannelType,
+    const FString& Url,
+    FUEAIAgentRequestBody& Body,
+    const TCHAR* InvalidJsonMessage,
+    const FOnUEAIAgentSessionUpdated& Callback) const
+{
+    const double StartSeconds = FPlatformTime::Seconds();
+    const FString ChannelRoute = FString::Printf(TEXT("WS %s"), ChannelType);
+    const bool bSentOverChannel = EventChannel.IsValid() && EventChannel->SendRequest(
+        ChannelType,
+        Body,
+        [this, Callback, ChannelRoute, StartSeconds, Url, InvalidJsonMessage](TSharedPtr<FJsonObject>&& ResponseJson, TArray<uint8>&& Payload)
+        {
+            CoreClient->RecordLatency(ChannelRoute, (FPlatformTime::Seconds() - StartSeconds) * 1000.0, ResponseJson.IsValid());
+            if (!ResponseJson.IsValid())
+            {
+                // Retry over HTTP, which ignores the channel's type and id fields. Agent Core refuses a
+                // result for an action that already finished, so a step it did receive is not applied twice.
+                PostSessionStep(Url, MoveTemp(Payload), InvalidJsonMessage, Callback);
+                return;
+            }
+
+            FString ParsedMessage;
+            const bool bParsed = ParseSessionDecision(ResponseJson, ActiveSessionSelectedActors, ParsedMessage);
+            Callback.ExecuteIfBound(bParsed, ParsedMessage);
+        });
+    if (!bSentOverChannel)
+    {
+        PostSessionStep(Url, Body.Finish(), InvalidJsonMessage, Callback);
+    }
+}
+
+void FUEAIAgentTransportModule::PostSessionStep(
+    const FString& Url,
+    TArray<uint8>&& Payload,
+    const TCHAR* InvalidJsonMessage,
+    const FOnUEAIAgentSessionUpdated& Callback) const
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), Url);
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Request->SetContent(MoveTemp(Payload));
     Request->OnProcessRequestComplete().BindLambda(
-        [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+        [this, Callback, InvalidJsonMessage](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, InvalidJsonMessage, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Session approve response is not valid JSON."));
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, InvalidJsonMessage);
+                        return;
+                    }
 
-                FString ParsedMessage;
-                const bool bParsed = ParseSessionDecision(ResponseJson, ActiveSessionSelectedActors, ParsedMessage);
-                Callback.ExecuteIfBound(bParsed, ParsedMessage);
-            });
+                    FString ParsedMessage;
+                    const bool bParsed = ParseSessionDecision(ResponseJson, ActiveSessionSelectedActors, ParsedMessage);
+                    Callback.ExecuteIfBound(bParsed, ParsedMessage);
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
-void FUEAIAgentTransportModule::ResumeSession(const FOnUEAIAgentSessionUpdated& Callback) const
+void FUEAIAgentTransportModule::ConnectEventChannel() const
 {
-    if (ActiveSessionId.IsEmpty())
+    if (EventChannel.IsValid())
     {
-        Callback.ExecuteIfBound(false, TEXT("No active session."));
-        return;
+        EventChannel->Connect(BuildEventsUrl());
     }
+}
+
+bool FUEAIAgentTransportModule::IsEventChannelConnected() const
+{
+    return EventChannel.IsValid() && EventChannel->IsConnected();
+}
+
+FOnUEAIAgentHealthChanged& FUEAIAgentTransportModule::OnHealthChanged() const
+{
+    return HealthChanged;
+}
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("sessionId"), ActiveSessionId);
-    if (!ActiveChatId.IsEmpty())
+FOnUEAIAgentChatsChanged& FUEAIAgentTransportModule::OnChatsChanged() const
+{
+    return ChatsChanged;
+}
+
+void FUEAIAgentTransportModule::HandleChannelConnectionChanged(bool bConnected) const
+{
+    // A connected channel reports health through its first "health" event.
+    if (!bConnected)
     {
-        Root->SetStringField(TEXT("chatId"), ActiveChatId);
+        HealthChanged.Broadcast(false, TEXT("Agent Core is not reachable."));
     }
+}
 
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+void FUEAIAgentTransportModule::HandleChannelEvent(const FString& Type, const TSharedPtr<FJsonObject>& Event) const
+{
+    if (Type == TEXT("health"))
+    {
+        FString Message;
+        const bool bHealthy = ReadHealthStatus(Event, Message);
+        HealthChanged.Broadcast(bHealthy, Message);
+        return;
+    }
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildSessionResumeUrl());
-    Request->SetVerb(TEXT("POST"));
-    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
-    Request->OnProcessRequestComplete().BindLambda(
-        [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+    if (Type == TEXT("chat.updated"))
+    {
+        const TSharedPtr<FJsonObject>* ChatObj = nullptr;
+        FUEAIAgentChatSummary Chat;
+        if (!Event->TryGetObjectField(TEXT("chat"), ChatObj) || !ChatObj || !ReadChatSummaryObject(*ChatObj, Chat))
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
+            return;
+        }
+
+        // Same filter as the HTTP list: archived chats only appear when the list includes them.
+        const bool bListed = bChatsIncludeArchived || !Chat.bArchived;
+        const FString ChatId = Chat.Id;
+        Chats.Update([&Chat, bListed](TArray<FUEAIAgentChatSummary>& Items)
+        {
+            const int32 ExistingIndex = Items.IndexOfByPredicate([&Chat](const FUEAIAgentChatSummary& Item)
             {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                return Item.Id == Chat.Id;
+            });
+            if (!bListed)
+            {
+                if (ExistingIndex != INDEX_NONE)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
+                    Items.RemoveAt(ExistingIndex);
                 }
+            }
+            else if (ExistingIndex != INDEX_NONE)
+            {
+                Items[ExistingIndex] = MoveTemp(Chat);
+            }
+            else
+            {
+                Items.Insert(MoveTemp(Chat), 0);
+            }
+        });
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Session resume response is not valid JSON."));
-                    return;
-                }
+        if (!bListed && ActiveChatId == ChatId)
+        {
+            SetActiveChatId(FString());
+            ActiveChatHistory.Reset();
+        }
+        ChatsChanged.Broadcast();
+        return;
+    }
+
+    if (Type == TEXT("context.query"))
+    {
+        AnswerContextQuery(Event);
+        return;
+    }
+
+    if (Type == TEXT("chat.deleted"))
+    {
+        FString ChatId;
+        if (!Event->TryGetStringField(TEXT("chatId"), ChatId) || ChatId.IsEmpty())
+        {
+            return;
+        }
 
-                FString ParsedMessage;
-                const bool bParsed = ParseSessionDecision(ResponseJson, ActiveSessionSelectedActors, ParsedMessage);
-                Callback.ExecuteIfBound(bParsed, ParsedMessage);
+        if (ActiveChatId == ChatId)
+        {
+            SetActiveChatId(FString());
+            ActiveChatHistory.Reset();
+        }
+        ChatHistoryCaches.Remove(ChatId);
+        Chats.Update([&ChatId](TArray<FUEAIAgentChatSummary>& Items)
+        {
+            Items.RemoveAll([&ChatId](const FUEAIAgentChatSummary& Existing)
+            {
+                return Existing.Id == ChatId;
             });
         });
+        ChatsChanged.Broadcast();
+    }
+}
+
+void FUEAIAgentTransportModule::AnswerContextQuery(const TSharedPtr<FJsonObject>& Query) const
+{
+    int32 RequestId = 0;
+    if (!EventChannel.IsValid() || !Query->TryGetNumberField(TEXT("id"), RequestId))
+    {
+        return;
+    }
+
+    FString Command;
+    Query->TryGetStringField(TEXT("command"), Command);
+    const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+    Query->TryGetObjectField(TEXT("params"), ParamsObj);
 
-    Request->ProcessRequest();
+    // Results are written straight into the reply; on failure only ok and message are sent.
+    FUEAIAgentRequestBody Reply(ContextReplyReserveBytes);
+    FString Message;
+    const bool bOk = FUEAIAgentContextCommands::Execute(
+        Command,
+        ParamsObj ? *ParamsObj : TSharedPtr<FJsonObject>(),
+        Reply.GetSharedWriter(),
+        Message);
+    Reply->WriteValue(TEXT("ok"), bOk);
+    Reply->WriteValue(TEXT("message"), Message);
+    EventChannel->SendReply(TEXT("context.result"), RequestId, Reply);
 }
 
 void FUEAIAgentTransportModule::SetProviderApiKey(
@@ -2256,19 +2478,13 @@ void FUEAIAgentTransportModule::SetProviderApiKey(
     const FString& ApiKey,
     const FOnUEAIAgentCredentialOpFinished& Callback) const
 {
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("provider"), Provider);
-    Root->SetStringField(TEXT("apiKey"), ApiKey);
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("provider"), Provider);
+    Body->WriteValue(TEXT("apiKey"), ApiKey);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildCredentialsSetUrl());
-    Request->SetVerb(TEXT("POST"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildCredentialsSetUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
@@ -2290,25 +2506,19 @@ void FUEAIAgentTransportModule::SetProviderApiKey(
             });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::DeleteProviderApiKey(
     const FString& Provider,
     const FOnUEAIAgentCredentialOpFinished& Callback) const
 {
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("provider"), Provider);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("provider"), Provider);
 
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildCredentialsDeleteUrl());
-    Request->SetVerb(TEXT("POST"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildCredentialsDeleteUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
@@ -2330,132 +2540,128 @@ void FUEAIAgentTransportModule::DeleteProviderApiKey(
             });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::TestProviderApiKey(
     const FString& Provider,
     const FOnUEAIAgentCredentialOpFinished& Callback) const
 {
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("provider"), Provider);
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("provider"), Provider);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildCredentialsTestUrl());
-    Request->SetVerb(TEXT("POST"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildCredentialsTestUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Test key failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Test key failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Test response is not valid JSON."));
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Test response is not valid JSON."));
+                        return;
+                    }
 
-                bool bOk = false;
-                ResponseJson->TryGetBoolField(TEXT("ok"), bOk);
-                FString Message = bOk ? TEXT("Provider call succeeded.") : TEXT("Provider call failed.");
-                ResponseJson->TryGetStringField(TEXT("message"), Message);
-                Callback.ExecuteIfBound(bOk, Message);
-            });
+                    bool bOk = false;
+                    ResponseJson->TryGetBoolField(TEXT("ok"), bOk);
+                    FString Message = bOk ? TEXT("Provider call succeeded.") : TEXT("Provider call failed.");
+                    ResponseJson->TryGetStringField(TEXT("message"), Message);
+                    Callback.ExecuteIfBound(bOk, Message);
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::GetProviderStatus(const FOnUEAIAgentCredentialOpFinished& Callback) const
 {
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildProviderStatusUrl());
-    Request->SetVerb(TEXT("GET"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("GET"), BuildProviderStatusUrl());
     Request->OnProcessRequestComplete().BindLambda(
         [Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Provider status failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
-
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Provider status response is not valid JSON."));
-                    return;
-                }
-
-                const TSharedPtr<FJsonObject>* ProvidersObj = nullptr;
-                if (!ResponseJson->TryGetObjectField(TEXT("providers"), ProvidersObj) || !ProvidersObj || !ProvidersObj->IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Provider status misses providers object."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                auto BuildLine = [ProvidersObj](const FString& ProviderName) -> FString
-                {
-                    const TSharedPtr<FJsonObject>* ProviderObj = nullptr;
-                    if (!(*ProvidersObj)->TryGetObjectField(ProviderName, ProviderObj) || !ProviderObj || !ProviderObj->IsValid())
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
                     {
-                        return FString::Printf(TEXT("%s: unknown"), *ProviderName);
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Provider status failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
                     }
 
-                    bool bConfigured = false;
-                    (*ProviderObj)->TryGetBoolField(TEXT("configured"), bConfigured);
-                    FString Model;
-                    (*ProviderObj)->TryGetStringField(TEXT("model"), Model);
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Provider status response is not valid JSON."));
+                        return;
+                    }
 
-                    if (Model.IsEmpty())
+                    const TSharedPtr<FJsonObject>* ProvidersObj = nullptr;
+                    if (!ResponseJson->TryGetObjectField(TEXT("providers"), ProvidersObj) || !ProvidersObj || !ProvidersObj->IsValid())
                     {
-                        return FString::Printf(TEXT("%s: %s"), *ProviderName, bConfigured ? TEXT("configured") : TEXT("not configured"));
+                        Callback.ExecuteIfBound(false, TEXT("Provider status misses providers object."));
+                        return;
                     }
 
-                    return FString::Printf(
-                        TEXT("%s: %s (%s)"),
-                        *ProviderName,
-                        bConfigured ? TEXT("configured") : TEXT("not configured"),
-                        *Model);
-                };
+                    auto BuildLine = [ProvidersObj](const FString& ProviderName) -> FString
+                    {
+                        const TSharedPtr<FJsonObject>* ProviderObj = nullptr;
+                        if (!(*ProvidersObj)->TryGetObjectField(ProviderName, ProviderObj) || !ProviderObj || !ProviderObj->IsValid())
+                        {
+                            return FString::Printf(TEXT("%s: unknown"), *ProviderName);
+                        }
 
-                const FString Message =
-                    BuildLine(TEXT("openai")) + TEXT("\n") +
-                    BuildLine(TEXT("gemini")) + TEXT("\n") +
-                    BuildLine(TEXT("local"));
-                Callback.ExecuteIfBound(true, Message);
-            });
+                        bool bConfigured = false;
+                        (*ProviderObj)->TryGetBoolField(TEXT("configured"), bConfigured);
+                        FString Model;
+                        (*ProviderObj)->TryGetStringField(TEXT("model"), Model);
+
+                        if (Model.IsEmpty())
+                        {
+                            return FString::Printf(TEXT("%s: %s"), *ProviderName, bConfigured ? TEXT("configured") : TEXT("not configured"));
+                        }
+
+                        return FString::Printf(
+                            TEXT("%s: %s (%s)"),
+                            *ProviderName,
+                            bConfigured ? TEXT("configured") : TEXT("not configured"),
+                            *Model);
+                    };
+
+                    const FString Message =
+                        BuildLine(TEXT("openai")) + TEXT("\n") +
+                        BuildLine(TEXT("gemini")) + TEXT("\n") +
+                        BuildLine(TEXT("local"));
+                    Callback.ExecuteIfBound(true, Message);
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::RefreshModelOptions(
@@ -2463,370 +2669,363 @@ void FUEAIAgentTransportModule::RefreshModelOptions(
     const FOnUEAIAgentCredentialOpFinished& Callback) const
 {
     const FString ProviderValue = Provider;
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildModelsUrl(ProviderValue));
-    Request->SetVerb(TEXT("GET"));
+    const FString Url = BuildModelsUrl(ProviderValue);
+    uint64 Generation = 0;
+    if (!ModelsRequest.Begin(Url, Callback, Generation))
+    {
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("GET"), Url);
     Request->OnProcessRequestComplete().BindLambda(
-        [this, Callback, ProviderValue](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+        [this, Generation, ProviderValue](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, ProviderValue, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Generation, ProviderValue, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!ModelsRequest.IsCurrent(Generation))
+                    {
+                        return;
+                    }
 
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Load models failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        ModelsRequest.Finish(Generation, false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Model response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        ModelsRequest.Finish(Generation, false, FString::Printf(TEXT("Load models failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Model request failed.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        ModelsRequest.Finish(Generation, false, TEXT("Model response is not valid JSON."));
+                        return;
+                    }
 
-                AvailableModels.Empty();
-                PreferredModels.Empty();
+                    bool bOk = false;
+                    if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
+                    {
+                        FString ErrorMessage = TEXT("Model request failed.");
+                        ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
+                        ModelsRequest.Finish(Generation, false, ErrorMessage);
+                        return;
+                    }
 
-                const TArray<TSharedPtr<FJsonValue>>* AvailableArray = nullptr;
-                FString SelectedProvider;
-                ResponseJson->TryGetStringField(TEXT("provider"), SelectedProvider);
-                if (ResponseJson->TryGetArrayField(TEXT("models"), AvailableArray) && AvailableArray)
-                {
-                    for (const TSharedPtr<FJsonValue>& Value : *AvailableArray)
+                    TArray<FUEAIAgentModelOption> Available;
+                    TArray<FUEAIAgentModelOption> Preferred;
+
+                    const TArray<TSharedPtr<FJsonValue>>* AvailableArray = nullptr;
+                    FString SelectedProvider;
+                    ResponseJson->TryGetStringField(TEXT("provider"), SelectedProvider);
+                    if (ResponseJson->TryGetArrayField(TEXT("models"), AvailableArray) && AvailableArray)
                     {
-                        FString ModelName;
-                        if (!Value.IsValid() || !Value->TryGetString(ModelName) || ModelName.IsEmpty())
+                        for (const TSharedPtr<FJsonValue>& Value : *AvailableArray)
                         {
-                            continue;
-                        }
+                            FString ModelName;
+                            if (!Value.IsValid() || !Value->TryGetString(ModelName) || ModelName.IsEmpty())
+                            {
+                                continue;
+                            }
                             FUEAIAgentModelOption Option;
                             Option.Provider = SelectedProvider.IsEmpty() ? ProviderValue : SelectedProvider;
                             Option.Model = ModelName;
-                            AvailableModels.Add(Option);
+                            Available.Add(Option);
                         }
                     }
 
-                const TArray<TSharedPtr<FJsonValue>>* PreferredArray = nullptr;
-                if (ResponseJson->TryGetArrayField(TEXT("preferredModels"), PreferredArray) && PreferredArray)
-                {
-                    for (const TSharedPtr<FJsonValue>& Value : *PreferredArray)
+                    const TArray<TSharedPtr<FJsonValue>>* PreferredArray = nullptr;
+                    if (ResponseJson->TryGetArrayField(TEXT("preferredModels"), PreferredArray) && PreferredArray)
                     {
-                        const TSharedPtr<FJsonObject> ItemObj = Value.IsValid() ? Value->AsObject() : nullptr;
-                        if (!ItemObj.IsValid())
+                        for (const TSharedPtr<FJsonValue>& Value : *PreferredArray)
                         {
-                            continue;
-                        }
+                            const TSharedPtr<FJsonObject> ItemObj = Value.IsValid() ? Value->AsObject() : nullptr;
+                            if (!ItemObj.IsValid())
+                            {
+                                continue;
+                            }
 
-                        FString Provider;
-                        FString Model;
-                        if (!ItemObj->TryGetStringField(TEXT("provider"), Provider) ||
-                            !ItemObj->TryGetStringField(TEXT("model"), Model) ||
-                            Provider.IsEmpty() ||
-                            Model.IsEmpty())
-                        {
-                            continue;
-                        }
+                            FString Provider;
+                            FString Model;
+                            if (!ItemObj->TryGetStringField(TEXT("provider"), Provider) ||
+                                !ItemObj->TryGetStringField(TEXT("model"), Model) ||
+                                Provider.IsEmpty() ||
+                                Model.IsEmpty())
+                            {
+                                continue;
+                            }
 
-                        FUEAIAgentModelOption Option;
-                        Option.Provider = Provider;
-                        Option.Model = Model;
-                        PreferredModels.Add(Option);
+                            FUEAIAgentModelOption Option;
+                            Option.Provider = Provider;
+                            Option.Model = Model;
+                            Preferred.Add(Option);
+                        }
                     }
-                }
 
-                Callback.ExecuteIfBound(
-                    true,
-                    FString::Printf(TEXT("Models loaded: available %d, preferred %d"), AvailableModels.Num(), PreferredModels.Num()));
-            });
+                    const int32 AvailableCount = Available.Num();
+                    const int32 PreferredCount = Preferred.Num();
+                    AvailableModels.Set(MoveTemp(Available));
+                    PreferredModels.Set(MoveTemp(Preferred));
+                    ModelsRequest.Finish(Generation, true, FString::Printf(TEXT("Models loaded: available %d, preferred %d"), AvailableCount, PreferredCount));
+                });
         });
 
-    Request->ProcessRequest();
+    ModelsRequest.Track([Request]()
+    {
+        Request->CancelRequest();
+    });
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::SavePreferredModels(
     const TArray<FUEAIAgentModelOption>& Models,
     const FOnUEAIAgentCredentialOpFinished& Callback) const
 {
-    TArray<TSharedPtr<FJsonValue>> ModelValues;
+    FUEAIAgentRequestBody Body;
+    Body->WriteArrayStart(TEXT("models"));
     for (const FUEAIAgentModelOption& Item : Models)
     {
         if (Item.Provider.IsEmpty() || Item.Model.IsEmpty())
         {
             continue;
         }
-        TSharedRef<FJsonObject> Row = MakeShared<FJsonObject>();
-        Row->SetStringField(TEXT("provider"), Item.Provider);
-        Row->SetStringField(TEXT("model"), Item.Model);
-        ModelValues.Add(MakeShared<FJsonValueObject>(Row));
+        Body->WriteObjectStart();
+        Body->WriteValue(TEXT("provider"), Item.Provider);
+        Body->WriteValue(TEXT("model"), Item.Model);
+        Body->WriteObjectEnd();
     }
+    Body->WriteArrayEnd();
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetArrayField(TEXT("models"), ModelValues);
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildModelPreferencesUrl());
-    Request->SetVerb(TEXT("POST"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildModelPreferencesUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Save models failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Save models failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (FJsonSerializer::Deserialize(Reader, ResponseJson) && ResponseJson.IsValid())
-                {
-                    const TArray<TSharedPtr<FJsonValue>>* PreferredArray = nullptr;
-                    if (ResponseJson->TryGetArrayField(TEXT("preferredModels"), PreferredArray) && PreferredArray)
+                    if (bValidJson)
                     {
-                        PreferredModels.Empty();
-                        for (const TSharedPtr<FJsonValue>& Value : *PreferredArray)
+                        const TArray<TSharedPtr<FJsonValue>>* PreferredArray = nullptr;
+                        if (ResponseJson->TryGetArrayField(TEXT("preferredModels"), PreferredArray) && PreferredArray)
                         {
-                            const TSharedPtr<FJsonObject> ItemObj = Value.IsValid() ? Value->AsObject() : nullptr;
-                            if (!ItemObj.IsValid())
+                            TArray<FUEAIAgentModelOption> Preferred;
+                            for (const TSharedPtr<FJsonValue>& Value : *PreferredArray)
                             {
-                                continue;
-                            }
+                                const TSharedPtr<FJsonObject> ItemObj = Value.IsValid() ? Value->AsObject() : nullptr;
+                                if (!ItemObj.IsValid())
+                                {
+                                    continue;
+                                }
 
-                            FString Provider;
-                            FString Model;
-                            if (!ItemObj->TryGetStringField(TEXT("provider"), Provider) ||
-                                !ItemObj->TryGetStringField(TEXT("model"), Model) ||
-                                Provider.IsEmpty() ||
-                                Model.IsEmpty())
-                            {
-                                continue;
-                            }
+                                FString Provider;
+                                FString Model;
+                                if (!ItemObj->TryGetStringField(TEXT("provider"), Provider) ||
+                                    !ItemObj->TryGetStringField(TEXT("model"), Model) ||
+                                    Provider.IsEmpty() ||
+                                    Model.IsEmpty())
+                                {
+                                    continue;
+                                }
 
-                            FUEAIAgentModelOption Option;
-                            Option.Provider = Provider;
-                            Option.Model = Model;
-                            PreferredModels.Add(Option);
+                                FUEAIAgentModelOption Option;
+                                Option.Provider = Provider;
+                                Option.Model = Model;
+                                Preferred.Add(Option);
+                            }
+                            PreferredModels.Set(MoveTemp(Preferred));
                         }
                     }
-                }
 
-                Callback.ExecuteIfBound(true, TEXT("Preferred models saved."));
-            });
+                    Callback.ExecuteIfBound(true, TEXT("Preferred models saved."));
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::RefreshChats(bool bIncludeArchived, const FOnUEAIAgentChatOpFinished& Callback) const
 {
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatsUrl(bIncludeArchived));
-    Request->SetVerb(TEXT("GET"));
+    const FString Url = BuildChatsUrl(bIncludeArchived);
+    uint64 Generation = 0;
+    if (!ChatsRequest.Begin(Url, Callback, Generation))
+    {
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("GET"), Url);
     Request->OnProcessRequestComplete().BindLambda(
-        [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+        [this, Generation, bIncludeArchived](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseChatList,
+                [this, Generation, bIncludeArchived, HttpResponse, bConnectedSuccessfully](bool bValidJson, FUEAIAgentChatListResponse&& Parsed)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!ChatsRequest.IsCurrent(Generation))
+                    {
+                        return;
+                    }
 
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Chat list failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        ChatsRequest.Finish(Generation, false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Chat list response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        ChatsRequest.Finish(Generation, false, FString::Printf(TEXT("Chat list failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned a chat list error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        ChatsRequest.Finish(Generation, false, TEXT("Chat list response is not valid JSON."));
+                        return;
+                    }
 
-                Chats.Empty();
-                const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
-                if (ResponseJson->TryGetArrayField(TEXT("chats"), Items) && Items)
-                {
-                    for (const TSharedPtr<FJsonValue>& Value : *Items)
+                    if (!Parsed.bOk)
                     {
-                        if (!Value.IsValid())
-                        {
-                            continue;
-                        }
+                        ChatsRequest.Finish(Generation, false, Parsed.Error.IsEmpty() ? TEXT("Agent Core returned a chat list error.") : Parsed.Error);
+                        return;
+                    }
 
-                        const TSharedPtr<FJsonObject> ChatObj = Value->AsObject();
-                        if (!ChatObj.IsValid())
-                        {
-                            continue;
-                        }
+                    Chats.Set(MoveTemp(Parsed.Chats));
+                    bChatsIncludeArchived = bIncludeArchived;
+                    const TSharedRef<const TArray<FUEAIAgentChatSummary>> LoadedChats = Chats.Get();
 
-                        FString Id;
-                        if (!ChatObj->TryGetStringField(TEXT("id"), Id) || Id.IsEmpty())
+                    if (!ActiveChatId.IsEmpty())
+                    {
+                        const bool bExists = LoadedChats->ContainsByPredicate([this](const FUEAIAgentChatSummary& Chat)
+                        {
+                            return Chat.Id == ActiveChatId;
+                        });
+                        if (!bExists)
                         {
-                            continue;
+                            SetActiveChatId(FString());
+                            ActiveChatHistory.Reset();
                         }
-
-                        FUEAIAgentChatSummary Chat;
-                        Chat.Id = Id;
-                        ChatObj->TryGetStringField(TEXT("title"), Chat.Title);
-                        ChatObj->TryGetBoolField(TEXT("archived"), Chat.bArchived);
-                        ChatObj->TryGetStringField(TEXT("lastActivityAt"), Chat.LastActivityAt);
-                        Chats.Add(Chat);
-                    }
-                }
-
-                if (!ActiveChatId.IsEmpty())
-                {
-                    const bool bExists = Chats.ContainsByPredicate([this](const FUEAIAgentChatSummary& Chat)
-                    {
-                        return Chat.Id == ActiveChatId;
-                    });
-                    if (!bExists)
-                    {
-                        ActiveChatId.Empty();
-                        ActiveChatHistory.Empty();
                     }
-                }
 
-                Callback.ExecuteIfBound(true, FString::Printf(TEXT("Chats loaded: %d"), Chats.Num()));
-            });
+                    ChatsRequest.Finish(Generation, true, FString::Printf(TEXT("Chats loaded: %d"), LoadedChats->Num()));
+                });
         });
 
-    Request->ProcessRequest();
+    ChatsRequest.Track([Request]()
+    {
+        Request->CancelRequest();
+    });
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::CreateChat(const FString& Title, const FOnUEAIAgentChatOpFinished& Callback) const
 {
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    const FString TrimmedTitle = Title.TrimStartAndEnd();
-    if (!TrimmedTitle.IsEmpty())
-    {
-        Root->SetStringField(TEXT("title"), TrimmedTitle);
-    }
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+    FUEAIAgentRequestBody Body;
+    Body.WriteStringIfNotEmpty(TEXT("title"), Title.TrimStartAndEnd());
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildCreateChatUrl());
-    Request->SetVerb(TEXT("POST"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildCreateChatUrl());
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Create chat failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Create chat response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Create chat failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned a create chat error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Create chat response is not valid JSON."));
+                        return;
+                    }
 
-                const TSharedPtr<FJsonObject>* ChatObj = nullptr;
-                if (!ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) || !ChatObj || !ChatObj->IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Create chat response misses chat object."));
-                    return;
-                }
+                    bool bOk = false;
+                    if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
+                    {
+                        FString ErrorMessage = TEXT("Agent Core returned a create chat error.");
+                        ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
+                        Callback.ExecuteIfBound(false, ErrorMessage);
+                        return;
+                    }
 
-                FString NewChatId;
-                (*ChatObj)->TryGetStringField(TEXT("id"), NewChatId);
-                FString NewTitle;
-                (*ChatObj)->TryGetStringField(TEXT("title"), NewTitle);
-                bool bArchived = false;
-                (*ChatObj)->TryGetBoolField(TEXT("archived"), bArchived);
-                FString LastActivityAt;
-                (*ChatObj)->TryGetStringField(TEXT("lastActivityAt"), LastActivityAt);
-
-                ActiveChatId = NewChatId;
-                ActiveChatHistory.Empty();
-                if (!NewChatId.IsEmpty())
-                {
-                    Chats.RemoveAll([&NewChatId](const FUEAIAgentChatSummary& Existing)
+                    const TSharedPtr<FJsonObject>* ChatObj = nullptr;
+                    if (!ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) || !ChatObj || !ChatObj->IsValid())
                     {
-                        return Existing.Id == NewChatId;
-                    });
+                        Callback.ExecuteIfBound(false, TEXT("Create chat response misses chat object."));
+                        return;
+                    }
 
-                    FUEAIAgentChatSummary NewChat;
-                    NewChat.Id = NewChatId;
-                    NewChat.Title = NewTitle;
-                    NewChat.bArchived = bArchived;
-                    NewChat.LastActivityAt = LastActivityAt;
-                    Chats.Insert(NewChat, 0);
-                }
+                    FString NewChatId;
+                    (*ChatObj)->TryGetStringField(TEXT("id"), NewChatId);
+                    FString NewTitle;
+                    (*ChatObj)->TryGetStringField(TEXT("title"), NewTitle);
+                    bool bArchived = false;
+                    (*ChatObj)->TryGetBoolField(TEXT("archived"), bArchived);
+                    FString LastActivityAt;
+                    (*ChatObj)->TryGetStringField(TEXT("lastActivityAt"), LastActivityAt);
 
-                Callback.ExecuteIfBound(true, TEXT("Chat created."));
-            });
+                    SetActiveChatId(NewChatId);
+                    ActiveChatHistory.Reset();
+                    if (!NewChatId.IsEmpty())
+                    {
+                        FUEAIAgentChatSummary NewChat;
+                        NewChat.Id = NewChatId;
+                        NewChat.Title = NewTitle;
+                        NewChat.bArchived = bArchived;
+                        NewChat.LastActivityAt = LastActivityAt;
+                        Chats.Update([&NewChat](TArray<FUEAIAgentChatSummary>& Items)
+                        {
+                            Items.RemoveAll([&NewChat](const FUEAIAgentChatSummary& Existing)
+                            {
+                                return Existing.Id == NewChat.Id;
+                            });
+                            Items.Insert(MoveTemp(NewChat), 0);
+                        });
+                    }
+
+                    Callback.ExecuteIfBound(true, TEXT("Chat created."));
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::RenameActiveChat(const FString& NewTitle, const FOnUEAIAgentChatOpFinished& Callback) const
@@ -2844,75 +3043,74 @@ void FUEAIAgentTransportModule::RenameActiveChat(const FString& NewTitle, const
         return;
     }
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("title"), TrimmedTitle);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("title"), TrimmedTitle);
 
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatUpdateUrl(ActiveChatId));
-    Request->SetVerb(TEXT("PATCH"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("PATCH"), BuildChatUpdateUrl(ActiveChatId));
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Rename chat failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Rename chat response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Rename chat failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned a rename chat error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Rename chat response is not valid JSON."));
+                        return;
+                    }
 
-                const TSharedPtr<FJsonObject>* ChatObj = nullptr;
-                if (ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) && ChatObj && ChatObj->IsValid())
-                {
-                    FString ChatId;
-                    (*ChatObj)->TryGetStringField(TEXT("id"), ChatId);
-                    FString ChatTitle;
-                    (*ChatObj)->TryGetStringField(TEXT("title"), ChatTitle);
+                    bool bOk = false;
+                    if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
+                    {
+                        FString ErrorMessage = TEXT("Agent Core returned a rename chat error.");
+                        ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
+                        Callback.ExecuteIfBound(false, ErrorMessage);
+                        return;
+                    }
 
-                    for (FUEAIAgentChatSummary& Chat : Chats)
+                    const TSharedPtr<FJsonObject>* ChatObj = nullptr;
+                    if (ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) && ChatObj && ChatObj->IsValid())
                     {
-                        if (Chat.Id == ChatId)
+                        FString ChatId;
+                        (*ChatObj)->TryGetStringField(TEXT("id"), ChatId);
+                        FString ChatTitle;
+                        (*ChatObj)->TryGetStringField(TEXT("title"), ChatTitle);
+
+                        Chats.Update([&ChatId, &ChatTitle](TArray<FUEAIAgentChatSummary>& Items)
                         {
-                            Chat.Title = ChatTitle;
-                            break;
-                        }
+                            for (FUEAIAgentChatSummary& Chat : Items)
+                            {
+                                if (Chat.Id == ChatId)
+                                {
+                                    Chat.Title = ChatTitle;
+                                    break;
+                                }
+                            }
+                        });
                     }
-                }
 
-                Callback.ExecuteIfBound(true, TEXT("Chat title updated."));
-            });
+                    Callback.ExecuteIfBound(true, TEXT("Chat title updated."));
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::ArchiveActiveChat(const FOnUEAIAgentChatOpFinished& Callback) const
@@ -2934,81 +3132,80 @@ void FUEAIAgentTransportModule::ArchiveChat(const FString& ChatId, const FOnUEAI
         return;
     }
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetBoolField(TEXT("archived"), true);
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("archived"), true);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatUpdateUrl(ChatId));
-    Request->SetVerb(TEXT("PATCH"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("PATCH"), BuildChatUpdateUrl(ChatId));
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback, ChatId](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, ChatId, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, ChatId, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Archive chat failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Archive chat response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Archive chat failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned an archive chat error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Archive chat response is not valid JSON."));
+                        return;
+                    }
 
-                const TSharedPtr<FJsonObject>* ChatObj = nullptr;
-                if (ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) && ChatObj && ChatObj->IsValid())
-                {
-                    FString UpdatedChatId;
-                    (*ChatObj)->TryGetStringField(TEXT("id"), UpdatedChatId);
-                    FString UpdatedTitle;
-                    (*ChatObj)->TryGetStringField(TEXT("title"), UpdatedTitle);
-                    bool bArchived = false;
-                    (*ChatObj)->TryGetBoolField(TEXT("archived"), bArchived);
-                    FString LastActivityAt;
-                    (*ChatObj)->TryGetStringField(TEXT("lastActivityAt"), LastActivityAt);
+                    bool bOk = false;
+                    if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
+                    {
+                        FString ErrorMessage = TEXT("Agent Core returned an archive chat error.");
+                        ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
+                        Callback.ExecuteIfBound(false, ErrorMessage);
+                        return;
+                    }
 
-                    for (FUEAIAgentChatSummary& Chat : Chats)
+                    const TSharedPtr<FJsonObject>* ChatObj = nullptr;
+                    if (ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) && ChatObj && ChatObj->IsValid())
                     {
-                        if (Chat.Id == UpdatedChatId)
+                        FString UpdatedChatId;
+                        (*ChatObj)->TryGetStringField(TEXT("id"), UpdatedChatId);
+                        FString UpdatedTitle;
+                        (*ChatObj)->TryGetStringField(TEXT("title"), UpdatedTitle);
+                        bool bArchived = false;
+                        (*ChatObj)->TryGetBoolField(TEXT("archived"), bArchived);
+                        FString LastActivityAt;
+                        (*ChatObj)->TryGetStringField(TEXT("lastActivityAt"), LastActivityAt);
+
+                        Chats.Update([&](TArray<FUEAIAgentChatSummary>& Items)
                         {
-                            Chat.Title = UpdatedTitle;
-                            Chat.bArchived = bArchived;
-                            Chat.LastActivityAt = LastActivityAt;
-                            break;
-                        }
+                            for (FUEAIAgentChatSummary& Chat : Items)
+                            {
+                                if (Chat.Id == UpdatedChatId)
+                                {
+                                    Chat.Title = UpdatedTitle;
+                                    Chat.bArchived = bArchived;
+                                    Chat.LastActivityAt = LastActivityAt;
+                                    break;
+                                }
+                            }
+                        });
                     }
-                }
 
-                Callback.ExecuteIfBound(true, TEXT("Chat archived."));
-            });
+                    Callback.ExecuteIfBound(true, TEXT("Chat archived."));
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::RestoreChat(const FString& ChatId, const FOnUEAIAgentChatOpFinished& Callback) const
@@ -3019,81 +3216,80 @@ void FUEAIAgentTransportModule::RestoreChat(const FString& ChatId, const FOnUEAI
         return;
     }
 
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetBoolField(TEXT("archived"), false);
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("archived"), false);
 
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatUpdateUrl(ChatId));
-    Request->SetVerb(TEXT("PATCH"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("PATCH"), BuildChatUpdateUrl(ChatId));
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [this, Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
-
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Restore chat failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Restore chat response is not valid JSON."));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Restore chat failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned a restore chat error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Restore chat response is not valid JSON."));
+                        return;
+                    }
 
-                const TSharedPtr<FJsonObject>* ChatObj = nullptr;
-                if (ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) && ChatObj && ChatObj->IsValid())
-                {
-                    FString UpdatedChatId;
-                    (*ChatObj)->TryGetStringField(TEXT("id"), UpdatedChatId);
-                    FString UpdatedTitle;
-                    (*ChatObj)->TryGetStringField(TEXT("title"), UpdatedTitle);
-                    bool bArchived = false;
-                    (*ChatObj)->TryGetBoolField(TEXT("archived"), bArchived);
-                    FString LastActivityAt;
-                    (*ChatObj)->TryGetStringField(TEXT("lastActivityAt"), LastActivityAt);
+                    bool bOk = false;
+                    if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
+                    {
+                        FString ErrorMessage = TEXT("Agent Core returned a restore chat error.");
+                        ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
+                        Callback.ExecuteIfBound(false, ErrorMessage);
+                        return;
+                    }
 
-                    for (FUEAIAgentChatSummary& Chat : Chats)
+                    const TSharedPtr<FJsonObject>* ChatObj = nullptr;
+                    if (ResponseJson->TryGetObjectField(TEXT("chat"), ChatObj) && ChatObj && ChatObj->IsValid())
                     {
-                        if (Chat.Id == UpdatedChatId)
+                        FString UpdatedChatId;
+                        (*ChatObj)->TryGetStringField(TEXT("id"), UpdatedChatId);
+                        FString UpdatedTitle;
+                        (*ChatObj)->TryGetStringField(TEXT("title"), UpdatedTitle);
+                        bool bArchived = false;
+                        (*ChatObj)->TryGetBoolField(TEXT("archived"), bArchived);
+                        FString LastActivityAt;
+                        (*ChatObj)->TryGetStringField(TEXT("lastActivityAt"), LastActivityAt);
+
+                        Chats.Update([&](TArray<FUEAIAgentChatSummary>& Items)
                         {
-                            Chat.Title = UpdatedTitle;
-                            Chat.bArchived = bArchived;
-                            Chat.LastActivityAt = LastActivityAt;
-                            break;
-                        }
+                            for (FUEAIAgentChatSummary& Chat : Items)
+                            {
+                                if (Chat.Id == UpdatedChatId)
+                                {
+                                    Chat.Title = UpdatedTitle;
+                                    Chat.bArchived = bArchived;
+                                    Chat.LastActivityAt = LastActivityAt;
+                                    break;
+                                }
+                            }
+                        });
                     }
-                }
 
-                Callback.ExecuteIfBound(true, TEXT("Chat restored."));
-            });
+                    Callback.ExecuteIfBound(true, TEXT("Chat restored."));
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::DeleteChat(const FString& ChatId, const FOnUEAIAgentChatOpFinished& Callback) const
@@ -3104,9 +3300,7 @@ void FUEAIAgentTransportModule::DeleteChat(const FString& ChatId, const FOnUEAIA
         return;
     }
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatDeleteUrl(ChatId));
-    Request->SetVerb(TEXT("DELETE"));
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("DELETE"), BuildChatDeleteUrl(ChatId));
     Request->OnProcessRequestComplete().BindLambda(
         [this, Callback, ChatId](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
@@ -3126,140 +3320,203 @@ void FUEAIAgentTransportModule::DeleteChat(const FString& ChatId, const FOnUEAIA
 
                 if (ActiveChatId == ChatId)
                 {
-                    ActiveChatId.Empty();
-                    ActiveChatHistory.Empty();
+                    SetActiveChatId(FString());
+                    ActiveChatHistory.Reset();
                 }
-                Chats.RemoveAll([&ChatId](const FUEAIAgentChatSummary& Existing)
+                ChatHistoryCaches.Remove(ChatId);
+                Chats.Update([&ChatId](TArray<FUEAIAgentChatSummary>& Items)
                 {
-                    return Existing.Id == ChatId;
+                    Items.RemoveAll([&ChatId](const FUEAIAgentChatSummary& Existing)
+                    {
+                        return Existing.Id == ChatId;
+                    });
                 });
 
                 Callback.ExecuteIfBound(true, TEXT("Chat deleted."));
             });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
 }
 
 void FUEAIAgentTransportModule::LoadActiveChatHistory(int32 Limit, const FOnUEAIAgentChatOpFinished& Callback) const
 {
     if (ActiveChatId.IsEmpty())
     {
-        ActiveChatHistory.Empty();
+        HistoryRequest.Abandon(true, TEXT("No active chat selected."));
+        ActiveChatHistory.Reset();
         Callback.ExecuteIfBound(true, TEXT("No active chat selected."));
         return;
     }
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatHistoryUrl(ActiveChatId, Limit));
-    Request->SetVerb(TEXT("GET"));
-    Request->OnProcessRequestComplete().BindLambda(
-        [this, Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
-        {
-            AsyncTask(ENamedThreads::GameThread, [this, Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+    // With entries cached, only what was added after the newest one is fetched.
+    const FChatHistoryCache* Cache = ChatHistoryCaches.Find(ActiveChatId);
+    const FString SinceId = Cache && !Cache->Entries.IsEmpty() ? Cache->Entries.Last()->Id : FString();
+    const int32 PageSize = Limit > 0 ? Limit : ChatHistoryPageSize;
+    SendChatHistoryRequest(ActiveChatId, BuildChatHistoryUrl(ActiveChatId, PageSize, SinceId, FString()), false, Callback);
+}
 
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Chat history failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+void FUEAIAgentTransportModule::LoadOlderActiveChatHistory(const FOnUEAIAgentChatOpFinished& Callback) const
+{
+    if (!HasOlderActiveChatHistory())
+    {
+        Callback.ExecuteIfBound(true, TEXT("No older history."));
+        return;
+    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Chat history response is not valid JSON."));
-                    return;
-                }
+    const FChatHistoryCache* Cache = ChatHistoryCaches.Find(ActiveChatId);
+    const FString BeforeId = Cache->Entries.First()->Id;
+    SendChatHistoryRequest(
+        ActiveChatId,
+        BuildChatHistoryUrl(ActiveChatId, ChatHistoryPageSize, FString(), BeforeId),
+        true,
+        Callback);
+}
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned a chat history error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+bool FUEAIAgentTransportModule::HasOlderActiveChatHistory() const
+{
+    const FChatHistoryCache* Cache = ActiveChatId.IsEmpty() ? nullptr : ChatHistoryCaches.Find(ActiveChatId);
+    return Cache && Cache->bHasOlder && !Cache->Entries.IsEmpty();
+}
+
+void FUEAIAgentTransportModule::SendChatHistoryRequest(
+    const FString& ChatId,
+    const FString& Url,
+    bool bOlder,
+    const FOnUEAIAgentChatOpFinished& Callback) const
+{
+    uint64 Generation = 0;
+    if (!HistoryRequest.Begin(Url, Callback, Generation))
+    {
+        return;
+    }
 
-                ActiveChatHistory.Empty();
-                auto ParseDetails = [this](const TArray<TSharedPtr<FJsonValue>>& SourceItems)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("GET"), Url);
+    Request->OnProcessRequestComplete().BindLambda(
+        [this, Generation, ChatId, bOlder](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
+        {
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseChatHistory,
+                [this, Generation, ChatId, bOlder, HttpResponse, bConnectedSuccessfully](bool bValidJson, FUEAIAgentChatHistoryResponse&& Parsed)
                 {
-                    for (const TSharedPtr<FJsonValue>& Value : SourceItems)
+                    if (!HistoryRequest.IsCurrent(Generation))
                     {
-                        if (!Value.IsValid())
-                        {
-                            continue;
-                        }
+                        return;
+                    }
 
-                        const TSharedPtr<FJsonObject> EntryObj = Value->AsObject();
-                        if (!EntryObj.IsValid())
-                        {
-                            continue;
-                        }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        HistoryRequest.Finish(Generation, false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                        FUEAIAgentChatHistoryEntry Entry;
-                        EntryObj->TryGetStringField(TEXT("kind"), Entry.Kind);
-                        EntryObj->TryGetStringField(TEXT("route"), Entry.Route);
-                        EntryObj->TryGetStringField(TEXT("summary"), Entry.Summary);
-                        EntryObj->TryGetStringField(TEXT("provider"), Entry.Provider);
-                        EntryObj->TryGetStringField(TEXT("model"), Entry.Model);
-                        EntryObj->TryGetStringField(TEXT("chatType"), Entry.ChatType);
-                        const TSharedPtr<FJsonObject>* PayloadObj = nullptr;
-                        if (EntryObj->TryGetObjectField(TEXT("payload"), PayloadObj) && PayloadObj && PayloadObj->IsValid())
-                        {
-                            (*PayloadObj)->TryGetStringField(TEXT("displayRole"), Entry.DisplayRole);
-                            (*PayloadObj)->TryGetStringField(TEXT("displayText"), Entry.DisplayText);
-                            if (Entry.Provider.IsEmpty())
-                            {
-                                (*PayloadObj)->TryGetStringField(TEXT("provider"), Entry.Provider);
-                            }
-                            if (Entry.Model.IsEmpty())
-                            {
-                                (*PayloadObj)->TryGetStringField(TEXT("model"), Entry.Model);
-                            }
-                            if (Entry.ChatType.IsEmpty())
-                            {
-                                FString PayloadChatType;
-                                if (!(*PayloadObj)->TryGetStringField(TEXT("chatType"), PayloadChatType))
-                                {
-                                    (*PayloadObj)->TryGetStringField(TEXT("mode"), PayloadChatType);
-                                }
-                                Entry.ChatType = NormalizeChatType(PayloadChatType);
-                            }
-                        }
-                        Entry.ChatType = NormalizeChatType(Entry.ChatType);
-                        if (Entry.DisplayRole.IsEmpty())
-                        {
-                            Entry.DisplayRole = Entry.Kind.Equals(TEXT("asked"), ESearchCase::IgnoreCase)
-                                ? TEXT("user")
-                                : TEXT("assistant");
-                        }
-                        if (Entry.DisplayText.IsEmpty())
-                        {
-                            Entry.DisplayText = Entry.Summary;
-                        }
-                        EntryObj->TryGetStringField(TEXT("createdAt"), Entry.CreatedAt);
-                        ActiveChatHistory.Add(Entry);
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        HistoryRequest.Finish(Generation, false, FString::Printf(TEXT("Chat history failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
                     }
-                };
 
-                const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
-                if (ResponseJson->TryGetArrayField(TEXT("details"), Items) && Items)
-                {
-                    ParseDetails(*Items);
-                }
+                    if (!bValidJson)
+                    {
+                        HistoryRequest.Finish(Generation, false, TEXT("Chat history response is not valid JSON."));
+                        return;
+                    }
 
-                Callback.ExecuteIfBound(true, FString::Printf(TEXT("History loaded: %d"), ActiveChatHistory.Num()));
-            });
+                    if (!Parsed.bOk)
+                    {
+                        HistoryRequest.Finish(Generation, false, Parsed.Error.IsEmpty() ? TEXT("Agent Core returned a chat history error.") : Parsed.Error);
+                        return;
+                    }
+
+                    const int32 EntryCount = ApplyChatHistoryPage(ChatId, bOlder, MoveTemp(Parsed));
+                    HistoryRequest.Finish(Generation, true, FString::Printf(TEXT("History loaded: %d"), EntryCount));
+                });
         });
 
-    Request->ProcessRequest();
+    HistoryRequest.Track([Request]()
+    {
+        Request->CancelRequest();
+    });
+    CoreClient->Send(Request);
+}
+
+int32 FUEAIAgentTransportModule::ApplyChatHistoryPage(
+    const FString& ChatId,
+    bool bOlder,
+    FUEAIAgentChatHistoryResponse&& Page) const
+{
+    FChatHistoryCache& Cache = FindOrAddChatHistoryCache(ChatId);
+    const int32 EntryCount = Page.Entries.Num();
+    if (bOlder)
+    {
+        // The reader asked for these, so the ring grows to hold them; the server's hasMore decides whether more exist.
+        for (int32 Index = Page.Entries.Num() - 1; Index >= 0; --Index)
+        {
+            Cache.Entries.EmplaceFront(MakeShared<FUEAIAgentChatHistoryEntry>(MoveTemp(Page.Entries[Index])));
+        }
+        Cache.Capacity = FMath::Max(Cache.Capacity, Cache.Entries.Num());
+        Cache.bHasOlder = Page.bHasMore;
+    }
+    else
+    {
+        const bool bReplace = Page.bReset || Cache.Entries.IsEmpty();
+        if (bReplace)
+        {
+            Cache.Entries.Empty();
+            Cache.Capacity = ChatHistoryCacheCapacity;
+            Cache.bHasOlder = Page.bHasMore;
+        }
+        for (FUEAIAgentChatHistoryEntry& Entry : Page.Entries)
+        {
+            Cache.Entries.Emplace(MakeShared<FUEAIAgentChatHistoryEntry>(MoveTemp(Entry)));
+        }
+        while (Cache.Entries.Num() > Cache.Capacity)
+        {
+            Cache.Entries.PopFront();
+            Cache.bHasOlder = true;
+        }
+        if (!bReplace && EntryCount == 0 && PublishedHistoryChatId == ChatId)
+        {
+            return 0;
+        }
+    }
+
+    FUEAIAgentChatHistoryView Published;
+    Published.Reserve(Cache.Entries.Num());
+    for (int32 Index = 0; Index < Cache.Entries.Num(); ++Index)
+    {
+        Published.Add(Cache.Entries[Index]);
+    }
+    ActiveChatHistory.Set(MoveTemp(Published));
+    PublishedHistoryChatId = ChatId;
+    return EntryCount;
+}
+
+FUEAIAgentTransportModule::FChatHistoryCache& FUEAIAgentTransportModule::FindOrAddChatHistoryCache(const FString& ChatId) const
+{
+    if (!ChatHistoryCaches.Contains(ChatId) && ChatHistoryCaches.Num() >= MaxCachedChatHistories)
+    {
+        const FString* LeastRecentId = nullptr;
+        uint64 LeastRecentUse = MAX_uint64;
+        for (const TPair<FString, FChatHistoryCache>& Pair : ChatHistoryCaches)
+        {
+            if (Pair.Value.LastUsed < LeastRecentUse)
+            {
+                LeastRecentUse = Pair.Value.LastUsed;
+                LeastRecentId = &Pair.Key;
+            }
+        }
+        if (LeastRecentId)
+        {
+            ChatHistoryCaches.Remove(FString(*LeastRecentId));
+        }
+    }
+
+    FChatHistoryCache& Cache = ChatHistoryCaches.FindOrAdd(ChatId);
+    Cache.LastUsed = ++ChatHistoryUseCounter;
+    return Cache;
 }
 
 void FUEAIAgentTransportModule::AppendActiveChatAssistantMessage(
@@ -3287,99 +3544,96 @@ void FUEAIAgentTransportModule::AppendActiveChatAssistantMessage(
 
     const FString NormalizedText = DisplayText.TrimStartAndEnd().IsEmpty() ? NormalizedSummary : DisplayText.TrimStartAndEnd();
 
-    TSharedRef<FJsonObject> PayloadObj = MakeShared<FJsonObject>();
-    PayloadObj->SetStringField(TEXT("displayRole"), TEXT("assistant"));
-    PayloadObj->SetStringField(TEXT("displayText"), NormalizedText);
-    if (!Provider.TrimStartAndEnd().IsEmpty())
-    {
-        PayloadObj->SetStringField(TEXT("provider"), Provider.TrimStartAndEnd());
-    }
-    if (!Model.TrimStartAndEnd().IsEmpty())
-    {
-        PayloadObj->SetStringField(TEXT("model"), Model.TrimStartAndEnd());
-    }
-    if (!ChatType.TrimStartAndEnd().IsEmpty())
-    {
-        PayloadObj->SetStringField(TEXT("chatType"), ChatType.TrimStartAndEnd());
-    }
-
-    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
-    Root->SetStringField(TEXT("route"), NormalizedRoute);
-    Root->SetStringField(TEXT("summary"), NormalizedSummary);
-    Root->SetObjectField(TEXT("payload"), PayloadObj);
-
-    FString RequestBody;
-    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(Root, Writer);
-
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-    Request->SetURL(BuildChatDetailsUrl(ActiveChatId));
-    Request->SetVerb(TEXT("POST"));
+    FUEAIAgentRequestBody Body;
+    Body->WriteValue(TEXT("route"), NormalizedRoute);
+    Body->WriteValue(TEXT("summary"), NormalizedSummary);
+    Body->WriteObjectStart(TEXT("payload"));
+    Body->WriteValue(TEXT("displayRole"), FString(TEXT("assistant")));
+    Body->WriteValue(TEXT("displayText"), NormalizedText);
+    Body.WriteStringIfNotEmpty(TEXT("provider"), Provider.TrimStartAndEnd());
+    Body.WriteStringIfNotEmpty(TEXT("model"), Model.TrimStartAndEnd());
+    Body.WriteStringIfNotEmpty(TEXT("chatType"), ChatType.TrimStartAndEnd());
+    Body->WriteObjectEnd();
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CoreClient->CreateRequest(TEXT("POST"), BuildChatDetailsUrl(ActiveChatId));
     Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    Request->SetContentAsString(RequestBody);
+    Body.MoveToRequest(*Request);
     Request->OnProcessRequestComplete().BindLambda(
         [Callback](FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bConnectedSuccessfully)
         {
-            AsyncTask(ENamedThreads::GameThread, [Callback, HttpResponse, bConnectedSuccessfully]()
-            {
-                if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+            ParseResponseOnWorker(
+                HttpResponse,
+                bConnectedSuccessfully,
+                &FUEAIAgentResponseParser::ParseObject,
+                [Callback, HttpResponse, bConnectedSuccessfully](bool bValidJson, TSharedPtr<FJsonObject>&& ResponseJson)
                 {
-                    Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
-                    return;
-                }
+                    if (!bConnectedSuccessfully || !HttpResponse.IsValid())
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Could not connect to Agent Core."));
+                        return;
+                    }
 
-                if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
-                {
-                    Callback.ExecuteIfBound(false, FString::Printf(TEXT("Append chat message failed (%d)."), HttpResponse->GetResponseCode()));
-                    return;
-                }
+                    if (HttpResponse->GetResponseCode() < 200 || HttpResponse->GetResponseCode() >= 300)
+                    {
+                        Callback.ExecuteIfBound(false, FString::Printf(TEXT("Append chat message failed (%d)."), HttpResponse->GetResponseCode()));
+                        return;
+                    }
 
-                TSharedPtr<FJsonObject> ResponseJson;
-                const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HttpResponse->GetContentAsString());
-                if (!FJsonSerializer::Deserialize(Reader, ResponseJson) || !ResponseJson.IsValid())
-                {
-                    Callback.ExecuteIfBound(false, TEXT("Append chat message response is not valid JSON."));
-                    return;
-                }
+                    if (!bValidJson)
+                    {
+                        Callback.ExecuteIfBound(false, TEXT("Append chat message response is not valid JSON."));
+                        return;
+                    }
 
-                bool bOk = false;
-                if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
-                {
-                    FString ErrorMessage = TEXT("Agent Core returned an append chat message error.");
-                    ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
-                    Callback.ExecuteIfBound(false, ErrorMessage);
-                    return;
-                }
+                    bool bOk = false;
+                    if (!ResponseJson->TryGetBoolField(TEXT("ok"), bOk) || !bOk)
+                    {
+                        FString ErrorMessage = TEXT("Agent Core returned an append chat message error.");
+                        ResponseJson->TryGetStringField(TEXT("error"), ErrorMessage);
+                        Callback.ExecuteIfBound(false, ErrorMessage);
+                        return;
+                    }
 
-                Callback.ExecuteIfBound(true, TEXT("Chat message appended."));
-            });
+                    Callback.ExecuteIfBound(true, TEXT("Chat message appended."));
+                });
         });
 
-    Request->ProcessRequest();
+    CoreClient->Send(Request);
+}
+
+TSharedRef<const TArray<FUEAIAgentChatSummary>> FUEAIAgentTransportModule::GetChats() const
+{
+    return Chats.Get();
 }
 
-const TArray<FUEAIAgentChatSummary>& FUEAIAgentTransportModule::GetChats() const
+TSharedRef<const FUEAIAgentChatHistoryView> FUEAIAgentTransportModule::GetActiveChatHistory() const
 {
-    return Chats;
+    return ActiveChatHistory.Get();
 }
 
-const TArray<FUEAIAgentChatHistoryEntry>& FUEAIAgentTransportModule::GetActiveChatHistory() const
+TSharedRef<const TArray<FUEAIAgentModelOption>> FUEAIAgentTransportModule::GetAvailableModels() const
 {
-    return ActiveChatHistory;
+    return AvailableModels.Get();
 }
 
-const TArray<FUEAIAgentModelOption>& FUEAIAgentTransportModule::GetAvailableModels() const
+TSharedRef<const TArray<FUEAIAgentModelOption>> FUEAIAgentTransportModule::GetPreferredModels() const
 {
-    return AvailableModels;
+    return PreferredModels.Get();
 }
 
-const TArray<FUEAIAgentModelOption>& FUEAIAgentTransportModule::GetPreferredModels() const
+TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> FUEAIAgentTransportModule::GetPlannedActions() const
 {
-    return PreferredModels;
+    return PlannedActions.Get();
 }
 
 void FUEAIAgentTransportModule::SetActiveChatId(const FString& ChatId) const
 {
+    if (ActiveChatId != ChatId)
+    {
+        // History still loading for the previous chat must not land in the new one.
+        HistoryRequest.Abandon(true, TEXT("Active chat changed."));
+        PublishedHistoryChatId.Reset();
+    }
     ActiveChatId = ChatId;
 }
 
@@ -3395,17 +3649,18 @@ FString FUEAIAgentTransportModule::GetLastPlanSummary() const
 
 int32 FUEAIAgentTransportModule::GetPlannedActionCount() const
 {
-    return PlannedActions.Num();
+    return PlannedActions.Get()->Num();
 }
 
 FString FUEAIAgentTransportModule::GetPlannedActionPreviewText(int32 ActionIndex) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    if (!Actions->IsValidIndex(ActionIndex))
     {
         return TEXT("Invalid action index.");
     }
 
-    const FUEAIAgentPlannedSceneAction& Action = PlannedActions[ActionIndex];
+    const FUEAIAgentPlannedSceneAction& Action = (*Actions)[ActionIndex];
     const FString TargetText = FormatActorTargetShort(Action.ActorNames);
     if (Action.Type == EUEAIAgentPlannedActionType::CreateActor)
     {
@@ -3413,9 +3668,10 @@ FString FUEAIAgentTransportModule::GetPlannedActionPreviewText(int32 ActionIndex
             ? FString::Printf(TEXT("1 %s"), *Action.ActorClass)
             : FString::Printf(TEXT("%d %s actors"), Action.SpawnCount, *Action.ActorClass);
         return FString::Printf(
-            TEXT("Action %d: Create %s"),
+            TEXT("Action %d: Create %s%s"),
             ActionIndex + 1,
-            *SpawnTarget);
+            *SpawnTarget,
+            Action.bSpawnInstanced ? TEXT(" (instanced)") : TEXT(""));
     }
 
     if (Action.Type == EUEAIAgentPlannedActionType::DeleteActor)
@@ -3494,10 +3750,11 @@ FString FUEAIAgentTransportModule::GetPlannedActionPreviewText(int32 ActionIndex
     if (Action.Type == EUEAIAgentPlannedActionType::DuplicateActors)
     {
         return FString::Printf(
-            TEXT("Action %d: Duplicate %s x%d"),
+            TEXT("Action %d: Duplicate %s x%d%s"),
             ActionIndex + 1,
             *TargetText,
-            Action.DuplicateCount);
+            Action.DuplicateCount,
+            Action.bDuplicateInstanced ? TEXT(" (instanced)") : TEXT(""));
     }
 
     if (Action.Type == EUEAIAgentPlannedActionType::SessionBeginTransaction)
@@ -3535,38 +3792,41 @@ FString FUEAIAgentTransportModule::GetPlannedActionPreviewText(int32 ActionIndex
 
 bool FUEAIAgentTransportModule::IsPlannedActionApproved(int32 ActionIndex) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    if (!Actions->IsValidIndex(ActionIndex))
     {
         return false;
     }
 
-    return PlannedActions[ActionIndex].bApproved;
+    return (*Actions)[ActionIndex].bApproved;
 }
 
 int32 FUEAIAgentTransportModule::GetPlannedActionAttemptCount(int32 ActionIndex) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    if (!Actions->IsValidIndex(ActionIndex))
     {
         return 0;
     }
 
-    return PlannedActions[ActionIndex].AttemptCount;
+    return (*Actions)[ActionIndex].AttemptCount;
 }
 
 void FUEAIAgentTransportModule::SetPlannedActionApproved(int32 ActionIndex, bool bApproved) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    PlannedActions.Update([ActionIndex, bApproved](TArray<FUEAIAgentPlannedSceneAction>& Actions)
     {
-        return;
-    }
-
-    PlannedActions[ActionIndex].bApproved = bApproved;
+        if (Actions.IsValidIndex(ActionIndex))
+        {
+            Actions[ActionIndex].bApproved = bApproved;
+        }
+    });
 }
 
 bool FUEAIAgentTransportModule::PopApprovedPlannedActions(TArray<FUEAIAgentPlannedSceneAction>& OutActions) const
 {
     OutActions.Empty();
-    for (const FUEAIAgentPlannedSceneAction& Action : PlannedActions)
+    for (const FUEAIAgentPlannedSceneAction& Action : *PlannedActions.Get())
     {
         if (Action.bApproved)
         {
@@ -3574,34 +3834,36 @@ bool FUEAIAgentTransportModule::PopApprovedPlannedActions(TArray<FUEAIAgentPlann
         }
     }
 
-    PlannedActions.Empty();
+    PlannedActions.Reset();
     return OutActions.Num() > 0;
 }
 
 void FUEAIAgentTransportModule::ClearPlannedActions() const
 {
-    PlannedActions.Empty();
+    PlannedActions.Reset();
 }
 
 bool FUEAIAgentTransportModule::GetPlannedAction(int32 ActionIndex, FUEAIAgentPlannedSceneAction& OutAction) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    if (!Actions->IsValidIndex(ActionIndex))
     {
         return false;
     }
 
-    OutAction = PlannedActions[ActionIndex];
+    OutAction = (*Actions)[ActionIndex];
     return true;
 }
 
 bool FUEAIAgentTransportModule::GetPendingAction(int32 ActionIndex, FUEAIAgentPlannedSceneAction& OutAction) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    if (!Actions->IsValidIndex(ActionIndex))
     {
         return false;
     }
 
-    const FUEAIAgentPlannedSceneAction& Action = PlannedActions[ActionIndex];
+    const FUEAIAgentPlannedSceneAction& Action = (*Actions)[ActionIndex];
     if (Action.State != EUEAIAgentActionState::Pending)
     {
         return false;
@@ -3613,20 +3875,22 @@ bool FUEAIAgentTransportModule::GetPendingAction(int32 ActionIndex, FUEAIAgentPl
 
 void FUEAIAgentTransportModule::UpdateActionResult(int32 ActionIndex, bool bSucceeded, int32 AttemptCount) const
 {
-    if (!PlannedActions.IsValidIndex(ActionIndex))
+    PlannedActions.Update([ActionIndex, bSucceeded, AttemptCount](TArray<FUEAIAgentPlannedSceneAction>& Actions)
     {
-        return;
-    }
-
-    PlannedActions[ActionIndex].State = bSucceeded ? EUEAIAgentActionState::Succeeded : EUEAIAgentActionState::Failed;
-    PlannedActions[ActionIndex].AttemptCount = FMath::Max(0, AttemptCount);
+        if (Actions.IsValidIndex(ActionIndex))
+        {
+            Actions[ActionIndex].State = bSucceeded ? EUEAIAgentActionState::Succeeded : EUEAIAgentActionState::Failed;
+            Actions[ActionIndex].AttemptCount = FMath::Max(0, AttemptCount);
+        }
+    });
 }
 
 int32 FUEAIAgentTransportModule::GetNextPendingActionIndex() const
 {
-    for (int32 Index = 0; Index < PlannedActions.Num(); ++Index)
+    const TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> Actions = PlannedActions.Get();
+    for (int32 Index = 0; Index < Actions->Num(); ++Index)
     {
-        if (PlannedActions[Index].State == EUEAIAgentActionState::Pending)
+        if ((*Actions)[Index].State == EUEAIAgentActionState::Pending)
         {
             return Index;
         }
@@ -3639,4 +3903,27 @@ bool FUEAIAgentTransportModule::HasActiveSession() const
     return !ActiveSessionId.IsEmpty();
 }
 
+FString FUEAIAgentTransportModule::GetSessionStopCondition() const
+{
+    return ActiveSessionStopCondition;
+}
+
+FOnUEAIAgentPlannedActionsReceived& FUEAIAgentTransportModule::OnPlannedActionsReceived() const
+{
+    return PlannedActionsReceived;
+}
+
+TArray<FUEAIAgentRequestLatency> FUEAIAgentTransportModule::GetRequestLatencyStats() const
+{
+    return CoreClient.IsValid() ? CoreClient->GetLatencyStats() : TArray<FUEAIAgentRequestLatency>();
+}
+
+void FUEAIAgentTransportModule::ResetRequestLatencyStats() const
+{
+    if (CoreClient.IsValid())
+    {
+        CoreClient->ResetLatencyStats();
+    }
+}
+
 IMPLEMENT_MODULE(FUEAIAgentTransportModule, UEAIAgentTransport)
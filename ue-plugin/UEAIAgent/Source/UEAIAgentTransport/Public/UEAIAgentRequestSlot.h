@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Owns the single request that refreshes one piece of transport state, such as the chat list or the
+// active chat history. A call whose key matches the request in flight joins it instead of sending
+// again. A call with a different key cancels the old request and takes over its callbacks, so every
+// caller still hears back exactly once. Responses carry the generation they were started with and
+// are dropped once a newer request has begun. Game thread only.
+template <typename CallbackType>
+class TUEAIAgentRequestSlot
+{
+public:
+    // Queues Callback. Returns false when Key is already in flight, in which case nothing should be
+    // sent. Otherwise the caller sends a new request tagged with OutGeneration and registers it with Track.
+    bool Begin(const FString& Key, const CallbackType& Callback, uint64& OutGeneration)
+    {
+        Callbacks.Add(Callback);
+        if (bInFlight && Key == InFlightKey)
+        {
+            return false;
+        }
+
+        CancelInFlight();
+        bInFlight = true;
+        InFlightKey = Key;
+        OutGeneration = Generation;
+        return true;
+    }
+
+    // Cancel is used if the request gets superseded before it finishes.
+    void Track(TUniqueFunction<void()>&& Cancel)
+    {
+        CancelRequest = MoveTemp(Cancel);
+    }
+
+    bool IsCurrent(uint64 InGeneration) const
+    {
+        return bInFlight && InGeneration == Generation;
+    }
+
+    // Runs every queued callback. Does nothing for a superseded generation.
+    void Finish(uint64 InGeneration, bool bOk, const FString& Message)
+    {
+        if (!IsCurrent(InGeneration))
+        {
+            return;
+        }
+
+        bInFlight = false;
+        ++Generation;
+        InFlightKey.Reset();
+        CancelRequest.Reset();
+        RunCallbacks(bOk, Message);
+    }
+
+    // Cancels the request in flight, if any, and answers the queued callbacks with Message.
+    void Abandon(bool bOk, const FString& Message)
+    {
+        CancelInFlight();
+        bInFlight = false;
+        InFlightKey.Reset();
+        RunCallbacks(bOk, Message);
+    }
+
+private:
+    void CancelInFlight()
+    {
+        if (!bInFlight)
+        {
+            return;
+        }
+
+        // Bump first: cancelling may complete the old request right away, and it must already be stale.
+        ++Generation;
+        TUniqueFunction<void()> Cancel = MoveTemp(CancelRequest);
+        CancelRequest.Reset();
+        if (Cancel)
+        {
+            Cancel();
+        }
+    }
+
+    void RunCallbacks(bool bOk, const FString& Message)
+    {
+        // Callbacks may start the next request on this slot.
+        TArray<CallbackType> Finished = MoveTemp(Callbacks);
+        Callbacks.Reset();
+        for (const CallbackType& Callback : Finished)
+        {
+            Callback.ExecuteIfBound(bOk, Message);
+        }
+    }
+
+    TArray<CallbackType> Callbacks;
+    TUniqueFunction<void()> CancelRequest;
+    FString InFlightKey;
+    uint64 Generation = 0;
+    bool bInFlight = false;
+};
@@ -41,4 +41,11 @@ public:
         Category = "UI",
         meta = (DisplayName = "Chat List Max Rows", ClampMin = "3", ClampMax = "50", UIMin = "3", UIMax = "50"))
     int32 ChatListMaxRows;
+
+    UPROPERTY(
+        Config,
+        EditAnywhere,
+        Category = "Execution",
+        meta = (DisplayName = "Max Create Actor Count", ClampMin = "1", ClampMax = "10000", UIMin = "1", UIMax = "10000"))
+    int32 MaxCreateActorCount;
 };
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+// Publishes an immutable value that writers replace wholesale. Get hands out a reference-counted
+// view that stays valid and unchanged for as long as the reader holds it, even if a newer value is
+// published meanwhile. Only the pointer swap is locked; values are never copied for readers.
+// Writes come from the game thread; Update is a copy-modify-publish and not atomic across writers.
+template <typename ValueType>
+class TUEAIAgentStateSnapshot
+{
+public:
+    TUEAIAgentStateSnapshot()
+        : Value(MakeShared<ValueType>())
+    {
+    }
+
+    TSharedRef<const ValueType> Get() const
+    {
+        FReadScopeLock Lock(Guard);
+        return Value;
+    }
+
+    void Set(ValueType&& NewValue)
+    {
+        TSharedRef<const ValueType> NewRef = MakeShared<ValueType>(MoveTemp(NewValue));
+        {
+            FWriteScopeLock Lock(Guard);
+            Swap(Value, NewRef);
+        }
+        // The previous value is released here, outside the lock, once no reader holds it.
+    }
+
+    void Reset()
+    {
+        Set(ValueType());
+    }
+
+    template <typename FuncType>
+    void Update(FuncType&& Mutator)
+    {
+        ValueType Copy = *Get();
+        Mutator(Copy);
+        Set(MoveTemp(Copy));
+    }
+
+private:
+    mutable FRWLock Guard;
+    TSharedRef<const ValueType> Value;
+};
@@ -8,10 +8,12 @@
 
 namespace UEAIAgentToolCommands
 {
-    static constexpr int32 CommandCount = 15;
+    static constexpr int32 CommandCount = 17;
     static const TCHAR* const Commands[CommandCount] = {
         TEXT("context.getSceneSummary"),
         TEXT("context.getSelection"),
+        TEXT("context.findNearestActors"),
+        TEXT("context.findActorsInBox"),
         TEXT("scene.createActor"),
         TEXT("scene.modifyActor"),
         TEXT("scene.deleteActor"),
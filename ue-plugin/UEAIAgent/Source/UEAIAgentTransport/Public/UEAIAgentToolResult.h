@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+enum class EUEAIAgentToolErrorCode : uint8
+{
+    None,
+    EditorUnavailable,
+    WorldUnavailable,
+    InvalidArguments,
+    NoTargets,
+    AssetNotFound,
+    SpawnFailed,
+    TransactionState,
+    NothingChanged,
+    Stopped
+};
+
+UEAIAGENTTRANSPORT_API const TCHAR* LexToString(EUEAIAgentToolErrorCode ErrorCode);
+
+// Instances a tool call added to one instanced mesh actor: indices Start to Start + Count - 1.
+struct FUEAIAgentInstanceRange
+{
+    FName Actor;
+    int32 Start = 0;
+    int32 Count = 0;
+};
+
+// Outcome of one scene tool call. Only counts and ids are filled while executing;
+// text is built by ToMessage when something actually displays the result.
+struct UEAIAGENTTRANSPORT_API FUEAIAgentToolResult
+{
+    FUEAIAgentToolResult() = default;
+    explicit FUEAIAgentToolResult(const TCHAR* InTool)
+        : Tool(InTool)
+    {
+    }
+
+    // Marks the result failed. ErrorText must be a string literal; dynamic parts go to Detail.
+    bool Fail(EUEAIAgentToolErrorCode InErrorCode, const TCHAR* InErrorText);
+    // Counts the added instances and records them as contiguous index ranges on Actor.
+    void RecordInstances(FName Actor, const TArray<int32>& Indices);
+
+    FString ToMessage() const;
+    TSharedRef<FJsonObject> ToJson() const;
+
+    const TCHAR* Tool = TEXT("");
+    bool bOk = false;
+    EUEAIAgentToolErrorCode ErrorCode = EUEAIAgentToolErrorCode::None;
+    const TCHAR* ErrorText = nullptr;
+    FString Detail;
+    int32 TargetCount = 0;
+    int32 ActorCount = 0;
+    int32 ComponentCount = 0;
+    int32 InstanceCount = 0;
+    int32 RequestedCount = 0;
+    TArray<FName> AffectedActors;
+    TArray<FUEAIAgentInstanceRange> InstanceRanges;
+    double DurationSeconds = 0.0;
+    bool bUsedSelectionFallback = false;
+};
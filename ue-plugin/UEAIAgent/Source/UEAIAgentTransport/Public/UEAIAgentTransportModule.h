@@ -1,14 +1,27 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/RingBuffer.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
+#include "UEAIAgentRequestSlot.h"
+#include "UEAIAgentStateSnapshot.h"
+#include "UEAIAgentToolResult.h"
+
+class FJsonObject;
+class FUEAIAgentCoreClient;
+class FUEAIAgentEventChannel;
+class FUEAIAgentRequestBody;
+struct FUEAIAgentChatHistoryResponse;
+struct FUEAIAgentSceneAck;
 
 DECLARE_DELEGATE_TwoParams(FOnUEAIAgentHealthChecked, bool, const FString&);
 DECLARE_DELEGATE_TwoParams(FOnUEAIAgentTaskPlanned, bool, const FString&);
 DECLARE_DELEGATE_TwoParams(FOnUEAIAgentCredentialOpFinished, bool, const FString&);
 DECLARE_DELEGATE_TwoParams(FOnUEAIAgentSessionUpdated, bool, const FString&);
 DECLARE_DELEGATE_TwoParams(FOnUEAIAgentChatOpFinished, bool, const FString&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnUEAIAgentHealthChanged, bool, const FString&);
+DECLARE_MULTICAST_DELEGATE(FOnUEAIAgentChatsChanged);
 
 enum class EUEAIAgentPlannedActionType : uint8
 {
@@ -70,6 +83,8 @@ struct FUEAIAgentPlannedSceneAction
     FVector SpawnLocation = FVector::ZeroVector;
     FRotator SpawnRotation = FRotator::ZeroRotator;
     int32 SpawnCount = 1;
+    FString SpawnMeshPath;
+    bool bSpawnInstanced = false;
 
     // scene.addActorTag
     FString ActorTag;
@@ -90,6 +105,7 @@ struct FUEAIAgentPlannedSceneAction
     // scene.duplicateActors
     int32 DuplicateCount = 1;
     FVector DuplicateOffset = FVector::ZeroVector;
+    bool bDuplicateInstanced = false;
 
     // session.beginTransaction
     FString TransactionDescription;
@@ -100,6 +116,8 @@ struct FUEAIAgentPlannedSceneAction
     bool bApproved = true;
 };
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnUEAIAgentPlannedActionsReceived, const TArray<FUEAIAgentPlannedSceneAction>&);
+
 struct FUEAIAgentChatSummary
 {
     FString Id;
@@ -110,6 +128,8 @@ struct FUEAIAgentChatSummary
 
 struct FUEAIAgentChatHistoryEntry
 {
+    // Empty for entries the panel shows before Agent Core has stored them.
+    FString Id;
     FString Kind;
     FString Route;
     FString Summary;
@@ -121,12 +141,27 @@ struct FUEAIAgentChatHistoryEntry
     FString CreatedAt;
 };
 
+// Published chat history. Entries are immutable and shared with the history cache, so publishing a new view copies pointers, not text.
+using FUEAIAgentChatHistoryView = TArray<TSharedRef<const FUEAIAgentChatHistoryEntry>>;
+
 struct FUEAIAgentModelOption
 {
     FString Provider;
     FString Model;
 };
 
+// Round-trip timing of Agent Core requests, keyed by "VERB /path" with chat ids folded to ":id".
+struct FUEAIAgentRequestLatency
+{
+    FString Route;
+    int32 Count = 0;
+    int32 FailureCount = 0;
+    double LastMs = 0.0;
+    double MinMs = 0.0;
+    double MaxMs = 0.0;
+    double AverageMs = 0.0;
+};
+
 class UEAIAGENTTRANSPORT_API FUEAIAgentTransportModule : public IModuleInterface
 {
 public:
@@ -158,7 +193,8 @@ public:
         const FString& Provider,
         const FString& Model,
         const FOnUEAIAgentSessionUpdated& Callback) const;
-    void NextSession(bool bHasResult, bool bResultOk, const FString& ResultMessage, const FOnUEAIAgentSessionUpdated& Callback) const;
+    // Result may be null when only asking for the next decision.
+    void NextSession(const FUEAIAgentToolResult* Result, const FOnUEAIAgentSessionUpdated& Callback) const;
     void ApproveCurrentSessionAction(bool bApproved, const FOnUEAIAgentSessionUpdated& Callback) const;
     void ResumeSession(const FOnUEAIAgentSessionUpdated& Callback) const;
     void SetProviderApiKey(const FString& Provider, const FString& ApiKey, const FOnUEAIAgentCredentialOpFinished& Callback) const;
@@ -174,7 +210,11 @@ public:
     void ArchiveChat(const FString& ChatId, const FOnUEAIAgentChatOpFinished& Callback) const;
     void RestoreChat(const FString& ChatId, const FOnUEAIAgentChatOpFinished& Callback) const;
     void DeleteChat(const FString& ChatId, const FOnUEAIAgentChatOpFinished& Callback) const;
+    // Fetches the entries added since the last load; the first load of a chat fetches its latest page.
+    // Limit 0 uses the default page size.
     void LoadActiveChatHistory(int32 Limit, const FOnUEAIAgentChatOpFinished& Callback) const;
+    void LoadOlderActiveChatHistory(const FOnUEAIAgentChatOpFinished& Callback) const;
+    bool HasOlderActiveChatHistory() const;
     void AppendActiveChatAssistantMessage(
         const FString& Route,
         const FString& Summary,
@@ -183,10 +223,12 @@ public:
         const FString& Model,
         const FString& ChatType,
         const FOnUEAIAgentChatOpFinished& Callback) const;
-    const TArray<FUEAIAgentChatSummary>& GetChats() const;
-    const TArray<FUEAIAgentChatHistoryEntry>& GetActiveChatHistory() const;
-    const TArray<FUEAIAgentModelOption>& GetAvailableModels() const;
-    const TArray<FUEAIAgentModelOption>& GetPreferredModels() const;
+    // Immutable snapshots; a held reference is unaffected by later refreshes.
+    TSharedRef<const TArray<FUEAIAgentChatSummary>> GetChats() const;
+    TSharedRef<const FUEAIAgentChatHistoryView> GetActiveChatHistory() const;
+    TSharedRef<const TArray<FUEAIAgentModelOption>> GetAvailableModels() const;
+    TSharedRef<const TArray<FUEAIAgentModelOption>> GetPreferredModels() const;
+    TSharedRef<const TArray<FUEAIAgentPlannedSceneAction>> GetPlannedActions() const;
     void SetActiveChatId(const FString& ChatId) const;
     FString GetActiveChatId() const;
     FString GetLastPlanSummary() const;
@@ -202,9 +244,21 @@ public:
     void UpdateActionResult(int32 ActionIndex, bool bSucceeded, int32 AttemptCount) const;
     int32 GetNextPendingActionIndex() const;
     bool HasActiveSession() const;
+    // Type of the stop condition that ended the last session decision, or empty when none matched.
+    FString GetSessionStopCondition() const;
+    FOnUEAIAgentPlannedActionsReceived& OnPlannedActionsReceived() const;
+    // Opens the Agent Core event channel. Health and chat changes are then pushed through
+    // OnHealthChanged/OnChatsChanged, and session steps go over the channel while it is connected.
+    void ConnectEventChannel() const;
+    bool IsEventChannelConnected() const;
+    FOnUEAIAgentHealthChanged& OnHealthChanged() const;
+    FOnUEAIAgentChatsChanged& OnChatsChanged() const;
+    TArray<FUEAIAgentRequestLatency> GetRequestLatencyStats() const;
+    void ResetRequestLatencyStats() const;
 
 private:
     FString BuildBaseUrl() const;
+    FString BuildEventsUrl() const;
     FString BuildHealthUrl() const;
     FString BuildPlanUrl() const;
     FString BuildProviderStatusUrl() const;
@@ -222,20 +276,70 @@ private:
     FString BuildChatDeleteUrl(const FString& ChatId) const;
     FString BuildChatUpdateUrl(const FString& ChatId) const;
     FString BuildChatDetailsUrl(const FString& ChatId) const;
-    FString BuildChatHistoryUrl(const FString& ChatId, int32 Limit) const;
+    FString BuildChatHistoryUrl(const FString& ChatId, int32 Limit, const FString& SinceId, const FString& BeforeId) const;
     bool ParseSessionDecision(
         const TSharedPtr<FJsonObject>& ResponseJson,
         const TArray<FString>& SelectedActors,
         FString& OutMessage) const;
+    TSharedRef<FJsonObject> BuildSceneDelta() const;
+    void ApplySceneAck(const FUEAIAgentSceneAck& Ack) const;
+    void SendSessionStep(
+        const TCHAR* ChannelType,
+        const FString& Url,
+        FUEAIAgentRequestBody& Body,
+        const TCHAR* InvalidJsonMessage,
+        const FOnUEAIAgentSessionUpdated& Callback) const;
+    void PostSessionStep(
+        const FString& Url,
+        TArray<uint8>&& Payload,
+        const TCHAR* InvalidJsonMessage,
+        const FOnUEAIAgentSessionUpdated& Callback) const;
+    void HandleChannelConnectionChanged(bool bConnected) const;
+    void HandleChannelEvent(const FString& Type, const TSharedPtr<FJsonObject>& Event) const;
+    void AnswerContextQuery(const TSharedPtr<FJsonObject>& Query) const;
+
+    // Recently viewed chats keep their history here so reopening one only fetches the delta.
+    struct FChatHistoryCache
+    {
+        TRingBuffer<TSharedRef<const FUEAIAgentChatHistoryEntry>> Entries;
+        // Grows past ChatHistoryCacheCapacity when older pages are loaded explicitly.
+        int32 Capacity = 0;
+        bool bHasOlder = false;
+        uint64 LastUsed = 0;
+    };
+
+    void SendChatHistoryRequest(
+        const FString& ChatId,
+        const FString& Url,
+        bool bOlder,
+        const FOnUEAIAgentChatOpFinished& Callback) const;
+    int32 ApplyChatHistoryPage(const FString& ChatId, bool bOlder, FUEAIAgentChatHistoryResponse&& Page) const;
+    FChatHistoryCache& FindOrAddChatHistoryCache(const FString& ChatId) const;
 
-    mutable TArray<FUEAIAgentPlannedSceneAction> PlannedActions;
+    TSharedPtr<FUEAIAgentCoreClient> CoreClient;
+    TSharedPtr<FUEAIAgentEventChannel> EventChannel;
+    mutable FOnUEAIAgentHealthChanged HealthChanged;
+    mutable FOnUEAIAgentChatsChanged ChatsChanged;
+    mutable TUEAIAgentStateSnapshot<TArray<FUEAIAgentPlannedSceneAction>> PlannedActions;
     mutable FString ActiveSessionId;
     mutable int32 ActiveSessionActionIndex = INDEX_NONE;
+    mutable FString ActiveSessionStopCondition;
     mutable TArray<FString> ActiveSessionSelectedActors;
-    mutable TArray<FUEAIAgentChatSummary> Chats;
-    mutable TArray<FUEAIAgentChatHistoryEntry> ActiveChatHistory;
-    mutable TArray<FUEAIAgentModelOption> AvailableModels;
-    mutable TArray<FUEAIAgentModelOption> PreferredModels;
+    mutable TUEAIAgentStateSnapshot<TArray<FUEAIAgentChatSummary>> Chats;
+    // Filter of the last chat list load; pushed chat changes are held to the same filter.
+    mutable bool bChatsIncludeArchived = false;
+    mutable TUEAIAgentStateSnapshot<FUEAIAgentChatHistoryView> ActiveChatHistory;
+    mutable TUEAIAgentStateSnapshot<TArray<FUEAIAgentModelOption>> AvailableModels;
+    mutable TUEAIAgentStateSnapshot<TArray<FUEAIAgentModelOption>> PreferredModels;
+    mutable TUEAIAgentRequestSlot<FOnUEAIAgentChatOpFinished> ChatsRequest;
+    mutable TUEAIAgentRequestSlot<FOnUEAIAgentChatOpFinished> HistoryRequest;
+    mutable TMap<FString, FChatHistoryCache> ChatHistoryCaches;
+    mutable FString PublishedHistoryChatId;
+    mutable uint64 ChatHistoryUseCounter = 0;
+    mutable TUEAIAgentRequestSlot<FOnUEAIAgentCredentialOpFinished> ModelsRequest;
     mutable FString ActiveChatId;
     mutable FString LastPlanSummary;
+    mutable FOnUEAIAgentPlannedActionsReceived PlannedActionsReceived;
+    mutable FGuid AcknowledgedSnapshotId;
+    mutable uint64 AcknowledgedSnapshotVersion = 0;
 };
@@ -22,7 +22,9 @@ public class UEAIAgentTransport : ModuleRules
                 "DeveloperSettings",
                 "HTTP",
                 "Json",
-                "JsonUtilities"
+                "JsonUtilities",
+                "WebSockets",
+                "UEAIAgentContext"
             }
         );
     }